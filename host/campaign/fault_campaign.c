@@ -0,0 +1,555 @@
+/******************************************************************************
+* File Name:   fault_campaign.c
+*
+* Description: Fault injection campaign on the host build: injects faults at random
+*              times into the periodic test sequence and reports the detection
+*              probability and the detection latency per fault class.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CAMPAIGN_USAGE \
+    "usage: fault_campaign [-n trials] [-p period_ms] [-m passes] [-s seed]\n" \
+    "                      [-f fault]... [-c file.csv]\n" \
+    "  -n trials     trials per fault class (default 200)\n" \
+    "  -p period_ms  period of the test sequence (default: its duration)\n" \
+    "  -m passes     passes of the sequence after the injection (default 3)\n" \
+    "  -s seed       random seed (default 1)\n" \
+    "  -f fault      fault class, repeatable (default: all, see self_test_host -l)\n" \
+    "  -c file.csv   write every trial to a CSV file\n"
+
+/* Different detecting tests counted per fault class. The last one counts
+ * the detectors past the others, as "other" */
+#define CAMPAIGN_DETECTORS              (8u)
+#define CAMPAIGN_OTHER_DETECTOR         (CAMPAIGN_DETECTORS - 1u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One trial, the context of the event hook. Times are campaign times in
+ * virtual CPU cycles: the virtual clock plus the idle time between passes */
+typedef struct
+{
+    sim_fault_t fault;
+    uint32_t param;
+    uint64_t inject_at;     /* Fault occurrence */
+    bool injected;          /* The fault is active */
+    bool detected;
+    uint64_t detect_at;     /* First error reported after the injection */
+    const char *detector;   /* API or event that reported it */
+} campaign_trial_t;
+
+/* Results of one fault class */
+typedef struct
+{
+    uint32_t trials;
+    uint32_t detected;
+    uint64_t *latency;      /* Detection latencies of the detected trials */
+    const char *detector[CAMPAIGN_DETECTORS];
+    uint32_t detector_count[CAMPAIGN_DETECTORS];
+} campaign_class_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint64_t campaign_random_state = 1u;
+
+/* Idle time between the passes of the sequence, added to the virtual clock */
+static uint64_t campaign_idle;
+
+/*****************************************************************************
+* Function Name: Campaign_Random
+******************************************************************************
+* Summary:
+* splitmix64 generator of the fault times and parameters.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t: Next value
+*****************************************************************************/
+static uint64_t Campaign_Random(void)
+{
+    uint64_t z = (campaign_random_state += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27u)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31u);
+}
+
+/*****************************************************************************
+* Function Name: Campaign_Param
+******************************************************************************
+* Summary:
+* Returns a random parameter of a fault class, see sim_fault.c.
+*
+* Parameters:
+*  fault: Fault class
+*
+* Return:
+*  uint32_t: Fault parameter
+*****************************************************************************/
+static uint32_t Campaign_Param(sim_fault_t fault)
+{
+    uint32_t r = (uint32_t)Campaign_Random();
+    uint32_t bit = ((r >> 20u) & 0x1Fu) << 16u;
+    int32_t drift;
+
+    switch (fault)
+    {
+        case SIM_FAULT_IO:
+            return ((r & 0x0Fu) << 8u) | ((r >> 4u) & 0x07u);
+        case SIM_FAULT_STARTUP_REGS:
+            return r % SIM_CFG_REGS;
+        case SIM_FAULT_CLOCK_DRIFT:
+            /* -20 % to +20 %, not 0 */
+            drift = (int32_t)(r % 20u) + 1;
+            return (uint32_t)((0u != (r & 0x80000000UL)) ? -drift : drift);
+        case SIM_FAULT_IRQ_LOST:
+            return (uint32_t)SIM_TCPWM_IRQ_BASE + (r % SIM_TCPWM_COUNTERS);
+        case SIM_FAULT_SRAM_STUCK:
+            return (r % SIM_SRAM_WORDS) | bit | (r & 0x80000000UL);
+        case SIM_FAULT_SRAM_COUPLING:
+            return (r % (SIM_SRAM_WORDS - 1u)) | bit;
+        case SIM_FAULT_STACK_STUCK:
+            return (r % SIM_STACK_WORDS) | bit | (r & 0x80000000UL);
+        case SIM_FAULT_FLASH_FLIP:
+            return (r % SIM_FLASH_WORDS) | bit;
+        default:
+            return 0u;
+    }
+}
+
+/*****************************************************************************
+* Function Name: Campaign_Now
+******************************************************************************
+* Summary:
+* Returns the campaign time.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t: Virtual CPU cycles
+*****************************************************************************/
+static uint64_t Campaign_Now(void)
+{
+    return Sim_Clock_Cycles() + campaign_idle;
+}
+
+/*****************************************************************************
+* Function Name: Campaign_Hook
+******************************************************************************
+* Summary:
+* Event hook of a trial. Activates the fault at the first event after its
+* occurrence time: between two events no test runs, so the fault cannot be
+* observed earlier. Records the first error reported after the injection.
+*
+* Parameters:
+*  event:   Event
+*  name:    API name
+*  value:   Event value
+*  context: Trial
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Campaign_Hook(sim_event_t event, const char *name, uint32_t value, void *context)
+{
+    campaign_trial_t *trial = (campaign_trial_t *)context;
+
+    if (!trial->injected && (Campaign_Now() >= trial->inject_at))
+    {
+        Sim_Fault_Inject(trial->fault, trial->param);
+        trial->injected = true;
+    }
+    if (trial->injected && !trial->detected && (SIM_EVENT_TEST_RESULT == event) &&
+        (OK_STATUS != value) && (PASS_COMPLETE_STATUS != value) &&
+        (PASS_STILL_TESTING_STATUS != value))
+    {
+        trial->detected = true;
+        trial->detect_at = Campaign_Now();
+        trial->detector = name;
+    }
+}
+
+/*****************************************************************************
+* Function Name: Campaign_Trial
+******************************************************************************
+* Summary:
+* Runs one trial: the fault occurs at a random time of the first period,
+* and the test sequence runs once per period until the fault is detected,
+* at most the given number of passes after the injection. Each pass is a
+* run from power-on; the memory model keeps the flash and the faults.
+*
+* Parameters:
+*  trial:      Trial, fault and parameter set
+*  period:     Period of the sequence, in virtual CPU cycles
+*  max_passes: Passes after the injection
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Campaign_Trial(campaign_trial_t *trial, uint64_t period, uint32_t max_passes)
+{
+    sim_run_result_t result;
+    uint64_t pass_start;
+    uint32_t passes = 0u;
+
+    trial->injected = false;
+    trial->detected = false;
+    trial->detector = NULL;
+    trial->inject_at = Campaign_Now() + (Campaign_Random() % period);
+
+    Sim_Fault_Clear_All();
+    Sim_Set_Hook(Campaign_Hook, trial);
+    while (!trial->detected && (passes < max_passes))
+    {
+        pass_start = Campaign_Now();
+        Sim_Run(&result);
+        if (trial->injected)
+        {
+            passes++;
+            if (!trial->detected && (result.asserted || !result.completed))
+            {
+                /* CY_ASSERT or reset loop: the run did not reach its idle loop */
+                trial->detected = true;
+                trial->detect_at = Campaign_Now();
+                trial->detector = result.asserted ? "CY_ASSERT" : "reset loop";
+            }
+        }
+        if (Campaign_Now() < (pass_start + period))
+        {
+            campaign_idle += (pass_start + period) - Campaign_Now();
+        }
+    }
+    Sim_Set_Hook(NULL, NULL);
+    Sim_Fault_Clear_All();
+}
+
+/*****************************************************************************
+* Function Name: Campaign_Count_Detector
+******************************************************************************
+* Summary:
+* Counts the test that detected a fault of a class. When all the counters
+* are taken, counts it as "other".
+*
+* Parameters:
+*  cls:      Fault class results
+*  detector: API or event name
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Campaign_Count_Detector(campaign_class_t *cls, const char *detector)
+{
+    uint32_t i;
+
+    for (i = 0u; i < CAMPAIGN_OTHER_DETECTOR; i++)
+    {
+        if ((NULL == cls->detector[i]) || (0 == strcmp(cls->detector[i], detector)))
+        {
+            cls->detector[i] = detector;
+            cls->detector_count[i]++;
+            return;
+        }
+    }
+    cls->detector[CAMPAIGN_OTHER_DETECTOR] = "other";
+    cls->detector_count[CAMPAIGN_OTHER_DETECTOR]++;
+}
+
+/*****************************************************************************
+* Function Name: Campaign_Compare
+******************************************************************************
+* Summary:
+* qsort() comparison of two latencies.
+*
+* Parameters:
+*  a, b: Latencies
+*
+* Return:
+*  int: Order
+*****************************************************************************/
+static int Campaign_Compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*****************************************************************************
+* Function Name: Campaign_Ms
+******************************************************************************
+* Summary:
+* Returns the latency at a quantile of the sorted latencies (nearest rank).
+*
+* Parameters:
+*  cls:      Fault class results, latencies sorted
+*  quantile: 0.0 to 1.0
+*
+* Return:
+*  double: Latency in milliseconds
+*****************************************************************************/
+static double Campaign_Ms(const campaign_class_t *cls, double quantile)
+{
+    uint32_t rank = (uint32_t)ceil(quantile * cls->detected);
+
+    rank = (0u == rank) ? 0u : (rank - 1u);
+    return (double)cls->latency[rank] / SIM_CYCLES_PER_MS;
+}
+
+/*****************************************************************************
+* Function Name: Campaign_Report
+******************************************************************************
+* Summary:
+* Prints the detection probability with its 95 % Wilson score interval, the
+* latency distribution and the most frequent detector of a fault class.
+*
+* Parameters:
+*  out:   Output
+*  fault: Fault class
+*  cls:   Fault class results
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Campaign_Report(FILE *out, sim_fault_t fault, campaign_class_t *cls)
+{
+    const double z = 1.96;
+    double n = cls->trials;
+    double p = (0u != cls->trials) ? ((double)cls->detected / n) : 0.0;
+    double center = (p + (z * z) / (2.0 * n)) / (1.0 + (z * z) / n);
+    double half = (z / (1.0 + (z * z) / n)) * sqrt((p * (1.0 - p) / n) + (z * z) / (4.0 * n * n));
+    uint32_t best = 0u;
+    uint32_t i;
+
+    for (i = 1u; i < CAMPAIGN_DETECTORS; i++)
+    {
+        if (cls->detector_count[i] > cls->detector_count[best])
+        {
+            best = i;
+        }
+    }
+
+    fprintf(out, "%-16s %6lu %6lu  %5.3f [%5.3f,%5.3f]", Sim_Fault_Name(fault),
+            (unsigned long)cls->trials, (unsigned long)cls->detected, p,
+            fmax(center - half, 0.0), fmin(center + half, 1.0));
+    if (0u != cls->detected)
+    {
+        qsort(cls->latency, cls->detected, sizeof(cls->latency[0]), Campaign_Compare);
+        fprintf(out, " %8.3f %8.3f %8.3f %8.3f %8.3f  %s\n",
+                Campaign_Ms(cls, 0.0), Campaign_Ms(cls, 0.5), Campaign_Ms(cls, 0.9),
+                Campaign_Ms(cls, 0.99), Campaign_Ms(cls, 1.0), cls->detector[best]);
+    }
+    else
+    {
+        fprintf(out, " %8s %8s %8s %8s %8s  -\n", "-", "-", "-", "-", "-");
+    }
+}
+
+/*****************************************************************************
+* Function Name: main
+******************************************************************************
+* Summary:
+* Measures the period of the fault-free test sequence, then runs the trials
+* of every selected fault class and prints one line of results per class.
+* The UART output of the application is discarded.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS, EXIT_FAILURE on a usage error or a failed fault-free
+*       run
+*****************************************************************************/
+int main(int argc, char *argv[])
+{
+    static campaign_class_t classes[SIM_FAULT_COUNT];
+    bool selected[SIM_FAULT_COUNT] = {false};
+    bool any_selected = false;
+    campaign_trial_t trial;
+    sim_run_result_t result;
+    uint32_t trials = 200u;
+    uint32_t max_passes = 3u;
+    uint64_t period = 0u;
+    const char *csv_name = NULL;
+    FILE *csv = NULL;
+    FILE *out;
+    sim_fault_t fault;
+    uint32_t f;
+    uint32_t i;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "n:p:m:s:f:c:")))
+    {
+        switch (opt)
+        {
+            case 'n':
+                trials = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                period = strtoull(optarg, NULL, 0) * SIM_CYCLES_PER_MS;
+                break;
+            case 'm':
+                max_passes = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                campaign_random_state = strtoull(optarg, NULL, 0);
+                break;
+            case 'f':
+                if (!Sim_Fault_Parse(optarg, &fault))
+                {
+                    fprintf(stderr, "unknown fault: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                selected[fault] = true;
+                any_selected = true;
+                break;
+            case 'c':
+                csv_name = optarg;
+                break;
+            default:
+                fputs(CAMPAIGN_USAGE, stderr);
+                return EXIT_FAILURE;
+        }
+    }
+    if ((0u == trials) || (0u == max_passes))
+    {
+        fputs(CAMPAIGN_USAGE, stderr);
+        return EXIT_FAILURE;
+    }
+
+    /* The report goes to the original stdout, the application output to
+     * /dev/null */
+    out = fdopen(dup(STDOUT_FILENO), "w");
+    if ((NULL == out) || (NULL == freopen("/dev/null", "w", stdout)))
+    {
+        return EXIT_FAILURE;
+    }
+    if ((NULL != csv_name) && (NULL == (csv = fopen(csv_name, "w"))))
+    {
+        fprintf(stderr, "cannot open %s\n", csv_name);
+        return EXIT_FAILURE;
+    }
+
+    /* Fault-free sequence: duration and default period */
+    Sim_Run(&result);
+    if (!result.completed || (0u != result.errors))
+    {
+        fprintf(stderr, "fault-free run failed\n");
+        return EXIT_FAILURE;
+    }
+    if (0u == period)
+    {
+        period = result.cycles;
+    }
+    else if (period < result.cycles)
+    {
+        fprintf(stderr, "warning: period shorter than the sequence, passes run back to back\n");
+    }
+
+    fprintf(out, "sequence %.3f ms, period %.3f ms, %lu trials per class, %lu passes\n\n",
+            (double)result.cycles / SIM_CYCLES_PER_MS, (double)period / SIM_CYCLES_PER_MS,
+            (unsigned long)trials, (unsigned long)max_passes);
+    fprintf(out, "%-16s %6s %6s  %-19s %8s %8s %8s %8s %8s  %s\n", "fault", "trials", "found",
+            "P(detect) 95% CI", "min ms", "p50 ms", "p90 ms", "p99 ms", "max ms", "detected by");
+    if (NULL != csv)
+    {
+        fprintf(csv, "fault,param,inject_ms,detected,latency_ms,detector\n");
+    }
+
+    for (f = 0u; f < (uint32_t)SIM_FAULT_COUNT; f++)
+    {
+        campaign_class_t *cls = &classes[f];
+
+        if (any_selected && !selected[f])
+        {
+            continue;
+        }
+        cls->latency = calloc(trials, sizeof(cls->latency[0]));
+        if (NULL == cls->latency)
+        {
+            return EXIT_FAILURE;
+        }
+        for (i = 0u; i < trials; i++)
+        {
+            trial.fault = (sim_fault_t)f;
+            trial.param = Campaign_Param(trial.fault);
+            Campaign_Trial(&trial, period, max_passes);
+
+            cls->trials++;
+            if (trial.detected)
+            {
+                cls->latency[cls->detected++] = trial.detect_at - trial.inject_at;
+                Campaign_Count_Detector(cls, trial.detector);
+            }
+            if (NULL != csv)
+            {
+                fprintf(csv, "%s,0x%08lX,%.3f,%d,%.3f,%s\n", Sim_Fault_Name(trial.fault),
+                        (unsigned long)trial.param,
+                        (double)trial.inject_at / SIM_CYCLES_PER_MS, trial.detected ? 1 : 0,
+                        trial.detected ? ((double)(trial.detect_at - trial.inject_at) /
+                                          SIM_CYCLES_PER_MS) : 0.0,
+                        trial.detected ? trial.detector : "");
+            }
+        }
+        Campaign_Report(out, (sim_fault_t)f, cls);
+        fflush(out);
+        free(cls->latency);
+    }
+
+    if (NULL != csv)
+    {
+        fclose(csv);
+    }
+    fclose(out);
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
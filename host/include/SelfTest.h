@@ -0,0 +1,136 @@
+/******************************************************************************
+* File Name:   SelfTest.h
+*
+* Description: Simulated subset of the Class-B Safety Software Library (mtb-stl) API
+*              used by the self test application. The tests are modeled in
+*              sim_selftest.c.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef SELFTEST_H_
+#define SELFTEST_H_
+
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Return status */
+#define OK_STATUS                       (0u)
+#define ERROR_STATUS                    (1u)
+#define PASS_COMPLETE_STATUS            (2u)
+#define PASS_STILL_TESTING_STATUS       (3u)
+
+/* Stack test error flags */
+#define ERROR_STACK_OVERFLOW            (0x04u)
+#define ERROR_STACK_UNDERFLOW           (0x08u)
+
+/* Flash test */
+#define FLASH_TEST_CRC32                (0u)
+#define FLASH_TEST_FLETCHER64           (1u)
+#define FLASH_TEST_MODE                 (FLASH_TEST_CRC32)
+#define FLASH_END_ADDR                  (CY_FLASH_BASE + 0x4000UL)
+#define FLASH_DOUBLE_WORDS_TO_TEST      (512u)
+
+/* Start-up configuration registers test */
+#define CFG_REGS_TO_FLASH_MODE          (1u)
+#define STARTUP_CFG_REGS_MODE           (CFG_REGS_TO_FLASH_MODE)
+
+/* WDT ignore bits of the clock test */
+#define IGNORE_BITS                     (0u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Checksum calculated by the last SelfTest_FlashCheckSum() pass */
+extern uint32_t flash_CheckSum;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t SelfTest_PC(void);
+uint8_t SelfTest_CPU_Registers(void);
+uint8_t SelfTest_PROGRAM_FLOW(void);
+uint8_t SelfTest_IO(void);
+uint8_t SelfTest_IO_GetPortError(void);
+uint8_t SelfTest_IO_GetPinError(void);
+uint8_t SelfTest_WDT(void);
+uint8_t SelfTest_IPC(void);
+uint8_t SelfTest_FPU_Registers(void);
+
+uint8_t SelfTest_Clock(TCPWM_Type *base, uint32_t cntNum);
+void SelfTest_Clock_ISR_TIMER(void);
+uint8_t SelfTest_Interrupt(TCPWM_Type *base, uint32_t cntNum);
+void SelfTest_Interrupt_ISR_TIMER(void);
+
+void SelfTests_Init_March_SRAM_Test(uint8_t shift);
+uint8_t SelfTests_SRAM_March(void);
+void SelfTests_Init_March_Stack_Test(uint8_t shift);
+uint8_t SelfTests_Stack_March(void);
+void SelfTests_Init_Stack_Test(uint8_t block_size);
+uint8_t SelfTests_Stack_Check(void);
+
+void SelfTest_Flash_init(uint32_t startAddr, uint32_t endAddr, uint32_t flashChecksum);
+uint8_t SelfTest_FlashCheckSum(uint32_t doubleWordsToTest);
+
+void SelfTests_Init_StartUp_ConfigReg(void);
+uint32_t SelfTests_Save_StartUp_ConfigReg(void);
+uint8_t SelfTests_StartUp_ConfigReg(void);
+
+uint8_t SelfTest_DMAC(DMAC_Type *base, uint32_t channel,
+                      cy_stc_dmac_descriptor_t *descriptor0,
+                      cy_stc_dmac_descriptor_t *descriptor1,
+                      const cy_stc_dmac_descriptor_config_t *descriptor0Config,
+                      const cy_stc_dmac_descriptor_config_t *descriptor1Config,
+                      const cy_stc_dmac_channel_config_t *channelConfig,
+                      uint32_t trigLine);
+uint8_t SelfTest_DMA_DW(DW_Type *base, uint32_t channel,
+                        cy_stc_dma_descriptor_t *descriptor0,
+                        cy_stc_dma_descriptor_t *descriptor1,
+                        const cy_stc_dma_descriptor_config_t *descriptor0Config,
+                        const cy_stc_dma_descriptor_config_t *descriptor1Config,
+                        const cy_stc_dma_channel_config_t *channelConfig,
+                        uint32_t trigLine);
+
+#endif /* SELFTEST_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,289 @@
+/******************************************************************************
+* File Name:   cy_pdl.h
+*
+* Description: Simulated subset of the peripheral driver library (PDL) and CMSIS
+*              core functions used by the self test application. Part of the host
+*              native build, see host/Makefile.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef CY_PDL_H_
+#define CY_PDL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/*******************************************************************************
+* Simulation control used by the macros below (sim_run.c)
+*******************************************************************************/
+void Sim_Assert(const char *file, int line);
+void Sim_Idle(void);
+void Sim_App_Start(void);
+
+/*******************************************************************************
+* Result and assert
+*******************************************************************************/
+typedef uint32_t cy_rslt_t;
+#define CY_RSLT_SUCCESS                 ((cy_rslt_t)0x00000000U)
+
+#define CY_ASSERT(x)                    do { if (!(x)) { Sim_Assert(__FILE__, __LINE__); } } while (0)
+
+/* Not re-initialized by a simulated reset, like the .noinit section of the
+ * target linker scripts */
+#define CY_NOINIT                       __attribute__((section(".noinit")))
+
+/*******************************************************************************
+* CMSIS core
+*******************************************************************************/
+typedef int32_t IRQn_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+    volatile uint32_t LAR;
+} DWT_Type;
+
+extern CoreDebug_Type sim_core_debug;
+extern DWT_Type sim_dwt;
+
+#define CoreDebug                       (&sim_core_debug)
+#define DWT                             (&sim_dwt)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24U)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+
+/* CPU clock, SIM_CPU_HZ */
+extern uint32_t SystemCoreClock;
+
+void __enable_irq(void);
+void __disable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void __NOP(void);
+void NVIC_EnableIRQ(IRQn_Type irqn);
+void NVIC_DisableIRQ(IRQn_Type irqn);
+uint32_t SCB_GetFPUType(void);
+void Cy_SystemInitFpuEnable(void);
+
+/*******************************************************************************
+* SysLib
+*******************************************************************************/
+#define CY_SYSLIB_RESET_HWWDT           (0x0001U)
+#define CY_SYSLIB_RESET_SOFT            (0x0010U)
+
+void Cy_SysLib_Delay(uint32_t milliseconds);
+void Cy_SysLib_DelayUs(uint16_t microseconds);
+uint32_t Cy_SysLib_GetResetReason(void);
+void Cy_SysLib_ClearResetReason(void);
+uint32_t Cy_SysLib_EnterCriticalSection(void);
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus);
+
+/*******************************************************************************
+* SysInt
+*******************************************************************************/
+typedef enum
+{
+    CY_SYSINT_SUCCESS   = 0x0UL,
+    CY_SYSINT_BAD_PARAM = 0x1UL
+} cy_en_sysint_status_t;
+
+typedef struct
+{
+    IRQn_Type intrSrc;
+    uint32_t intrPriority;
+} cy_stc_sysint_t;
+
+typedef void (*cy_israddress)(void);
+
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr);
+
+/*******************************************************************************
+* WDT
+*******************************************************************************/
+void Cy_WDT_Enable(void);
+void Cy_WDT_Disable(void);
+bool Cy_WDT_IsEnabled(void);
+void Cy_WDT_Lock(void);
+void Cy_WDT_Unlock(void);
+bool Cy_WDT_Locked(void);
+void Cy_WDT_SetMatch(uint32_t match);
+uint32_t Cy_WDT_GetMatch(void);
+uint32_t Cy_WDT_GetCount(void);
+void Cy_WDT_SetIgnoreBits(uint32_t bitsNum);
+uint32_t Cy_WDT_GetIgnoreBits(void);
+void Cy_WDT_ClearInterrupt(void);
+void Cy_WDT_ClearWatchdog(void);
+
+/*******************************************************************************
+* TCPWM counter
+*******************************************************************************/
+typedef enum
+{
+    CY_TCPWM_SUCCESS   = 0x00UL,
+    CY_TCPWM_BAD_PARAM = 0x01UL
+} cy_en_tcpwm_status_t;
+
+#define CY_TCPWM_INT_NONE               (0U)
+#define CY_TCPWM_INT_ON_TC              (1U)
+#define CY_TCPWM_INT_ON_CC              (2U)
+
+/* Counter group, the counter is selected by the counter number */
+typedef struct
+{
+    uint32_t group;
+} TCPWM_Type;
+
+/* Counter configuration, the fields used by the timer model */
+typedef struct
+{
+    uint32_t period;            /* Terminal count */
+    uint32_t clockPrescaler;    /* log2 of the prescaler */
+    uint32_t interruptSources;  /* CY_TCPWM_INT_xx */
+} cy_stc_tcpwm_counter_config_t;
+
+cy_en_tcpwm_status_t Cy_TCPWM_Counter_Init(TCPWM_Type *base, uint32_t cntNum,
+                                           const cy_stc_tcpwm_counter_config_t *config);
+void Cy_TCPWM_Counter_DeInit(TCPWM_Type *base, uint32_t cntNum);
+void Cy_TCPWM_Counter_Enable(TCPWM_Type *base, uint32_t cntNum);
+void Cy_TCPWM_Counter_Disable(TCPWM_Type *base, uint32_t cntNum);
+uint32_t Cy_TCPWM_Counter_GetCounter(TCPWM_Type const *base, uint32_t cntNum);
+void Cy_TCPWM_Counter_SetCounter(TCPWM_Type *base, uint32_t cntNum, uint32_t count);
+uint32_t Cy_TCPWM_Counter_GetPeriod(TCPWM_Type const *base, uint32_t cntNum);
+void Cy_TCPWM_TriggerStart_Single(TCPWM_Type *base, uint32_t cntNum);
+void Cy_TCPWM_TriggerStopOrKill_Single(TCPWM_Type *base, uint32_t cntNum);
+void Cy_TCPWM_SetInterruptMask(TCPWM_Type *base, uint32_t cntNum, uint32_t source);
+uint32_t Cy_TCPWM_GetInterruptStatus(TCPWM_Type const *base, uint32_t cntNum);
+void Cy_TCPWM_ClearInterrupt(TCPWM_Type *base, uint32_t cntNum, uint32_t source);
+
+/*******************************************************************************
+* Flash
+*******************************************************************************/
+#define CY_FLASH_BASE                   (0x10000000UL)
+#define CY_FLASH_DRV_SUCCESS            (0x00UL)
+
+/*******************************************************************************
+* DMA (DataWire) and DMAC, the types passed to the DMA self tests
+*******************************************************************************/
+typedef struct
+{
+    uint32_t instance;
+} DW_Type;
+
+typedef struct
+{
+    uint32_t ctl;
+    uint32_t src;
+    uint32_t dst;
+    uint32_t xCtl;
+    uint32_t yCtl;
+    uint32_t nextPtr;
+} cy_stc_dma_descriptor_t;
+
+typedef struct
+{
+    uint32_t dataSize;
+    void *srcAddress;
+    void *dstAddress;
+    int32_t srcXincrement;
+    int32_t dstXincrement;
+    uint32_t xCount;
+    cy_stc_dma_descriptor_t *nextDescriptor;
+} cy_stc_dma_descriptor_config_t;
+
+typedef struct
+{
+    cy_stc_dma_descriptor_t *descriptor;
+    uint32_t priority;
+    bool enable;
+} cy_stc_dma_channel_config_t;
+
+typedef struct
+{
+    uint32_t instance;
+} DMAC_Type;
+
+typedef struct
+{
+    uint32_t ctl;
+    uint32_t src;
+    uint32_t dst;
+    uint32_t xSize;
+    uint32_t xIncr;
+    uint32_t ySize;
+    uint32_t yIncr;
+    uint32_t nextPtr;
+} cy_stc_dmac_descriptor_t;
+
+typedef struct
+{
+    uint32_t dataSize;
+    void *srcAddress;
+    void *dstAddress;
+    int32_t srcXincrement;
+    int32_t dstXincrement;
+    uint32_t xCount;
+    cy_stc_dmac_descriptor_t *nextDescriptor;
+} cy_stc_dmac_descriptor_config_t;
+
+typedef struct
+{
+    cy_stc_dmac_descriptor_t *descriptor;
+    uint32_t priority;
+    bool enable;
+} cy_stc_dmac_channel_config_t;
+
+/*******************************************************************************
+* Trigger multiplexer
+*******************************************************************************/
+#define TRIG_OUT_MUX_0_PDMA0_TR_IN0     (0x40000100UL)
+#define TRIG_OUT_MUX_6_MDMA_TR_IN0      (0x40000600UL)
+
+#endif /* CY_PDL_H_ */
+
+
+/* [] END OF FILE */
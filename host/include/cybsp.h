@@ -0,0 +1,106 @@
+/******************************************************************************
+* File Name:   cybsp.h
+*
+* Description: Simulated board support package of the host native build. The
+*              resources are the ones of the device configuration used by the self
+*              tests, defined in sim_cycfg.c.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef CYBSP_H_
+#define CYBSP_H_
+
+#include "cy_pdl.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Debug UART pins */
+#define CYBSP_DEBUG_UART_TX             (0x0500U)
+#define CYBSP_DEBUG_UART_RX             (0x0501U)
+#define CYBSP_DEBUG_UART_CTS            (0x0502U)
+#define CYBSP_DEBUG_UART_RTS            (0x0503U)
+
+/* Counters of the clock and interrupt tests */
+#define CYBSP_CLOCK_TEST_TIMER_HW       (&sim_tcpwm0)
+#define CYBSP_CLOCK_TEST_TIMER_NUM      (0UL)
+#define CYBSP_CLOCK_TEST_TIMER_IRQ      (90)
+#define CYBSP_TIMER_HW                  (&sim_tcpwm0)
+#define CYBSP_TIMER_NUM                 (1UL)
+#define CYBSP_TIMER_IRQ                 (91)
+
+/* DataWire and DMAC channels of the DMA tests */
+#define DMA_DW_HW                       (&sim_dw0)
+#define DMA_DW_CHANNEL                  (0UL)
+#define DMAC_0_HW                       (&sim_dmac0)
+#define DMAC_0_CHANNEL                  (0UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern TCPWM_Type sim_tcpwm0;
+extern DW_Type sim_dw0;
+extern DMAC_Type sim_dmac0;
+
+extern const cy_stc_tcpwm_counter_config_t CYBSP_CLOCK_TEST_TIMER_config;
+extern const cy_stc_tcpwm_counter_config_t CYBSP_TIMER_config;
+
+extern cy_stc_dma_descriptor_t DMA_DW_Descriptor_0;
+extern cy_stc_dma_descriptor_t DMA_DW_Descriptor_1;
+extern const cy_stc_dma_descriptor_config_t DMA_DW_Descriptor_0_config;
+extern const cy_stc_dma_descriptor_config_t DMA_DW_Descriptor_1_config;
+extern const cy_stc_dma_channel_config_t DMA_DW_channelConfig;
+
+extern cy_stc_dmac_descriptor_t DMAC_0_Descriptor_0;
+extern cy_stc_dmac_descriptor_t DMAC_0_Descriptor_1;
+extern const cy_stc_dmac_descriptor_config_t DMAC_0_Descriptor_0_config;
+extern const cy_stc_dmac_descriptor_config_t DMAC_0_Descriptor_1_config;
+extern const cy_stc_dmac_channel_config_t DMAC_0_channelConfig;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+cy_rslt_t cybsp_init(void);
+
+#endif /* CYBSP_H_ */
+
+
+/* [] END OF FILE */
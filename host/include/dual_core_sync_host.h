@@ -0,0 +1,74 @@
+/******************************************************************************
+* File Name:   dual_core_sync_host.h
+*
+* Description: This file maps the memory ordering, time and cache maintenance hooks of
+*              dual_core_sync.c to the host model of host/model/dual_core_model.c.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef DUAL_CORE_SYNC_HOST_H_
+#define DUAL_CORE_SYNC_HOST_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DUAL_CORE_SYNC_FENCE()                  __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define DUAL_CORE_SYNC_TIME()                   Dual_Core_Model_Time()
+#define DUAL_CORE_SYNC_RELAX()                  Dual_Core_Model_Relax()
+#define DUAL_CORE_SYNC_CLEAN(addr, size) \
+    Dual_Core_Model_Clean((const volatile void *)(addr), (uint32_t)(size))
+#define DUAL_CORE_SYNC_INVALIDATE(addr, size) \
+    Dual_Core_Model_Invalidate((const volatile void *)(addr), (uint32_t)(size))
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t Dual_Core_Model_Time(void);
+void Dual_Core_Model_Relax(void);
+void Dual_Core_Model_Clean(const volatile void *addr, uint32_t size);
+void Dual_Core_Model_Invalidate(const volatile void *addr, uint32_t size);
+
+#endif /* DUAL_CORE_SYNC_HOST_H_ */
+
+
+/* [] END OF FILE */
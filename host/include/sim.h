@@ -0,0 +1,200 @@
+/******************************************************************************
+* File Name:   sim.h
+*
+* Description: Control interface of the simulated peripheral layer of the host native
+*              build: virtual clock, interrupt controller, TCPWM and WDT models, memory
+*              model, fault injection and run control.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef SIM_H_
+#define SIM_H_
+
+#include "SelfTest.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* CPU clock (CLK_HF) of the simulated CM4, the unit of the virtual clock */
+#define SIM_CPU_HZ                      (100000000UL)
+#define SIM_CYCLES_PER_MS               (SIM_CPU_HZ / 1000UL)
+#define SIM_CYCLES_PER_US               (SIM_CPU_HZ / 1000000UL)
+
+/* Independent clocks: TCPWM counter clock and ILO (WDT) */
+#define SIM_TCPWM_CLK_HZ                (1000000UL)
+#define SIM_ILO_HZ                      (32768UL)
+
+/* Number of interrupt lines and TCPWM counters of the model */
+#define SIM_IRQ_COUNT                   (128u)
+#define SIM_TCPWM_COUNTERS              (2u)
+#define SIM_TCPWM_IRQ_BASE              (90)
+
+/* Sizes of the memory model, in 32-bit words */
+#define SIM_SRAM_WORDS                  (4096u)
+#define SIM_STACK_WORDS                 (1024u)
+#define SIM_FLASH_WORDS                 ((FLASH_END_ADDR - CY_FLASH_BASE) / 4u)
+#define SIM_CFG_REGS                    (16u)
+
+/* Resets in one run after which the run is aborted as a reset loop */
+#define SIM_MAX_RESETS                  (4u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Regions of the memory model */
+typedef enum
+{
+    SIM_MEM_SRAM,       /* SRAM tested by the SRAM March test */
+    SIM_MEM_STACK,      /* Stack tested by the stack March and stack tests */
+    SIM_MEM_FLASH,      /* Flash tested by the flash checksum test */
+    SIM_MEM_CFG_REGS,   /* Start-up configuration registers */
+    SIM_MEM_COUNT
+} sim_mem_region_t;
+
+/* Injectable faults. The parameter of each fault is described in
+ * sim_fault.c */
+typedef enum
+{
+    SIM_FAULT_PC,
+    SIM_FAULT_CPU_REGS,
+    SIM_FAULT_PROGRAM_FLOW,
+    SIM_FAULT_IO,
+    SIM_FAULT_FPU_REGS,
+    SIM_FAULT_DMAC,
+    SIM_FAULT_DMA_DW,
+    SIM_FAULT_IPC,
+    SIM_FAULT_STARTUP_REGS,
+    SIM_FAULT_WDT_STUCK,
+    SIM_FAULT_CLOCK_DRIFT,
+    SIM_FAULT_IRQ_LOST,
+    SIM_FAULT_SRAM_STUCK,
+    SIM_FAULT_SRAM_COUPLING,
+    SIM_FAULT_STACK_STUCK,
+    SIM_FAULT_FLASH_FLIP,
+    SIM_FAULT_STACK_OVERFLOW,
+    SIM_FAULT_STACK_UNDERFLOW,
+    SIM_FAULT_COUNT
+} sim_fault_t;
+
+/* Events reported to the hook */
+typedef enum
+{
+    SIM_EVENT_TEST_ENTRY,   /* A SelfTest API is entered, value: 0 */
+    SIM_EVENT_TEST_RESULT,  /* A SelfTest API returns, value: status */
+    SIM_EVENT_RESET,        /* The device resets, value: reset reason */
+    SIM_EVENT_IDLE,         /* The application reached its idle loop */
+    SIM_EVENT_APP_START     /* First control cycle of the fast boot profile */
+} sim_event_t;
+
+/* Hook called on every event, e.g. to inject a fault at a given point */
+typedef void (*sim_hook_t)(sim_event_t event, const char *name, uint32_t value, void *context);
+
+/* Result of one simulated power-on run */
+typedef struct
+{
+    uint32_t tests;         /* SelfTest API results */
+    uint32_t errors;        /* Results that reported an error */
+    uint32_t resets;        /* Resets during the run */
+    uint64_t cycles;        /* Virtual CPU cycles from power-on to idle */
+    uint64_t app_cycles;    /* Virtual CPU cycles from power-on to the first
+                             * control cycle, 0 if not reached */
+    bool completed;         /* The application reached its idle loop */
+    bool asserted;          /* The application hit CY_ASSERT */
+} sim_run_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+/* Application entry, main() of source/main.c */
+int App_Main(void);
+
+/* Run control (sim_run.c) */
+void Sim_Run(sim_run_result_t *result);
+void Sim_Reset(uint32_t reason);
+void Sim_Set_Hook(sim_hook_t hook, void *context);
+void Sim_Test_Entry(const char *name);
+uint8_t Sim_Test_Result(const char *name, uint8_t status);
+
+/* Virtual clock (sim_clock.c) */
+uint64_t Sim_Clock_Cycles(void);
+void Sim_Clock_Advance(uint64_t cycles);
+uint64_t Sim_Clock_Ticks(uint64_t *acc, uint32_t hz, uint64_t cycles);
+uint64_t Sim_Clock_Cycles_Until(uint64_t acc, uint32_t hz, uint64_t ticks);
+void Sim_Clock_Reset(void);
+
+/* Core: interrupts, critical sections (sim_core.c) */
+void Sim_Core_Reset(void);
+void Sim_Irq_Raise(IRQn_Type irqn);
+
+/* TCPWM model (sim_tcpwm.c) */
+void Sim_Tcpwm_Reset(void);
+uint64_t Sim_Tcpwm_Cycles_To_Event(void);
+void Sim_Tcpwm_Elapse(uint64_t cycles);
+
+/* WDT model (sim_wdt.c) */
+void Sim_Wdt_Reset(void);
+uint64_t Sim_Wdt_Cycles_To_Event(void);
+void Sim_Wdt_Elapse(uint64_t cycles);
+
+/* Memory model (sim_memory.c) */
+void Sim_Mem_Power_On(void);
+uint32_t Sim_Mem_Words(sim_mem_region_t region);
+uint32_t Sim_Mem_Read(sim_mem_region_t region, uint32_t index);
+void Sim_Mem_Write(sim_mem_region_t region, uint32_t index, uint32_t value);
+uint32_t Sim_Mem_Flash_Checksum(void);
+uint32_t Sim_Crc32(uint32_t crc, uint32_t word);
+
+/* SelfTest models (sim_selftest.c) */
+void Sim_Selftest_Reset(void);
+
+/* Fault injection (sim_fault.c) */
+void Sim_Fault_Inject(sim_fault_t fault, uint32_t param);
+void Sim_Fault_Clear(sim_fault_t fault);
+void Sim_Fault_Clear_All(void);
+bool Sim_Fault_Active(sim_fault_t fault);
+uint32_t Sim_Fault_Param(sim_fault_t fault);
+const char *Sim_Fault_Name(sim_fault_t fault);
+bool Sim_Fault_Parse(const char *name, sim_fault_t *fault);
+
+#endif /* SIM_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,399 @@
+/******************************************************************************
+* File Name:   clock_monitor_model.c
+*
+* Description: This file contains the host model of the clock tree monitor. It
+*              plans the reference windows of a model clock tree with the measurement core
+*              of source/clock_monitor_meas.c, simulates the counters of each window with
+*              clocks off by random deviations, and checks that the clocks within their
+*              tolerance pass and the clocks out of it fail.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "model.h"
+#include "clock_monitor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MODEL_MHZ               (1000000UL)
+
+/* Deviation classes of a trial, in percent of the draws */
+#define MODEL_GOOD_PERCENT      (40u)   /* Within the tolerance, less the resolution */
+#define MODEL_BAD_PERCENT       (40u)   /* Out of the tolerance, plus the resolution */
+#define MODEL_GROSS_PERCENT     (10u)   /* Stopped, halved or doubled */
+
+#define MODEL_USAGE \
+    "usage: clock_monitor_model [-n trials] [-s seed] [-t counters] [-w]\n" \
+    "  -n trials      measurements of the clock tree (default 10000)\n" \
+    "  -s seed        random seed (default 1)\n" \
+    "  -t counters    TCPWM counters per window (default CLOCK_MONITOR_TCPWM_COUNTERS)\n" \
+    "  -w             WCO reference, 20 permille tolerance (default ILO, 100 permille)\n"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Deviation class of a clock in a trial */
+typedef enum
+{
+    MODEL_GOOD,
+    MODEL_BAD,
+    MODEL_GROSS,
+    MODEL_BETWEEN,
+} model_class_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Clock tree of the XMC7200 kit: FLL 100 MHz, PLLs 200 and 100 MHz, the
+ * CLK_HF clocks, and two dividers of the TCPWM peripheral group */
+static const struct
+{
+    const char *name;
+    uint32_t hz;
+    uint8_t unit;
+} model_clocks[] =
+{
+    {"PATH0 FLL",  100u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_CAL},
+    {"PATH1 PLL",  200u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_CAL},
+    {"PATH2 PLL",  100u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_CAL},
+    {"CLK_HF0",    100u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_CAL},
+    {"CLK_HF1",    200u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_CAL},
+    {"CLK_HF2",    200u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_CAL},
+    {"CLK_HF3",     50u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_CAL},
+    {"CLK_HF4",     50u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_CAL},
+    {"CLK_HF5",     50u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_CAL},
+    {"DIV_8[0]",     1u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_TCPWM},
+    {"DIV_8[1]",    10u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_TCPWM},
+    {"DIV_16[2]",   25u * MODEL_MHZ, CLOCK_MONITOR_MEAS_UNIT_TCPWM},
+};
+
+#define MODEL_CLOCK_COUNT       (sizeof(model_clocks) / sizeof(model_clocks[0]))
+
+static clock_monitor_path_t model_paths[MODEL_CLOCK_COUNT];
+
+static clock_monitor_ref_t model_ref =
+{
+    .ref_hz     = CLOCK_MONITOR_REF_HZ,
+    .max_cycles = CLOCK_MONITOR_MAX_WINDOW_CYCLES,
+    .capacity   = {1u, CLOCK_MONITOR_TCPWM_COUNTERS},
+};
+
+/* Options of the command line */
+static uint32_t model_tolerance = CLOCK_MONITOR_TOLERANCE_PERMILLE;
+static uint32_t model_trials = 10000u;
+
+/*****************************************************************************
+* Function Name: Model_Uniform
+******************************************************************************
+* Summary:
+* Returns a random value in [0, 1).
+*
+* Parameters:
+*  void
+*
+* Return:
+*  double: Random value
+*****************************************************************************/
+static double Model_Uniform(void)
+{
+    return (double)Model_Random() / 4294967296.0;
+}
+
+/*****************************************************************************
+* Function Name: Model_Deviation
+******************************************************************************
+* Summary:
+* Draws the relative deviation of a clock from its configured frequency.
+*
+* Parameters:
+*  path:  Path
+*  klass: Returns the class of the deviation
+*
+* Return:
+*  double: Deviation, -1 for a stopped clock
+*****************************************************************************/
+static double Model_Deviation(const clock_monitor_path_t *path, model_class_t *klass)
+{
+    double tolerance = path->tolerance_permille / 1000.0;
+    double resolution = tolerance / CLOCK_MONITOR_MEAS_RESOLUTION;
+    double sign = (0u != (Model_Random() & 1u)) ? 1.0 : -1.0;
+    uint32_t draw = Model_Random() % 100u;
+    static const double gross[] = {-1.0, -0.5, 1.0};
+
+    if (draw < MODEL_GOOD_PERCENT)
+    {
+        *klass = MODEL_GOOD;
+        return sign * Model_Uniform() * (tolerance - resolution);
+    }
+    draw -= MODEL_GOOD_PERCENT;
+    if (draw < MODEL_BAD_PERCENT)
+    {
+        /* Up to four tolerances away */
+        *klass = MODEL_BAD;
+        return sign * (tolerance + resolution + (Model_Uniform() * 3.0 * tolerance));
+    }
+    draw -= MODEL_BAD_PERCENT;
+    if (draw < MODEL_GROSS_PERCENT)
+    {
+        *klass = MODEL_GROSS;
+        return gross[Model_Random() % 3u];
+    }
+    *klass = MODEL_BETWEEN;
+    return sign * (tolerance - resolution + (Model_Uniform() * 2.0 * resolution));
+}
+
+/*****************************************************************************
+* Function Name: Model_Count
+******************************************************************************
+* Summary:
+* Returns the cycles a counter counts in a window. The counter starts at a
+* random phase of the clock; a TCPWM counter started by software runs up to
+* one reference cycle longer than the window. The counter wraps.
+*
+* Parameters:
+*  path:       Path
+*  deviation:  Relative deviation of the clock
+*  ref_cycles: Length of the window
+*
+* Return:
+*  uint32_t: Count
+*****************************************************************************/
+static uint32_t Model_Count(const clock_monitor_path_t *path, double deviation, uint32_t ref_cycles)
+{
+    double cycles = ref_cycles;
+    double count;
+
+    if (CLOCK_MONITOR_MEAS_UNIT_TCPWM == path->unit)
+    {
+        cycles += Model_Uniform();
+    }
+    count = floor((path->expected_hz * (1.0 + deviation) * cycles / model_ref.ref_hz) + Model_Uniform());
+    return (uint32_t)fmod(count, (double)path->counter_max + 1.0);
+}
+
+/*****************************************************************************
+* Function Name: Model_Check_Plan
+******************************************************************************
+* Summary:
+* Prints the windows and checks that every clock is measured once, in a
+* window within its limits, and that no window has more counters of a unit
+* than the reference provides.
+*
+* Parameters:
+*  windows:      Windows
+*  window_count: Number of windows
+*
+* Return:
+*  uint32_t: Number of violations
+*****************************************************************************/
+static uint32_t Model_Check_Plan(const clock_monitor_window_t *windows, uint32_t window_count)
+{
+    uint32_t measured[MODEL_CLOCK_COUNT] = {0u};
+    uint32_t errors = 0u;
+    double total_ms = 0.0;
+
+    for (uint32_t w = 0u; w < window_count; w++)
+    {
+        uint32_t used[CLOCK_MONITOR_MEAS_UNITS] = {0u};
+        double window_ms = 1000.0 * windows[w].ref_cycles / model_ref.ref_hz;
+
+        total_ms += window_ms;
+        printf("  window %2u %5u cycles %6.2f ms:", (unsigned)w, (unsigned)windows[w].ref_cycles,
+               window_ms);
+        for (uint32_t i = 0u; i < windows[w].path_count; i++)
+        {
+            uint32_t p = windows[w].path[i];
+
+            printf(" %s", model_clocks[p].name);
+            measured[p]++;
+            used[model_paths[p].unit]++;
+            if ((windows[w].ref_cycles < Clock_Monitor_Meas_Min_Cycles(&model_paths[p], &model_ref)) ||
+                (windows[w].ref_cycles > Clock_Monitor_Meas_Max_Cycles(&model_paths[p], &model_ref)))
+            {
+                printf(" (OUT OF LIMITS)");
+                errors++;
+            }
+        }
+        printf("\n");
+        for (uint32_t u = 0u; u < CLOCK_MONITOR_MEAS_UNITS; u++)
+        {
+            errors += (used[u] > model_ref.capacity[u]) ? 1u : 0u;
+        }
+    }
+    for (uint32_t p = 0u; p < MODEL_CLOCK_COUNT; p++)
+    {
+        errors += (1u != measured[p]) ? 1u : 0u;
+    }
+    printf("%u clocks in %u windows, %.2f ms per pass of the clock tree: %u plan errors\n",
+           (unsigned)MODEL_CLOCK_COUNT, (unsigned)window_count, total_ms, (unsigned)errors);
+    return errors;
+}
+
+/*****************************************************************************
+* Function Name: Model_Option
+******************************************************************************
+* Summary:
+* Handles an option of the command line.
+*
+* Parameters:
+*  opt: Option
+*  arg: Argument
+*
+* Return:
+*  bool: false when the option is invalid
+*****************************************************************************/
+static bool Model_Option(int opt, const char *arg)
+{
+    switch (opt)
+    {
+        case 'n':
+            model_trials = Model_Arg(arg);
+            break;
+        case 's':
+            Model_Seed(Model_Arg(arg));
+            break;
+        case 't':
+            model_ref.capacity[CLOCK_MONITOR_MEAS_UNIT_TCPWM] = (uint8_t)Model_Arg(arg);
+            break;
+        case 'w':
+            model_ref.ref_hz = 32768u;
+            model_tolerance = 20u;
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+/*****************************************************************************
+* Function Name: main
+******************************************************************************
+* Summary:
+* Plans the windows of the model clock tree, then measures the tree with
+* random deviations: a clock within its tolerance less the resolution must
+* pass, a clock out of its tolerance plus the resolution must fail, and up to
+* the limit of the tolerance the measured deviation must be within the
+* resolution of the true one.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS when every check passed
+*****************************************************************************/
+int main(int argc, char *argv[])
+{
+    clock_monitor_window_t windows[CLOCK_MONITOR_MEAS_MAX_PATHS];
+    uint32_t window_count;
+    uint32_t errors;
+    uint32_t false_alarms = 0u;
+    uint32_t missed = 0u;
+    uint32_t coarse = 0u;
+    uint32_t checked = 0u;
+    double worst_ppm = 0.0;
+    clock_monitor_path_t impossible;
+    bool ok;
+
+    if (!Model_Options(argc, argv, "n:s:t:w", Model_Option, MODEL_USAGE))
+    {
+        return EXIT_FAILURE;
+    }
+
+    for (uint32_t p = 0u; p < MODEL_CLOCK_COUNT; p++)
+    {
+        model_paths[p].expected_hz = model_clocks[p].hz;
+        model_paths[p].tolerance_permille = (uint16_t)model_tolerance;
+        model_paths[p].unit = model_clocks[p].unit;
+        model_paths[p].counter_max = (CLOCK_MONITOR_MEAS_UNIT_TCPWM == model_clocks[p].unit) ?
+                                     CLOCK_MONITOR_TCPWM_COUNTER_MAX : CLOCK_MONITOR_CAL_COUNTER_MAX;
+    }
+
+    printf("reference %u Hz, tolerance %u permille, %u TCPWM counters per window:\n",
+           (unsigned)model_ref.ref_hz, (unsigned)model_tolerance,
+           (unsigned)model_ref.capacity[CLOCK_MONITOR_MEAS_UNIT_TCPWM]);
+    window_count = Clock_Monitor_Meas_Plan(model_paths, MODEL_CLOCK_COUNT, &model_ref, windows,
+                                           CLOCK_MONITOR_MEAS_MAX_PATHS);
+    errors = (0u == window_count) ? 1u : Model_Check_Plan(windows, window_count);
+
+    /* A clock that needs a longer window than the reference allows */
+    impossible = model_paths[0];
+    impossible.tolerance_permille = 1u;
+    errors += (0u != Clock_Monitor_Meas_Plan(&impossible, 1u, &model_ref, windows, 1u)) ? 1u : 0u;
+
+    for (uint32_t trial = 0u; (trial < model_trials) && (0u != window_count); trial++)
+    {
+        for (uint32_t w = 0u; w < window_count; w++)
+        {
+            for (uint32_t i = 0u; i < windows[w].path_count; i++)
+            {
+                const clock_monitor_path_t *path = &model_paths[windows[w].path[i]];
+                model_class_t klass;
+                double deviation = Model_Deviation(path, &klass);
+                uint32_t count = Model_Count(path, deviation, windows[w].ref_cycles);
+                int32_t measured_ppm;
+                bool pass = Clock_Monitor_Meas_Check(path, &model_ref, windows[w].ref_cycles, count,
+                                                     &measured_ppm);
+                double error_ppm = fabs(measured_ppm - (deviation * 1e6));
+
+                checked++;
+                false_alarms += ((MODEL_GOOD == klass) && !pass) ? 1u : 0u;
+                missed += (((MODEL_BAD == klass) || (MODEL_GROSS == klass)) && pass) ? 1u : 0u;
+                /* The resolution holds up to the limit of the tolerance */
+                if ((MODEL_GOOD == klass) || (MODEL_BETWEEN == klass))
+                {
+                    worst_ppm = (error_ppm > worst_ppm) ? error_ppm : worst_ppm;
+                    coarse += (error_ppm > (model_tolerance * 1000.0 / CLOCK_MONITOR_MEAS_RESOLUTION)) ?
+                              1u : 0u;
+                }
+            }
+        }
+    }
+
+    ok = (0u == errors) && (0u == false_alarms) && (0u == missed) && (0u == coarse);
+    printf("%u measurements: %u false alarms, %u missed, worst error %.0f ppm "
+           "(resolution %u ppm): %s\n", (unsigned)checked, (unsigned)false_alarms,
+           (unsigned)missed, worst_ppm, (unsigned)(model_tolerance * 1000u / CLOCK_MONITOR_MEAS_RESOLUTION),
+           ok ? "PASS" : "FAIL");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
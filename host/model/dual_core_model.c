@@ -0,0 +1,456 @@
+/******************************************************************************
+* File Name:   dual_core_model.c
+*
+* Description: This file contains the host model of the dual core synchronization
+*              protocol of source/dual_core_sync.c. Two threads play CM7_0 and CM7_1;
+*              each works on its own copy of the shared record, like a data cache, and
+*              only the cache maintenance hooks move cache lines to and from the shared
+*              memory, word by word in random order. The model checks that every round
+*              completes and that every result reaches the other core.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "model.h"
+#include "dual_core_sync.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MODEL_RECORD_WORDS      (sizeof(dual_core_sync_record_t) / sizeof(uint32_t))
+#define MODEL_LINE_WORDS        (DUAL_CORE_SYNC_LINE_SIZE / sizeof(uint32_t))
+
+/* Barrier timeout of the CM7_0 thread, in microseconds */
+#define MODEL_TIMEOUT_US        (2000000u)
+
+/* Core index of CM7_0 */
+#define MODEL_PRIMARY           (0u)
+
+/* Watchdog of the whole model run, in seconds */
+#define MODEL_WATCHDOG_S        (60u)
+
+#define MODEL_USAGE \
+    "usage: dual_core_model [-n rounds] [-s seed] [-k round]\n" \
+    "  -n rounds  number of rounds (default 20000)\n" \
+    "  -s seed    random seed (default 1)\n" \
+    "  -k round   CM7_1 stops after this round, CM7_0 must time out\n"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t core;
+    uint32_t rng;
+    uint32_t rounds;            /* Rounds completed */
+    uint32_t lost;              /* Results not received or wrong */
+    dual_core_sync_status_t status;
+    uint32_t status_round;      /* Round of the first status other than OK */
+} model_core_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Shared memory and the cached view of each core */
+static uint32_t model_memory[MODEL_RECORD_WORDS];
+static dual_core_sync_record_t model_view[DUAL_CORE_SYNC_CORES]
+    __attribute__((aligned(DUAL_CORE_SYNC_LINE_SIZE)));
+
+static model_core_t model_core[DUAL_CORE_SYNC_CORES];
+static __thread model_core_t *model_self;
+
+static uint32_t model_rounds = 20000u;
+static uint32_t model_seed = 1u;
+static uint32_t model_kill_round;
+static volatile uint32_t model_abort;
+
+/*****************************************************************************
+* Function Name: Model_Core_Random
+******************************************************************************
+* Summary:
+* Random generator of the calling thread.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Random value
+*****************************************************************************/
+static uint32_t Model_Core_Random(void)
+{
+    return Model_Xorshift32(&model_self->rng);
+}
+
+/*****************************************************************************
+* Function Name: Model_Expected
+******************************************************************************
+* Summary:
+* Result a core publishes in a round, known to both threads.
+*
+* Parameters:
+*  core:   Core index
+*  round:  Round number
+*  result: Result
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Expected(uint32_t core, uint32_t round, dual_core_sync_result_t *result)
+{
+    uint32_t h = (round * 0x9E3779B1u) ^ (core * 0x85EBCA6Bu);
+
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    result->round = round;
+    result->failed = h & 0x1Fu;
+    result->cycles = h >> 5;
+}
+
+/*****************************************************************************
+* Function Name: Model_Line_Copy
+******************************************************************************
+* Summary:
+* Copies the cache lines covering [addr, addr + size) of the view of the
+* calling core from or to the shared memory, word by word in random order
+* with random yields, so that the other core can observe a partial copy.
+*
+* Parameters:
+*  addr:  Start address in the view of the calling core
+*  size:  Size in bytes
+*  clean: true: view to shared memory, false: shared memory to view
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Line_Copy(const volatile void *addr, uint32_t size, bool clean)
+{
+    uint32_t *view = (uint32_t *)&model_view[model_self->core];
+    uintptr_t offset = (uintptr_t)addr - (uintptr_t)view;
+    uint32_t first;
+    uint32_t last;
+    uint32_t order[MODEL_LINE_WORDS];
+
+    if ((0u == size) || (offset >= sizeof(dual_core_sync_record_t)) ||
+        ((offset + size) > sizeof(dual_core_sync_record_t)))
+    {
+        fprintf(stderr, "core %u: cache maintenance outside the record\n",
+                (unsigned)model_self->core);
+        abort();
+    }
+
+    first = (uint32_t)(offset / DUAL_CORE_SYNC_LINE_SIZE) * MODEL_LINE_WORDS;
+    last = (uint32_t)((offset + size - 1u) / DUAL_CORE_SYNC_LINE_SIZE + 1u) * MODEL_LINE_WORDS;
+
+    for (uint32_t line = first; line < last; line += MODEL_LINE_WORDS)
+    {
+        for (uint32_t i = 0u; i < MODEL_LINE_WORDS; i++)
+        {
+            order[i] = i;
+        }
+        for (uint32_t i = MODEL_LINE_WORDS - 1u; i > 0u; i--)
+        {
+            uint32_t j = Model_Core_Random() % (i + 1u);
+            uint32_t t = order[i];
+
+            order[i] = order[j];
+            order[j] = t;
+        }
+        for (uint32_t i = 0u; i < MODEL_LINE_WORDS; i++)
+        {
+            uint32_t w = line + order[i];
+
+            if (clean)
+            {
+                __atomic_store_n(&model_memory[w], view[w], __ATOMIC_RELAXED);
+            }
+            else
+            {
+                view[w] = __atomic_load_n(&model_memory[w], __ATOMIC_RELAXED);
+            }
+            if (0u == (Model_Core_Random() & 7u))
+            {
+                (void)sched_yield();
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* dual_core_sync.c hooks (dual_core_sync_host.h)
+*******************************************************************************/
+uint32_t Dual_Core_Model_Time(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * 1000000u) + ((uint64_t)ts.tv_nsec / 1000u));
+}
+
+void Dual_Core_Model_Relax(void)
+{
+    if (0u != model_abort)
+    {
+        pthread_exit(NULL);
+    }
+    /* A dirty line can be written back at any time */
+    if (0u == (Model_Core_Random() & 15u))
+    {
+        Model_Line_Copy(&model_view[model_self->core].slot[model_self->core],
+                        sizeof(dual_core_sync_slot_t), true);
+    }
+    (void)sched_yield();
+}
+
+void Dual_Core_Model_Clean(const volatile void *addr, uint32_t size)
+{
+    Model_Line_Copy(addr, size, true);
+}
+
+void Dual_Core_Model_Invalidate(const volatile void *addr, uint32_t size)
+{
+    Model_Line_Copy(addr, size, false);
+}
+
+/*****************************************************************************
+* Function Name: Model_Core
+******************************************************************************
+* Summary:
+* Thread of one core: the round loop of Dual_Core_Run() on CM7_0, or of
+* Dual_Core_Secondary_Main() on CM7_1, with random local test durations.
+*
+* Parameters:
+*  arg: model_core_t of the core
+*
+* Return:
+*  void *: NULL
+*****************************************************************************/
+static void *Model_Core(void *arg)
+{
+    dual_core_sync_record_t *record;
+    dual_core_sync_result_t own;
+    dual_core_sync_result_t other;
+    dual_core_sync_result_t expected;
+    dual_core_sync_status_t status;
+    uint32_t timeout;
+
+    model_self = arg;
+    record = &model_view[model_self->core];
+    timeout = (MODEL_PRIMARY == model_self->core) ? MODEL_TIMEOUT_US :
+              DUAL_CORE_SYNC_WAIT_FOREVER;
+
+    if (MODEL_PRIMARY != model_self->core)
+    {
+        DUAL_CORE_SYNC_INVALIDATE(record, sizeof(*record));
+    }
+
+    for (uint32_t round = 1u; round <= model_rounds; round++)
+    {
+        if ((MODEL_PRIMARY != model_self->core) && (0u != model_kill_round) &&
+            (round > model_kill_round))
+        {
+            break;
+        }
+
+        status = Dual_Core_Sync_Barrier(record, model_self->core, timeout);
+        if (DUAL_CORE_SYNC_OK == status)
+        {
+            Model_Expected(model_self->core, round, &own);
+            for (uint32_t spin = Model_Core_Random() % 4u; spin > 0u; spin--)
+            {
+                (void)sched_yield();
+            }
+            status = Dual_Core_Sync_Exchange(record, model_self->core, &own, &other, timeout);
+        }
+        if (DUAL_CORE_SYNC_OK != status)
+        {
+            model_self->status = status;
+            model_self->status_round = round;
+            break;
+        }
+
+        Model_Expected(model_self->core ^ 1u, round, &expected);
+        if ((other.round != expected.round) || (other.failed != expected.failed) ||
+            (other.cycles != expected.cycles))
+        {
+            model_self->lost++;
+        }
+        model_self->rounds = round;
+    }
+
+    return NULL;
+}
+
+/*****************************************************************************
+* Function Name: Model_Watchdog
+******************************************************************************
+* Summary:
+* SIGALRM handler: the run did not finish, a core is stuck.
+*
+* Parameters:
+*  sig: Signal
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Watchdog(int sig)
+{
+    static const char msg[] = "dual_core_model: DEADLOCK\n";
+
+    (void)sig;
+    (void)write(STDERR_FILENO, msg, sizeof(msg) - 1u);
+    _exit(EXIT_FAILURE);
+}
+
+/*****************************************************************************
+* Function Name: Model_Option
+******************************************************************************
+* Summary:
+* Handles an option of the command line.
+*
+* Parameters:
+*  opt: Option
+*  arg: Argument
+*
+* Return:
+*  bool: false when the option is invalid
+*****************************************************************************/
+static bool Model_Option(int opt, const char *arg)
+{
+    switch (opt)
+    {
+        case 'n':
+            model_rounds = Model_Arg(arg);
+            break;
+        case 's':
+            model_seed = Model_Arg(arg);
+            break;
+        case 'k':
+            model_kill_round = Model_Arg(arg);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+/*****************************************************************************
+* Function Name: main
+******************************************************************************
+* Summary:
+* Runs the two core threads. Without -k, every round must complete on both
+* cores with the expected results. With -k, CM7_0 must report a timeout at
+* the round after the last round of CM7_1.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS when the protocol behaved as expected
+*****************************************************************************/
+int main(int argc, char *argv[])
+{
+    pthread_t threads[DUAL_CORE_SYNC_CORES];
+    model_core_t *primary = &model_core[MODEL_PRIMARY];
+    uint32_t lost = 0u;
+    bool ok;
+
+    if (!Model_Options(argc, argv, "n:s:k:", Model_Option, MODEL_USAGE))
+    {
+        return EXIT_FAILURE;
+    }
+
+    (void)signal(SIGALRM, Model_Watchdog);
+    (void)alarm(MODEL_WATCHDOG_S);
+
+    for (uint32_t core = 0u; core < DUAL_CORE_SYNC_CORES; core++)
+    {
+        model_core[core].core = core;
+        model_core[core].rng = (model_seed * 2654435761u) ^ (core + 1u) ^ 0xA5A5A5A5u;
+        model_core[core].status = DUAL_CORE_SYNC_OK;
+    }
+
+    /* CM7_0 clears the record before CM7_1 starts */
+    model_self = primary;
+    Dual_Core_Sync_Init(&model_view[MODEL_PRIMARY]);
+
+    for (uint32_t core = 0u; core < DUAL_CORE_SYNC_CORES; core++)
+    {
+        if (0 != pthread_create(&threads[core], NULL, Model_Core, &model_core[core]))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    (void)pthread_join(threads[MODEL_PRIMARY], NULL);
+    /* CM7_1 waits forever, release it when CM7_0 stopped early */
+    model_abort = 1u;
+    (void)pthread_join(threads[MODEL_PRIMARY ^ 1u], NULL);
+
+    for (uint32_t core = 0u; core < DUAL_CORE_SYNC_CORES; core++)
+    {
+        lost += model_core[core].lost;
+    }
+
+    if (0u == model_kill_round)
+    {
+        ok = (model_rounds == primary->rounds) && (DUAL_CORE_SYNC_OK == primary->status);
+    }
+    else
+    {
+        ok = (DUAL_CORE_SYNC_TIMEOUT == primary->status) &&
+             ((model_kill_round + 1u) == primary->status_round);
+    }
+    ok = ok && (0u == lost);
+
+    fprintf(stderr, "rounds %u/%u lost %u status %d at round %u: %s\n",
+            (unsigned)primary->rounds, (unsigned)model_rounds, (unsigned)lost,
+            (int)primary->status, (unsigned)primary->status_round, ok ? "PASS" : "FAIL");
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
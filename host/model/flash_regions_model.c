@@ -0,0 +1,483 @@
+/******************************************************************************
+* File Name:   flash_regions_model.c
+*
+* Description: This file contains the host model of the multi-region flash test. It
+*              builds a flash image of the regions of flash_regions.h, writes it as Intel
+*              HEX for scripts/flash_regions.py, and checks the test of
+*              source/flash_regions.c against the generated checksums: schedule,
+*              deadlines and detection of bit flips.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "self_test.h"
+#include "flash_regions.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Random data at the start and at the end of every region, the rest of the
+ * region is erased flash */
+#define MODEL_HEAD_BYTES        (0x10000u)
+#define MODEL_TAIL_BYTES        (0x100u)
+#define MODEL_ERASED            (0x00u)
+
+/* Bytes per Intel HEX data record */
+#define MODEL_HEX_RECORD        (16u)
+
+#define MODEL_USAGE \
+    "usage: flash_regions_model [-p period_ms] [-s seed] [-w image.hex]\n" \
+    "  -p period_ms   time between two steps (default 1)\n" \
+    "  -s seed        random seed of the bit flips (default 1)\n" \
+    "  -w image.hex   write the image and exit\n"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Regions of the list selected with FLASH_REGIONS_DEVICE */
+static const struct
+{
+    const char *name;
+    uint32_t base;
+    uint32_t size;
+    uint32_t deadline_ms;
+} model_regions[] =
+{
+#define MODEL_REGION(name, base, size, algorithm, words, deadline) \
+    { #name, (base), (size), (deadline) },
+    FLASH_REGION_LIST(MODEL_REGION)
+#undef MODEL_REGION
+};
+
+#define MODEL_REGION_COUNT      (sizeof(model_regions) / sizeof(model_regions[0]))
+
+/* Flash content of each region */
+static uint32_t *model_flash[MODEL_REGION_COUNT];
+
+/* Options of the command line */
+static uint32_t model_period_ms = 1u;
+static uint32_t model_seed = 1u;
+static const char *model_image;
+
+/*****************************************************************************
+* Function Name: Model_Is_Data
+******************************************************************************
+* Summary:
+* Returns whether a word of a region holds image data. The data at the end
+* of the region starts at a HEX record boundary.
+*
+* Parameters:
+*  region: Region index
+*  word:   Word index
+*
+* Return:
+*  bool: true for image data, false for erased flash
+*****************************************************************************/
+static bool Model_Is_Data(uint32_t region, uint32_t word)
+{
+    uint32_t offset = word * 4u;
+    uint32_t tail = (model_regions[region].size - MODEL_TAIL_BYTES) & ~(MODEL_HEX_RECORD - 1u);
+
+    return (offset < MODEL_HEAD_BYTES) || (offset >= tail);
+}
+
+/*****************************************************************************
+* Function Name: Model_Build_Image
+******************************************************************************
+* Summary:
+* Allocates the regions and fills them with random data and erased flash.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Build_Image(void)
+{
+    for (uint32_t region = 0u; region < MODEL_REGION_COUNT; region++)
+    {
+        uint32_t words = model_regions[region].size / 4u;
+
+        model_flash[region] = malloc(model_regions[region].size);
+        if (NULL == model_flash[region])
+        {
+            perror("malloc");
+            exit(EXIT_FAILURE);
+        }
+        for (uint32_t word = 0u; word < words; word++)
+        {
+            model_flash[region][word] = Model_Is_Data(region, word) ? Model_Random() :
+                                        (MODEL_ERASED * 0x01010101UL);
+        }
+    }
+}
+
+/*****************************************************************************
+* Function Name: Model_Hex_Record
+******************************************************************************
+* Summary:
+* Writes an Intel HEX record.
+*
+* Parameters:
+*  file:    Output
+*  address: Low 16 bits of the address
+*  type:    Record type
+*  data:    Data bytes
+*  length:  Number of data bytes
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Hex_Record(FILE *file, uint32_t address, uint8_t type, const uint8_t *data,
+                             uint32_t length)
+{
+    uint8_t sum = (uint8_t)(length + (address >> 8u) + address + type);
+
+    fprintf(file, ":%02X%04X%02X", (unsigned)length, (unsigned)(address & 0xFFFFu), type);
+    for (uint32_t i = 0u; i < length; i++)
+    {
+        fprintf(file, "%02X", data[i]);
+        sum += data[i];
+    }
+    fprintf(file, "%02X\n", (uint8_t)(0u - sum));
+}
+
+/*****************************************************************************
+* Function Name: Model_Write_Hex
+******************************************************************************
+* Summary:
+* Writes the image data of the regions as Intel HEX, without the erased
+* flash.
+*
+* Parameters:
+*  path: Output file
+*
+* Return:
+*  bool: true on success
+*****************************************************************************/
+static bool Model_Write_Hex(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    uint32_t upper = 0xFFFFFFFFUL;
+
+    if (NULL == file)
+    {
+        perror(path);
+        return false;
+    }
+    for (uint32_t region = 0u; region < MODEL_REGION_COUNT; region++)
+    {
+        const uint8_t *bytes = (const uint8_t *)model_flash[region];
+
+        for (uint32_t offset = 0u; offset < model_regions[region].size; offset += MODEL_HEX_RECORD)
+        {
+            uint32_t address = model_regions[region].base + offset;
+            uint32_t length = model_regions[region].size - offset;
+
+            if (!Model_Is_Data(region, offset / 4u))
+            {
+                continue;
+            }
+            if ((address >> 16u) != upper)
+            {
+                uint8_t ext[2] = {(uint8_t)(address >> 24u), (uint8_t)(address >> 16u)};
+
+                upper = address >> 16u;
+                Model_Hex_Record(file, 0u, 4u, ext, sizeof(ext));
+            }
+            Model_Hex_Record(file, address, 0u, &bytes[offset],
+                             (length < MODEL_HEX_RECORD) ? length : MODEL_HEX_RECORD);
+        }
+    }
+    Model_Hex_Record(file, 0u, 1u, NULL, 0u);
+    return 0 == fclose(file);
+}
+
+#if !FLASH_REGIONS_MODEL_WRITER
+/*****************************************************************************
+* Function Name: Flash_Regions_Model_Address
+******************************************************************************
+* Summary:
+* Maps a region address to the model flash, FLASH_REGIONS_ADDRESS() of
+* source/flash_regions.c.
+*
+* Parameters:
+*  addr: Flash address
+*
+* Return:
+*  const uint32_t *: Model flash
+*****************************************************************************/
+const uint32_t *Flash_Regions_Model_Address(uint32_t addr)
+{
+    for (uint32_t region = 0u; region < MODEL_REGION_COUNT; region++)
+    {
+        if ((addr >= model_regions[region].base) &&
+            ((addr - model_regions[region].base) < model_regions[region].size))
+        {
+            return &model_flash[region][(addr - model_regions[region].base) / 4u];
+        }
+    }
+    fprintf(stderr, "address 0x%08X outside of the regions\n", (unsigned)addr);
+    exit(EXIT_FAILURE);
+}
+
+/*****************************************************************************
+* Function Name: Model_Schedule
+******************************************************************************
+* Summary:
+* Runs the test with one step every period_ms and prints the passes and
+* missed deadlines of each region.
+*
+* Parameters:
+*  period_ms:  Time between two steps
+*  horizon_ms: Simulated time
+*  misses:     Returns the number of missed deadlines
+*  short_runs: Returns the number of regions with fewer passes than their
+*              deadline periods in the simulated time, less one
+*
+* Return:
+*  uint32_t: Number of checksum errors
+*****************************************************************************/
+static uint32_t Model_Schedule(uint32_t period_ms, uint32_t horizon_ms, uint32_t *misses,
+                               uint32_t *short_runs)
+{
+    uint32_t errors = 0u;
+
+    Flash_Regions_Init();
+    for (uint32_t now = 0u; now < horizon_ms; now += period_ms)
+    {
+        if (ERROR_STATUS == Flash_Regions_Step(now))
+        {
+            errors++;
+        }
+    }
+
+    *misses = 0u;
+    *short_runs = 0u;
+    for (uint32_t region = 0u; region < MODEL_REGION_COUNT; region++)
+    {
+        uint32_t passes = Flash_Regions_Get_Passes(region);
+        uint32_t expected = horizon_ms / model_regions[region].deadline_ms;
+
+        printf("  %-12s %6u passes (%u deadline periods), %u missed deadlines\n",
+               model_regions[region].name, (unsigned)passes, (unsigned)expected,
+               (unsigned)Flash_Regions_Get_Misses(region));
+        *misses += Flash_Regions_Get_Misses(region);
+        if ((passes + 1u) < expected)
+        {
+            (*short_runs)++;
+        }
+    }
+    return errors;
+}
+
+/*****************************************************************************
+* Function Name: Model_Bit_Flips
+******************************************************************************
+* Summary:
+* Flips a random bit in each region in turn and runs the test until the
+* flip is detected.
+*
+* Parameters:
+*  period_ms: Time between two steps
+*
+* Return:
+*  uint32_t: Number of flips not detected within the deadline of their
+*            region, or reported in another region
+*****************************************************************************/
+static uint32_t Model_Bit_Flips(uint32_t period_ms)
+{
+    uint32_t failures = 0u;
+
+    for (uint32_t region = 0u; region < MODEL_REGION_COUNT; region++)
+    {
+        uint32_t word = Model_Random() % (model_regions[region].size / 4u);
+        uint32_t mask = 1UL << (Model_Random() % 32u);
+        uint32_t now = 0u;
+        uint8_t status = OK_STATUS;
+
+        model_flash[region][word] ^= mask;
+        Flash_Regions_Init();
+        for (; now <= (2u * model_regions[region].deadline_ms); now += period_ms)
+        {
+            status = Flash_Regions_Step(now);
+            if (ERROR_STATUS == status)
+            {
+                break;
+            }
+        }
+        model_flash[region][word] ^= mask;
+
+        printf("  %-12s word 0x%06X bit %2u: ", model_regions[region].name, (unsigned)word,
+               (unsigned)__builtin_ctz(mask));
+        if ((ERROR_STATUS == status) && (region == Flash_Regions_Get_Error_Region()) &&
+            (now <= model_regions[region].deadline_ms))
+        {
+            printf("detected after %u ms\n", (unsigned)now);
+        }
+        else
+        {
+            printf("NOT DETECTED\n");
+            failures++;
+        }
+    }
+    return failures;
+}
+#endif /* !FLASH_REGIONS_MODEL_WRITER */
+
+/*****************************************************************************
+* Function Name: Model_Option
+******************************************************************************
+* Summary:
+* Handles an option of the command line.
+*
+* Parameters:
+*  opt: Option
+*  arg: Argument
+*
+* Return:
+*  bool: false when the option is invalid
+*****************************************************************************/
+static bool Model_Option(int opt, const char *arg)
+{
+    switch (opt)
+    {
+        case 'p':
+            model_period_ms = Model_Arg(arg);
+            return (0u != model_period_ms);
+        case 's':
+            model_seed = Model_Arg(arg);
+            break;
+        case 'w':
+            model_image = arg;
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+/*****************************************************************************
+* Function Name: main
+******************************************************************************
+* Summary:
+* Writes the image, or checks the test against the checksums generated from
+* the image: no error and no missed deadline with the given step period,
+* missed deadlines and no error when overloaded, and every bit flip
+* detected within the deadline of its region.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS when every check passed
+*****************************************************************************/
+int main(int argc, char *argv[])
+{
+    if (!Model_Options(argc, argv, "p:s:w:", Model_Option, MODEL_USAGE))
+    {
+        return EXIT_FAILURE;
+    }
+
+    /* The image does not depend on the options, the checksums generated
+     * from the written image hold for every run */
+    Model_Build_Image();
+    if (NULL != model_image)
+    {
+        return Model_Write_Hex(model_image) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    Model_Seed(model_seed);
+
+#if FLASH_REGIONS_MODEL_WRITER
+    return Model_Usage(MODEL_USAGE);
+#else
+    {
+        uint32_t load = Flash_Regions_Load_Permille(model_period_ms);
+        uint32_t overload_ms = ((2000u * model_period_ms) + load - 1u) / load;
+        uint32_t horizon_ms = 0u;
+        uint32_t misses;
+        uint32_t overload_misses;
+        uint32_t short_runs;
+        uint32_t errors;
+        uint32_t failures;
+        bool ok;
+
+        /* Three periods of the longest deadline */
+        for (uint32_t region = 0u; region < MODEL_REGION_COUNT; region++)
+        {
+            if (model_regions[region].deadline_ms > horizon_ms)
+            {
+                horizon_ms = model_regions[region].deadline_ms;
+            }
+        }
+        horizon_ms *= 3u;
+        printf("one step every %u ms, load %u permille, %u s:\n", (unsigned)model_period_ms,
+               (unsigned)load, (unsigned)(horizon_ms / 1000u));
+        errors = Model_Schedule(model_period_ms, horizon_ms, &misses, &short_runs);
+        if (load > 1000u)
+        {
+            /* Missed deadlines and fewer passes are expected */
+            misses = 0u;
+            short_runs = 0u;
+        }
+
+        /* Twice the steps the regions can take: deadlines are missed, but
+         * no checksum error is reported */
+        printf("overload, one step every %u ms, load %u permille:\n", (unsigned)overload_ms,
+               (unsigned)Flash_Regions_Load_Permille(overload_ms));
+        errors += Model_Schedule(overload_ms, horizon_ms, &overload_misses, &failures);
+
+        printf("bit flips:\n");
+        failures = Model_Bit_Flips(model_period_ms);
+
+        ok = (0u == errors) && (0u == misses) && (0u == short_runs) &&
+             (0u != overload_misses) && (0u == failures);
+        printf("checksum errors %u, missed deadlines %u, overload missed deadlines %u, "
+               "undetected flips %u: %s\n", (unsigned)errors, (unsigned)misses,
+               (unsigned)overload_misses, (unsigned)failures, ok ? "PASS" : "FAIL");
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+#endif
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,434 @@
+/******************************************************************************
+* File Name:   low_power_model.c
+*
+* Description: This file contains the host model of the wake window planner of
+*              source/low_power_plan.c. It runs the planner with the jobs of
+*              source/low_power.h over simulated days, with random job costs and the
+*              cost of the Deep Sleep transitions, and compares it with one wake per
+*              job. The model checks that every job runs within its period and slack,
+*              and that no job costs more than a few window budgets.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "model.h"
+#include "low_power.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Deep Sleep transitions, counted as active time: wake-up to the first
+ * instruction, and the sleep request to Deep Sleep */
+#define MODEL_WAKE_US           (300u)
+#define MODEL_SLEEP_US          (50u)
+
+/* Supply current when active and in Deep Sleep, in uA */
+#define MODEL_ACTIVE_UA         (6000u)
+#define MODEL_DEEP_SLEEP_UA     (7u)
+
+/* The cost of a run varies from 3/4 to 5/4 of the nominal cost */
+#define MODEL_COST_JITTER       (4u)
+
+#define MODEL_DAY_MS            (86400000u)
+
+/* A job may cost at most this many window budgets. A longer job takes a
+ * window of its own, always over budget, and keeps the device active */
+#define MODEL_JOB_COST_FACTOR   (2u)
+
+#define MODEL_USAGE \
+    "usage: low_power_model [-d days] [-s seed] [-w window_us] [-p pull_in_ms]\n" \
+    "  -d days        simulated days (default 1)\n" \
+    "  -s seed        random seed (default 1)\n" \
+    "  -w window_us   active time budget of a window (default LOW_POWER_WINDOW_US)\n" \
+    "  -p pull_in_ms  how early a job joins a window (default LOW_POWER_PULL_IN_MS)\n"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Time and energy of a schedule */
+typedef struct
+{
+    uint64_t wakes;
+    uint64_t active_us;
+} model_result_t;
+
+/* Test run by a job */
+typedef struct
+{
+    uint32_t steps;         /* Runs of the job that complete one test */
+    bool restart;           /* The setup of the group of the job starts a new test */
+} model_test_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* The jobs of source/low_power.c */
+static const low_power_job_t model_jobs[] =
+{
+    {LOW_POWER_FLASH_PERIOD_MS, LOW_POWER_FLASH_SLACK_MS, LOW_POWER_FLASH_COST_US, 0u},
+    {LOW_POWER_SRAM_PERIOD_MS,  LOW_POWER_SRAM_SLACK_MS,  LOW_POWER_SRAM_COST_US,  0u},
+    {LOW_POWER_CLOCK_PERIOD_MS, LOW_POWER_CLOCK_SLACK_MS, LOW_POWER_CLOCK_COST_US, 0u},
+};
+
+#define MODEL_JOB_COUNT         (sizeof(model_jobs) / sizeof(model_jobs[0]))
+
+static const char *const model_job_names[MODEL_JOB_COUNT] = {"flash", "sram", "clock"};
+
+/* The flash and SRAM tests advance by one chunk or block per run, every
+ * clock measurement is a complete test */
+static const model_test_t model_tests[MODEL_JOB_COUNT] =
+{
+    {64u, false},
+    {16u, false},
+    {1u,  false},
+};
+
+/* Simulated days, -d */
+static uint32_t model_days = 1u;
+
+static low_power_plan_config_t model_config =
+{
+    .jobs       = model_jobs,
+    .job_count  = MODEL_JOB_COUNT,
+    .setup_us   = {0u},
+    .window_us  = LOW_POWER_WINDOW_US,
+    .pull_in_ms = LOW_POWER_PULL_IN_MS,
+};
+
+/*****************************************************************************
+* Function Name: Model_Cost
+******************************************************************************
+* Summary:
+* Returns the active time of one run of a job.
+*
+* Parameters:
+*  job: Job index
+*
+* Return:
+*  uint32_t: Active time in us
+*****************************************************************************/
+static uint32_t Model_Cost(uint32_t job)
+{
+    uint32_t nominal = model_jobs[job].cost_us;
+    uint32_t jitter = nominal / MODEL_COST_JITTER;
+
+    return nominal - jitter + (Model_Random() % ((2u * jitter) + 1u));
+}
+
+/*****************************************************************************
+* Function Name: Model_Charge_Per_Day
+******************************************************************************
+* Summary:
+* Returns the charge drawn per day by a schedule.
+*
+* Parameters:
+*  result:     Schedule
+*  elapsed_ms: Simulated time
+*
+* Return:
+*  double: Charge in mAh per day
+*****************************************************************************/
+static double Model_Charge_Per_Day(const model_result_t *result, uint64_t elapsed_ms)
+{
+    double active_s = (double)result->active_us / 1e6;
+    double sleep_s = ((double)elapsed_ms / 1e3) - active_s;
+    double days = (double)elapsed_ms / MODEL_DAY_MS;
+
+    return ((active_s * MODEL_ACTIVE_UA) + (sleep_s * MODEL_DEEP_SLEEP_UA)) / 3.6e6 / days;
+}
+
+/*****************************************************************************
+* Function Name: Model_Planned
+******************************************************************************
+* Summary:
+* Runs the planner. A window starts at the wake time returned by the
+* planner and lasts its active time. Checks the time between two runs of
+* every job, and that the runs of every job complete its tests.
+*
+* Parameters:
+*  horizon_ms: Simulated time
+*  result:     Returns the wakes and the active time
+*  plan:       Returns the planner state
+*  incomplete: Returns the number of jobs that lost test progress or
+*              completed no test
+*
+* Return:
+*  uint32_t: Number of runs later than period + slack + one window
+*****************************************************************************/
+static uint32_t Model_Planned(uint32_t horizon_ms, model_result_t *result, low_power_plan_t *plan,
+                              uint32_t *incomplete)
+{
+    uint32_t last_run[MODEL_JOB_COUNT] = {0u};
+    uint32_t max_gap[MODEL_JOB_COUNT] = {0u};
+    uint32_t runs[MODEL_JOB_COUNT] = {0u};
+    uint32_t progress[MODEL_JOB_COUNT] = {0u};
+    uint32_t tests[MODEL_JOB_COUNT] = {0u};
+    uint8_t order[LOW_POWER_PLAN_MAX_JOBS];
+    uint32_t window_ms = 0u;
+    uint32_t late = 0u;
+    uint32_t now = 0u;
+
+    Low_Power_Plan_Init(plan, &model_config, now);
+    result->wakes = 0u;
+    result->active_us = 0u;
+
+    for (;;)
+    {
+        uint32_t active_us = MODEL_WAKE_US + MODEL_SLEEP_US;
+        uint8_t group = LOW_POWER_PLAN_NO_GROUP;
+        uint32_t count;
+
+        now = Low_Power_Plan_Next_Wake(plan, now);
+        if (now >= horizon_ms)
+        {
+            break;
+        }
+        count = Low_Power_Plan_Window(plan, now, order);
+        for (uint32_t i = 0u; i < count; i++)
+        {
+            uint32_t job = order[i];
+            uint32_t cost = Model_Cost(job);
+            uint32_t gap = now - last_run[job];
+
+            if (model_jobs[job].group != group)
+            {
+                group = model_jobs[job].group;
+                active_us += model_config.setup_us[group];
+                for (uint32_t other = 0u; other < MODEL_JOB_COUNT; other++)
+                {
+                    if ((model_jobs[other].group == group) && model_tests[other].restart)
+                    {
+                        progress[other] = 0u;
+                    }
+                }
+            }
+            Low_Power_Plan_Record(plan, job, cost);
+            active_us += cost;
+
+            runs[job]++;
+            if (++progress[job] == model_tests[job].steps)
+            {
+                progress[job] = 0u;
+                tests[job]++;
+            }
+
+            if (gap > (model_jobs[job].period_ms + model_jobs[job].slack_ms + window_ms))
+            {
+                late++;
+            }
+            max_gap[job] = (gap > max_gap[job]) ? gap : max_gap[job];
+            last_run[job] = now;
+        }
+        Low_Power_Plan_End_Window(plan, active_us);
+        result->wakes++;
+        result->active_us += active_us;
+
+        /* The window takes time, the next one cannot start before its end */
+        window_ms = (active_us + 999u) / 1000u;
+        now += window_ms;
+    }
+
+    *incomplete = 0u;
+    for (uint32_t job = 0u; job < MODEL_JOB_COUNT; job++)
+    {
+        if ((0u == tests[job]) || (tests[job] != (runs[job] / model_tests[job].steps)))
+        {
+            (*incomplete)++;
+        }
+        printf("  %-6s max gap %5u ms (period %u + slack %u), %u tests in %u runs\n",
+               model_job_names[job], (unsigned)max_gap[job], (unsigned)model_jobs[job].period_ms,
+               (unsigned)model_jobs[job].slack_ms, (unsigned)tests[job], (unsigned)runs[job]);
+    }
+    return late;
+}
+
+/*****************************************************************************
+* Function Name: Model_Per_Job
+******************************************************************************
+* Summary:
+* Reference schedule: every job wakes the device on its own, once per
+* period, with its setup.
+*
+* Parameters:
+*  horizon_ms: Simulated time
+*  result:     Returns the wakes and the active time
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Per_Job(uint32_t horizon_ms, model_result_t *result)
+{
+    result->wakes = 0u;
+    result->active_us = 0u;
+    for (uint32_t job = 0u; job < MODEL_JOB_COUNT; job++)
+    {
+        for (uint32_t t = model_jobs[job].period_ms; t < horizon_ms; t += model_jobs[job].period_ms)
+        {
+            result->wakes++;
+            result->active_us += MODEL_WAKE_US + MODEL_SLEEP_US +
+                                 model_config.setup_us[model_jobs[job].group] + Model_Cost(job);
+        }
+    }
+}
+
+/*****************************************************************************
+* Function Name: Model_Long_Jobs
+******************************************************************************
+* Summary:
+* Returns the number of jobs whose cost exceeds MODEL_JOB_COST_FACTOR times
+* the window budget.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Number of jobs over MODEL_JOB_COST_FACTOR budgets
+*****************************************************************************/
+static uint32_t Model_Long_Jobs(void)
+{
+    uint32_t count = 0u;
+
+    for (uint32_t job = 0u; job < MODEL_JOB_COUNT; job++)
+    {
+        if (model_jobs[job].cost_us > (MODEL_JOB_COST_FACTOR * model_config.window_us))
+        {
+            printf("  %-6s cost %u us, over %u window budgets\n", model_job_names[job],
+                   (unsigned)model_jobs[job].cost_us, (unsigned)MODEL_JOB_COST_FACTOR);
+            count++;
+        }
+    }
+    return count;
+}
+
+/*****************************************************************************
+* Function Name: Model_Option
+******************************************************************************
+* Summary:
+* Handles an option of the command line.
+*
+* Parameters:
+*  opt: Option
+*  arg: Argument
+*
+* Return:
+*  bool: false when the option is invalid
+*****************************************************************************/
+static bool Model_Option(int opt, const char *arg)
+{
+    switch (opt)
+    {
+        case 'd':
+            /* Times of the planner are 32-bit ms */
+            model_days = Model_Arg(arg);
+            return (0u != model_days) && (model_days <= 24u);
+        case 's':
+            Model_Seed(Model_Arg(arg));
+            break;
+        case 'w':
+            model_config.window_us = Model_Arg(arg);
+            break;
+        case 'p':
+            model_config.pull_in_ms = Model_Arg(arg);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+/*****************************************************************************
+* Function Name: main
+******************************************************************************
+* Summary:
+* Runs the planner and the reference schedule and prints the wakes, the
+* active time and the charge per day of both.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS when no job costs more than MODEL_JOB_COST_FACTOR
+*       window budgets, every job ran in time and completed its tests, the
+*       active time reported by the planner matches the model and the
+*       planner draws less charge than the reference schedule
+*****************************************************************************/
+int main(int argc, char *argv[])
+{
+    static low_power_plan_t plan;
+    model_result_t planned;
+    model_result_t per_job;
+    uint32_t horizon_ms;
+    uint32_t late;
+    uint32_t incomplete;
+    uint32_t long_jobs;
+    uint64_t active_per_day_ms;
+    bool ok;
+
+    if (!Model_Options(argc, argv, "d:s:w:p:", Model_Option, MODEL_USAGE))
+    {
+        return EXIT_FAILURE;
+    }
+    horizon_ms = model_days * MODEL_DAY_MS;
+
+    printf("planner, window %u us, pull-in %u ms:\n", (unsigned)model_config.window_us,
+           (unsigned)model_config.pull_in_ms);
+    long_jobs = Model_Long_Jobs();
+    late = Model_Planned(horizon_ms, &planned, &plan, &incomplete);
+    Model_Per_Job(horizon_ms, &per_job);
+
+    active_per_day_ms = (planned.active_us * MODEL_DAY_MS) / horizon_ms / 1000u;
+    printf("planner: %8.0f wakes/day %8.1f ms active/day %.4f mAh/day, %u windows over budget\n",
+           (double)planned.wakes / model_days, (double)planned.active_us / 1e3 / model_days,
+           Model_Charge_Per_Day(&planned, horizon_ms), (unsigned)plan.overruns);
+    printf("per job: %8.0f wakes/day %8.1f ms active/day %.4f mAh/day\n",
+           (double)per_job.wakes / model_days, (double)per_job.active_us / 1e3 / model_days,
+           Model_Charge_Per_Day(&per_job, horizon_ms));
+
+    ok = (0u == long_jobs) && (0u == late) && (0u == incomplete) &&
+         (active_per_day_ms == Low_Power_Plan_Active_Per_Day_Ms(&plan, horizon_ms)) &&
+         (Model_Charge_Per_Day(&planned, horizon_ms) < Model_Charge_Per_Day(&per_job, horizon_ms));
+    printf("long jobs %u, late runs %u, incomplete tests %u, reported %u ms active/day: %s\n",
+           (unsigned)long_jobs, (unsigned)late, (unsigned)incomplete,
+           (unsigned)Low_Power_Plan_Active_Per_Day_Ms(&plan, horizon_ms), ok ? "PASS" : "FAIL");
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,183 @@
+/******************************************************************************
+* File Name:   model.c
+*
+* Description: This file contains the helpers shared by the host models: the
+*              xorshift32 random generator and the getopt loop that prints the
+*              usage of the model on an invalid option.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "model.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t model_rng = 1u;
+
+/*****************************************************************************
+* Function Name: Model_Xorshift32
+******************************************************************************
+* Summary:
+* xorshift32 generator on a given state, for the models that keep one state
+* per thread.
+*
+* Parameters:
+*  state: Generator state, not 0
+*
+* Return:
+*  uint32_t: Random value
+*****************************************************************************/
+uint32_t Model_Xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/*****************************************************************************
+* Function Name: Model_Random
+******************************************************************************
+* Summary:
+* xorshift32 generator of the model.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Random value
+*****************************************************************************/
+uint32_t Model_Random(void)
+{
+    return Model_Xorshift32(&model_rng);
+}
+
+/*****************************************************************************
+* Function Name: Model_Seed
+******************************************************************************
+* Summary:
+* Seeds the generator of the model. The seed is made odd, so that it is
+* never 0.
+*
+* Parameters:
+*  seed: Seed, from the -s option
+*
+* Return:
+*  void
+*****************************************************************************/
+void Model_Seed(uint32_t seed)
+{
+    model_rng = seed | 1u;
+}
+
+/*****************************************************************************
+* Function Name: Model_Arg
+******************************************************************************
+* Summary:
+* Converts the argument of a numeric option, decimal or 0x hexadecimal.
+*
+* Parameters:
+*  arg: Argument
+*
+* Return:
+*  uint32_t: Value
+*****************************************************************************/
+uint32_t Model_Arg(const char *arg)
+{
+    return (uint32_t)strtoul(arg, NULL, 0);
+}
+
+/*****************************************************************************
+* Function Name: Model_Options
+******************************************************************************
+* Summary:
+* Parses the command line with getopt() and passes every option to the
+* handler of the model. Prints the usage on an unknown option or an option
+* the handler rejects.
+*
+* Parameters:
+*  argc, argv: Command line
+*  options:    Options, as for getopt()
+*  option:     Handler of the model
+*  usage:      Usage of the model
+*
+* Return:
+*  bool: true when every option is valid
+*****************************************************************************/
+bool Model_Options(int argc, char *argv[], const char *options, model_option_t option,
+                   const char *usage)
+{
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, options)))
+    {
+        if (('?' == opt) || !option(opt, optarg))
+        {
+            (void)Model_Usage(usage);
+            return false;
+        }
+    }
+    return true;
+}
+
+/*****************************************************************************
+* Function Name: Model_Usage
+******************************************************************************
+* Summary:
+* Prints the usage of the model.
+*
+* Parameters:
+*  usage: Usage of the model
+*
+* Return:
+*  int: EXIT_FAILURE, returned by main()
+*****************************************************************************/
+int Model_Usage(const char *usage)
+{
+    fputs(usage, stderr);
+    return EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,365 @@
+/******************************************************************************
+* File Name:   mpu_fault_decode_model.c
+*
+* Description: This file contains the host model of the MemManage fault decode. It
+*              runs source/mpu_fault_decode.c on synthetic CFSR, MMFAR and HFSR values:
+*              a table of fixed cases at the guard boundaries, then random register values
+*              checked against the expected classification.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "model.h"
+#include "mpu_fault_decode.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Stack guard at the stack limit and two user guard regions, the last one
+ * at the top of the address space */
+#define MODEL_STACK_GUARD       (0x08000400UL)
+#define MODEL_USER_GUARD        (0x08002000UL)
+#define MODEL_TOP_GUARD         (0xFFFFFFE0UL)
+
+#define MODEL_DACC              (MPU_FAULT_MMFSR_DACCVIOL | MPU_FAULT_MMFSR_MMARVALID)
+#define MODEL_BUSFAULT_BITS     (0x00008200UL)  /* BFARVALID | PRECISERR */
+#define MODEL_USAGEFAULT_BITS   (0x00010000UL)  /* UNDEFINSTR */
+
+#define MODEL_USAGE \
+    "usage: mpu_fault_decode_model [-n trials] [-s seed]\n" \
+    "  -n trials      random register values (default 100000)\n" \
+    "  -s seed        random seed (default 1)\n"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Fixed decode case */
+typedef struct
+{
+    const char *name;
+    uint32_t cfsr;
+    uint32_t mmfar;
+    uint32_t hfsr;
+    uint32_t sp;
+    mpu_fault_type_t type;
+    uint32_t address;           /* MMFAR if valid, sp on stacking, else 0 */
+    bool address_valid;
+    bool on_stacking;
+    bool escalated;
+} model_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const mpu_fault_region_t model_regions[] =
+{
+    {MODEL_STACK_GUARD, 32u},
+    {MODEL_USER_GUARD, 256u},
+    {MODEL_TOP_GUARD, 32u},
+};
+
+#define MODEL_REGION_COUNT      ((uint8_t)(sizeof(model_regions) / sizeof(model_regions[0])))
+
+/* Stack pointer well above the stack guard */
+#define MODEL_SP                (MODEL_STACK_GUARD + 0x400UL)
+
+static const model_case_t model_cases[] =
+{
+    {"no fault",                   0u, 0u, 0u, MODEL_SP, MPU_FAULT_NONE, 0u, false, false, false},
+    {"MMARVALID alone",            MPU_FAULT_MMFSR_MMARVALID, MODEL_STACK_GUARD, 0u, MODEL_SP,
+                                   MPU_FAULT_NONE, MODEL_STACK_GUARD, true, false, false},
+    {"bus fault only",             MODEL_BUSFAULT_BITS, MODEL_STACK_GUARD, 0u, MODEL_SP,
+                                   MPU_FAULT_NONE, 0u, false, false, false},
+    {"escalated, no MemManage",    0u, 0u, MPU_FAULT_HFSR_FORCED, MODEL_SP,
+                                   MPU_FAULT_NONE, 0u, false, false, true},
+    {"read of the stack guard",    MODEL_DACC, MODEL_STACK_GUARD, 0u, MODEL_SP,
+                                   MPU_FAULT_STACK_OVERFLOW, MODEL_STACK_GUARD, true, false, false},
+    {"last byte of stack guard",   MODEL_DACC, MODEL_STACK_GUARD + 31u, 0u, MODEL_SP,
+                                   MPU_FAULT_STACK_OVERFLOW, MODEL_STACK_GUARD + 31u, true, false, false},
+    {"below the stack guard",      MODEL_DACC, MODEL_STACK_GUARD - 1u, 0u, MODEL_SP,
+                                   MPU_FAULT_OTHER, MODEL_STACK_GUARD - 1u, true, false, false},
+    {"above the stack guard",      MODEL_DACC, MODEL_STACK_GUARD + 32u, 0u, MODEL_SP,
+                                   MPU_FAULT_OTHER, MODEL_STACK_GUARD + 32u, true, false, false},
+    {"user guard access",          MODEL_DACC, MODEL_USER_GUARD + 0x80u, 0u, MODEL_SP,
+                                   MPU_FAULT_GUARD_ACCESS, MODEL_USER_GUARD + 0x80u, true, false, false},
+    {"guard at the top of memory", MODEL_DACC, 0xFFFFFFFFUL, 0u, MODEL_SP,
+                                   MPU_FAULT_GUARD_ACCESS, 0xFFFFFFFFUL, true, false, false},
+    {"MMFAR not valid",            MPU_FAULT_MMFSR_DACCVIOL, MODEL_STACK_GUARD, 0u, MODEL_SP,
+                                   MPU_FAULT_OTHER, 0u, false, false, false},
+    {"instruction fetch in guard", MPU_FAULT_MMFSR_IACCVIOL, MODEL_USER_GUARD, 0u, MODEL_SP,
+                                   MPU_FAULT_OTHER, 0u, false, false, false},
+    {"unstacking error",           MPU_FAULT_MMFSR_MUNSTKERR, 0u, 0u, MODEL_SP,
+                                   MPU_FAULT_OTHER, 0u, false, false, false},
+    {"stacking into the guard",    MPU_FAULT_MMFSR_MSTKERR, 0u, 0u, MODEL_STACK_GUARD + 8u,
+                                   MPU_FAULT_STACK_OVERFLOW, MODEL_STACK_GUARD + 8u, false, true, false},
+    {"stacking below the guard",   MPU_FAULT_MMFSR_MSTKERR, 0u, 0u, MODEL_STACK_GUARD - 0x100u,
+                                   MPU_FAULT_STACK_OVERFLOW, MODEL_STACK_GUARD - 0x100u, false, true, false},
+    {"stacking above the guard",   MPU_FAULT_MMFSR_MSTKERR, 0u, 0u, MODEL_STACK_GUARD + 32u,
+                                   MPU_FAULT_OTHER, MODEL_STACK_GUARD + 32u, false, true, false},
+    {"lazy FP stacking in guard",  MPU_FAULT_MMFSR_MLSPERR, 0u, 0u, MODEL_STACK_GUARD + 4u,
+                                   MPU_FAULT_STACK_OVERFLOW, MODEL_STACK_GUARD + 4u, false, true, false},
+    {"escalated stack overflow",   MODEL_DACC, MODEL_STACK_GUARD + 16u, MPU_FAULT_HFSR_FORCED, MODEL_SP,
+                                   MPU_FAULT_STACK_OVERFLOW, MODEL_STACK_GUARD + 16u, true, false, true},
+    {"with a usage fault",         MODEL_DACC | MODEL_USAGEFAULT_BITS, MODEL_STACK_GUARD, 0u, MODEL_SP,
+                                   MPU_FAULT_STACK_OVERFLOW, MODEL_STACK_GUARD, true, false, false},
+};
+
+#define MODEL_CASE_COUNT        (sizeof(model_cases) / sizeof(model_cases[0]))
+
+/* Random register values checked, -n */
+static uint32_t model_trials = 100000u;
+
+/*****************************************************************************
+* Function Name: Model_Match
+******************************************************************************
+* Summary:
+* Compares a decoded fault with the expected one and reports a mismatch.
+*
+* Parameters:
+*  name     - Case name
+*  info     - Decoded fault
+*  expected - Expected fault
+*
+* Return:
+*  true if the decoded fault matches
+*****************************************************************************/
+static bool Model_Match(const char *name, const mpu_fault_info_t *info, const mpu_fault_info_t *expected)
+{
+    bool match = (info->type == expected->type) &&
+                 (info->address_valid == expected->address_valid) &&
+                 (info->address == expected->address) &&
+                 (info->on_stacking == expected->on_stacking) &&
+                 (info->escalated == expected->escalated);
+
+    if (!match)
+    {
+        printf("  %s: type %u address %08X/%u stacking %u escalated %u, expected %u %08X/%u %u %u\n",
+               name, (unsigned)info->type, (unsigned)info->address, (unsigned)info->address_valid,
+               (unsigned)info->on_stacking, (unsigned)info->escalated, (unsigned)expected->type,
+               (unsigned)expected->address, (unsigned)expected->address_valid,
+               (unsigned)expected->on_stacking, (unsigned)expected->escalated);
+    }
+    return match;
+}
+
+/*****************************************************************************
+* Function Name: Model_Near_Guard
+******************************************************************************
+* Summary:
+* Draws an address near the edges of a random guard region, or anywhere.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Address
+*****************************************************************************/
+static uint32_t Model_Near_Guard(void)
+{
+    const mpu_fault_region_t *region = &model_regions[Model_Random() % MODEL_REGION_COUNT];
+    uint32_t offset = (Model_Random() % 96u) - 32u;
+
+    switch (Model_Random() % 3u)
+    {
+        case 0u:
+            return region->base + offset;
+        case 1u:
+            return region->base + region->size + offset;
+        default:
+            return Model_Random();
+    }
+}
+
+/*****************************************************************************
+* Function Name: Model_Expected
+******************************************************************************
+* Summary:
+* Classifies random register values the way the ARMv7-M architecture
+* defines them, as the reference for the decode.
+*
+* Parameters:
+*  cfsr     - CFSR value
+*  mmfar    - MMFAR value
+*  hfsr     - HFSR value
+*  sp       - Stack pointer
+*  expected - Expected fault (output)
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Expected(uint32_t cfsr, uint32_t mmfar, uint32_t hfsr, uint32_t sp,
+                           mpu_fault_info_t *expected)
+{
+    bool dacc = (0u != (cfsr & MPU_FAULT_MMFSR_DACCVIOL));
+    bool fault = (0u != (cfsr & (MPU_FAULT_MMFSR_IACCVIOL | MPU_FAULT_MMFSR_DACCVIOL |
+                                 MPU_FAULT_MMFSR_MUNSTKERR | MPU_FAULT_MMFSR_MSTKERR |
+                                 MPU_FAULT_MMFSR_MLSPERR | (1UL << 2u) | (1UL << 6u))));
+    uint64_t guard_end = (uint64_t)model_regions[0].base + model_regions[0].size;
+
+    expected->address_valid = (0u != (cfsr & MPU_FAULT_MMFSR_MMARVALID));
+    expected->on_stacking = (0u != (cfsr & (MPU_FAULT_MMFSR_MSTKERR | MPU_FAULT_MMFSR_MLSPERR)));
+    /* MMFAR is not valid on a stacking error; the stack pointer shows how
+     * far the stack overflowed */
+    expected->address = expected->address_valid ? mmfar : (expected->on_stacking ? sp : 0u);
+    expected->escalated = (0u != (hfsr & MPU_FAULT_HFSR_FORCED));
+    expected->type = fault ? MPU_FAULT_OTHER : MPU_FAULT_NONE;
+
+    if (fault && expected->on_stacking && (sp < guard_end))
+    {
+        expected->type = MPU_FAULT_STACK_OVERFLOW;
+    }
+    else if (fault && dacc && expected->address_valid)
+    {
+        for (uint8_t i = 0u; i < MODEL_REGION_COUNT; i++)
+        {
+            uint64_t end = (uint64_t)model_regions[i].base + model_regions[i].size;
+
+            if ((mmfar >= model_regions[i].base) && (mmfar < end))
+            {
+                expected->type = (0u == i) ? MPU_FAULT_STACK_OVERFLOW : MPU_FAULT_GUARD_ACCESS;
+                break;
+            }
+        }
+    }
+    else
+    {
+        /* Instruction access or unstacking violation */
+    }
+}
+
+/*****************************************************************************
+* Function Name: Model_Option
+******************************************************************************
+* Summary:
+* Handles an option of the command line.
+*
+* Parameters:
+*  opt: Option
+*  arg: Argument
+*
+* Return:
+*  bool: false when the option is invalid
+*****************************************************************************/
+static bool Model_Option(int opt, const char *arg)
+{
+    switch (opt)
+    {
+        case 'n':
+            model_trials = Model_Arg(arg);
+            break;
+        case 's':
+            Model_Seed(Model_Arg(arg));
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+/*****************************************************************************
+* Function Name: main
+******************************************************************************
+* Summary:
+* Runs the fixed cases, then the random register values, and reports the
+* mismatches.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS when every decode matched
+*****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t case_errors = 0u;
+    uint32_t random_errors = 0u;
+    uint32_t types[MPU_FAULT_OTHER + 1u] = {0u};
+    mpu_fault_info_t info;
+    mpu_fault_info_t expected;
+    bool ok;
+
+    if (!Model_Options(argc, argv, "n:s:", Model_Option, MODEL_USAGE))
+    {
+        return EXIT_FAILURE;
+    }
+
+    for (uint32_t c = 0u; c < MODEL_CASE_COUNT; c++)
+    {
+        const model_case_t *mc = &model_cases[c];
+
+        expected.type = mc->type;
+        expected.address = mc->address;
+        expected.address_valid = mc->address_valid;
+        expected.on_stacking = mc->on_stacking;
+        expected.escalated = mc->escalated;
+        Mpu_Fault_Decode(mc->cfsr, mc->mmfar, mc->hfsr, mc->sp, model_regions, MODEL_REGION_COUNT, &info);
+        case_errors += Model_Match(mc->name, &info, &expected) ? 0u : 1u;
+    }
+
+    /* Without guard regions nothing is a stack overflow */
+    Mpu_Fault_Decode(MODEL_DACC, MODEL_STACK_GUARD, 0u, MODEL_SP, NULL, 0u, &info);
+    case_errors += (MPU_FAULT_OTHER == info.type) ? 0u : 1u;
+    printf("%u fixed cases: %u mismatches\n", (unsigned)(MODEL_CASE_COUNT + 1u), (unsigned)case_errors);
+
+    for (uint32_t trial = 0u; trial < model_trials; trial++)
+    {
+        /* MemManage bits sparse, so every combination occurs, with random
+         * BusFault and UsageFault bits above them */
+        uint32_t cfsr = (Model_Random() & Model_Random() & MPU_FAULT_MMFSR_MASK) |
+                        (Model_Random() & ~MPU_FAULT_MMFSR_MASK);
+        uint32_t mmfar = Model_Near_Guard();
+        uint32_t hfsr = Model_Random() & (MPU_FAULT_HFSR_FORCED | (1UL << 1u));
+        uint32_t sp = (0u == (Model_Random() & 1u)) ? Model_Near_Guard() : MODEL_SP;
+
+        Model_Expected(cfsr, mmfar, hfsr, sp, &expected);
+        Mpu_Fault_Decode(cfsr, mmfar, hfsr, sp, model_regions, MODEL_REGION_COUNT, &info);
+        random_errors += Model_Match("random", &info, &expected) ? 0u : 1u;
+        types[info.type]++;
+    }
+
+    ok = (0u == case_errors) && (0u == random_errors);
+    printf("%u random decodes (%u none, %u stack overflow, %u guard access, %u other): "
+           "%u mismatches: %s\n", (unsigned)model_trials, (unsigned)types[MPU_FAULT_NONE],
+           (unsigned)types[MPU_FAULT_STACK_OVERFLOW], (unsigned)types[MPU_FAULT_GUARD_ACCESS],
+           (unsigned)types[MPU_FAULT_OTHER], (unsigned)random_errors, ok ? "PASS" : "FAIL");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
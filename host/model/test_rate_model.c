@@ -0,0 +1,646 @@
+/******************************************************************************
+* File Name:   test_rate_model.c
+*
+* Description: This file contains the host model of the adaptive test rate
+*              controller. It runs source/test_rate.c with the jobs of the low power mode
+*              on simulated fault histories and checks that the periods stay within their
+*              bounds, shrink only on anomalies, do not oscillate, and recover when the
+*              signals are healthy again.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "low_power.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MODEL_UPDATES_PER_HOUR  (3600000u / LOW_POWER_RATE_UPDATE_MS)
+
+/* Clock tolerance in ppm, and the deviation of a healthy clock */
+#define MODEL_TOLERANCE_PPM     ((int32_t)CLOCK_MONITOR_TOLERANCE_PERMILLE * 1000)
+#define MODEL_CLOCK_OFFSET_PPM  (MODEL_TOLERANCE_PPM / 10)
+#define MODEL_CLOCK_NOISE_PPM   (MODEL_TOLERANCE_PPM / 20)
+
+/* Faults start at this hour */
+#define MODEL_FAULT_HOUR        (12u)
+
+#define MODEL_USAGE \
+    "usage: test_rate_model [-d days] [-s seed] [-f history] [-l]\n" \
+    "  -d days        simulated days (default 2)\n" \
+    "  -s seed        random seed (default 1)\n" \
+    "  -f history     run one fault history (default all)\n" \
+    "  -l             list the fault histories\n"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Simulated device: the signal totals and the true clock deviation */
+typedef struct
+{
+    uint32_t ecc_corrected;
+    uint32_t retries;
+    int32_t clock_ppm;
+} model_device_t;
+
+/* Fault history: the signals of an update, and the check of the history */
+typedef struct
+{
+    const char *name;
+    const char *description;
+    void (*signals)(uint32_t update, model_device_t *device, test_rate_signals_t *signals);
+} model_history_t;
+
+/* Trace of a run */
+typedef struct
+{
+    uint32_t errors;
+    uint32_t fault_update;      /* First update with the fault, UINT32_MAX without */
+    uint32_t first_min[LOW_POWER_PLAN_MAX_JOBS];    /* First update at the minimum after the fault */
+    uint32_t clock_limit;       /* First update with the clock past its tolerance */
+    uint32_t increases_in_fault[LOW_POWER_PLAN_MAX_JOBS];
+    uint64_t load_ppm;          /* Sum over the updates */
+    uint32_t decreases;
+} model_trace_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* The jobs of source/low_power.c, with the clock tree monitor */
+enum {MODEL_FLASH, MODEL_SRAM, MODEL_CLOCK, MODEL_CLOCK_TREE, MODEL_JOB_COUNT};
+
+static const char *const model_job_names[MODEL_JOB_COUNT] = {"flash", "sram", "clock", "clock tree"};
+
+static const uint32_t model_cost_us[MODEL_JOB_COUNT] =
+{
+    LOW_POWER_FLASH_COST_US, LOW_POWER_SRAM_COST_US,
+    LOW_POWER_CLOCK_COST_US, LOW_POWER_CLOCK_TREE_COST_US,
+};
+
+static const test_rate_test_t model_tests[MODEL_JOB_COUNT] =
+{
+    {LOW_POWER_FLASH_PERIOD_MS, LOW_POWER_FLASH_PERIOD_MS * LOW_POWER_RATE_MAX_FACTOR,
+     TEST_RATE_SIGNAL_RETRY},
+    {LOW_POWER_SRAM_PERIOD_MS, LOW_POWER_SRAM_PERIOD_MS * LOW_POWER_RATE_MAX_FACTOR,
+     TEST_RATE_SIGNAL_ECC | TEST_RATE_SIGNAL_RETRY},
+    {LOW_POWER_CLOCK_PERIOD_MS, LOW_POWER_CLOCK_PERIOD_MS * LOW_POWER_RATE_MAX_FACTOR,
+     TEST_RATE_SIGNAL_CLOCK | TEST_RATE_SIGNAL_IRQ | TEST_RATE_SIGNAL_RETRY},
+    {LOW_POWER_CLOCK_TREE_PERIOD_MS, LOW_POWER_CLOCK_TREE_PERIOD_MS * LOW_POWER_RATE_MAX_FACTOR,
+     TEST_RATE_SIGNAL_CLOCK | TEST_RATE_SIGNAL_RETRY},
+};
+
+static const test_rate_config_t model_config =
+{
+    .tests              = model_tests,
+    .test_count         = MODEL_JOB_COUNT,
+    .hold_updates       = LOW_POWER_RATE_HOLD_UPDATES,
+    .ecc_alarm          = LOW_POWER_RATE_ECC_ALARM,
+    .clock_enter_ppm    = LOW_POWER_RATE_CLOCK_ENTER_PPM,
+    .clock_exit_ppm     = LOW_POWER_RATE_CLOCK_EXIT_PPM,
+    .clock_trend_ppm    = LOW_POWER_RATE_CLOCK_TREND_PPM,
+    .clock_alarm_ppm    = LOW_POWER_RATE_CLOCK_ALARM_PPM,
+    .irq_enter_permille = LOW_POWER_RATE_IRQ_ENTER_PERMILLE,
+    .irq_exit_permille  = LOW_POWER_RATE_IRQ_EXIT_PERMILLE,
+    .irq_alarm_permille = LOW_POWER_RATE_IRQ_ALARM_PERMILLE,
+};
+
+/*****************************************************************************
+* Function Name: Model_Noise
+******************************************************************************
+* Summary:
+* Returns a uniform random value in [-amplitude, amplitude].
+*
+* Parameters:
+*  amplitude: Largest value
+*
+* Return:
+*  int32_t: Random value
+*****************************************************************************/
+static int32_t Model_Noise(int32_t amplitude)
+{
+    return (int32_t)(Model_Random() % ((2u * (uint32_t)amplitude) + 1u)) - amplitude;
+}
+
+/*****************************************************************************
+* Function Name: Model_Healthy
+******************************************************************************
+* Summary:
+* Signals of a healthy device: a clock with a small offset and noise, an
+* interrupt margin of 700 to 900 permille, no ECC errors and no retries.
+*
+* Parameters:
+*  update:  Update index
+*  device:  Simulated device
+*  signals: Returns the signals
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Healthy(uint32_t update, model_device_t *device, test_rate_signals_t *signals)
+{
+    device->clock_ppm = MODEL_CLOCK_OFFSET_PPM + Model_Noise(MODEL_CLOCK_NOISE_PPM);
+    signals->valid = TEST_RATE_SIGNAL_ALL;
+    signals->irq_margin_permille = (uint16_t)(800 + Model_Noise(100));
+}
+
+/*****************************************************************************
+* Function Name: Model_Ecc
+******************************************************************************
+* Summary:
+* Correctable ECC errors about once per two hours, and a burst of
+* LOW_POWER_RATE_ECC_ALARM + 2 errors at the fault hour.
+*
+* Parameters:
+*  update:  Update index
+*  device:  Simulated device
+*  signals: Returns the signals
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Ecc(uint32_t update, model_device_t *device, test_rate_signals_t *signals)
+{
+    Model_Healthy(update, device, signals);
+    if (0u == (Model_Random() % (2u * MODEL_UPDATES_PER_HOUR)))
+    {
+        device->ecc_corrected++;
+    }
+    if (update == (MODEL_FAULT_HOUR * MODEL_UPDATES_PER_HOUR))
+    {
+        device->ecc_corrected += LOW_POWER_RATE_ECC_ALARM + 2u;
+    }
+}
+
+/*****************************************************************************
+* Function Name: Model_Clock_Ramp
+******************************************************************************
+* Summary:
+* Adds a clock drift from the fault hour on, to 6/5 of the tolerance after
+* ramp_updates.
+*
+* Parameters:
+*  update:       Update index
+*  device:       Simulated device
+*  ramp_updates: Length of the ramp
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Clock_Ramp(uint32_t update, model_device_t *device, uint32_t ramp_updates)
+{
+    uint32_t start = MODEL_FAULT_HOUR * MODEL_UPDATES_PER_HOUR;
+
+    if (update >= start)
+    {
+        uint32_t elapsed = ((update - start) < ramp_updates) ? (update - start) : ramp_updates;
+
+        device->clock_ppm += (int32_t)(((int64_t)MODEL_TOLERANCE_PPM * 6 * elapsed) / (5 * (int64_t)ramp_updates));
+    }
+}
+
+/*****************************************************************************
+* Function Name: Model_Clock_Drift
+******************************************************************************
+* Summary:
+* Clock drifting out of its tolerance in six hours.
+*
+* Parameters:
+*  update:  Update index
+*  device:  Simulated device
+*  signals: Returns the signals
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Clock_Drift(uint32_t update, model_device_t *device, test_rate_signals_t *signals)
+{
+    Model_Healthy(update, device, signals);
+    Model_Clock_Ramp(update, device, 6u * MODEL_UPDATES_PER_HOUR);
+}
+
+/*****************************************************************************
+* Function Name: Model_Clock_Runaway
+******************************************************************************
+* Summary:
+* Clock running out of its tolerance in ten minutes.
+*
+* Parameters:
+*  update:  Update index
+*  device:  Simulated device
+*  signals: Returns the signals
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Clock_Runaway(uint32_t update, model_device_t *device, test_rate_signals_t *signals)
+{
+    Model_Healthy(update, device, signals);
+    Model_Clock_Ramp(update, device, MODEL_UPDATES_PER_HOUR / 6u);
+}
+
+/*****************************************************************************
+* Function Name: Model_Irq_Noise
+******************************************************************************
+* Summary:
+* Interrupt margin around its enter threshold for six hours from the fault
+* hour on, then healthy again.
+*
+* Parameters:
+*  update:  Update index
+*  device:  Simulated device
+*  signals: Returns the signals
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Irq_Noise(uint32_t update, model_device_t *device, test_rate_signals_t *signals)
+{
+    Model_Healthy(update, device, signals);
+    if ((update >= (MODEL_FAULT_HOUR * MODEL_UPDATES_PER_HOUR)) &&
+        (update < ((MODEL_FAULT_HOUR + 6u) * MODEL_UPDATES_PER_HOUR)))
+    {
+        signals->irq_margin_permille = (uint16_t)((int32_t)LOW_POWER_RATE_IRQ_ENTER_PERMILLE + Model_Noise(60));
+    }
+}
+
+/*****************************************************************************
+* Function Name: Model_Retry
+******************************************************************************
+* Summary:
+* Two test retries half an hour apart from the fault hour on.
+*
+* Parameters:
+*  update:  Update index
+*  device:  Simulated device
+*  signals: Returns the signals
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Retry(uint32_t update, model_device_t *device, test_rate_signals_t *signals)
+{
+    Model_Healthy(update, device, signals);
+    if ((update == (MODEL_FAULT_HOUR * MODEL_UPDATES_PER_HOUR)) ||
+        (update == ((MODEL_FAULT_HOUR * MODEL_UPDATES_PER_HOUR) + (MODEL_UPDATES_PER_HOUR / 2u))))
+    {
+        device->retries++;
+    }
+}
+
+static const model_history_t model_histories[] =
+{
+    {"healthy",       "no anomaly",                                     Model_Healthy},
+    {"ecc",           "sporadic corrected ECC errors and one burst",    Model_Ecc},
+    {"clock_drift",   "clock out of tolerance in 6 hours",              Model_Clock_Drift},
+    {"clock_runaway", "clock out of tolerance in 10 minutes",           Model_Clock_Runaway},
+    {"irq_noise",     "interrupt margin at its threshold for 6 hours",  Model_Irq_Noise},
+    {"retry",         "two test retries",                               Model_Retry},
+};
+
+#define MODEL_HISTORY_COUNT     (sizeof(model_histories) / sizeof(model_histories[0]))
+
+/* Options of the command line */
+static uint32_t model_days = 2u;
+static const char *model_only;
+static bool model_list;
+
+/*****************************************************************************
+* Function Name: Model_Recovery_Updates
+******************************************************************************
+* Summary:
+* Returns the number of healthy updates that bring a period from its
+* minimum to its maximum.
+*
+* Parameters:
+*  test: Period bounds
+*
+* Return:
+*  uint32_t: Updates
+*****************************************************************************/
+static uint32_t Model_Recovery_Updates(const test_rate_test_t *test)
+{
+    uint32_t period = test->min_period_ms;
+    uint32_t steps = 0u;
+
+    while (period < test->max_period_ms)
+    {
+        period += (period >= TEST_RATE_GROWTH_DIV) ? (period / TEST_RATE_GROWTH_DIV) : 1u;
+        steps++;
+    }
+    return steps * LOW_POWER_RATE_HOLD_UPDATES;
+}
+
+/*****************************************************************************
+* Function Name: Model_Run
+******************************************************************************
+* Summary:
+* Runs the controller on a fault history and checks at every update that
+* the periods are within their bounds and that a period only shrinks when
+* a signal of its test is an anomaly. At the end, a test without an anomaly
+* for its recovery time must be back at its maximum period.
+*
+* Parameters:
+*  history: Fault history
+*  updates: Number of updates
+*  trace:   Returns the trace
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Model_Run(const model_history_t *history, uint32_t updates, model_trace_t *trace)
+{
+    test_rate_t rate;
+    model_device_t device = {0u, 0u, 0};
+    test_rate_signals_t signals = {0u, 0u, 0, 0u, 0u};
+    uint32_t last_anomaly[MODEL_JOB_COUNT];
+    uint32_t fault_end = (MODEL_FAULT_HOUR + 6u) * MODEL_UPDATES_PER_HOUR;
+
+    memset(trace, 0, sizeof(*trace));
+    trace->fault_update = UINT32_MAX;
+    trace->clock_limit = UINT32_MAX;
+    for (uint32_t job = 0u; job < MODEL_JOB_COUNT; job++)
+    {
+        trace->first_min[job] = UINT32_MAX;
+        last_anomaly[job] = 0u;
+    }
+
+    history->signals(0u, &device, &signals);
+    signals.ecc_corrected = device.ecc_corrected;
+    signals.retries = device.retries;
+    signals.clock_deviation_ppm = device.clock_ppm;
+    Test_Rate_Init(&rate, &model_config, &signals);
+
+    for (uint32_t update = 1u; update <= updates; update++)
+    {
+        uint32_t before[MODEL_JOB_COUNT];
+        uint8_t anomalies;
+
+        history->signals(update, &device, &signals);
+        signals.ecc_corrected = device.ecc_corrected;
+        signals.retries = device.retries;
+        signals.clock_deviation_ppm = device.clock_ppm;
+        if ((device.clock_ppm >= MODEL_TOLERANCE_PPM) && (UINT32_MAX == trace->clock_limit))
+        {
+            trace->clock_limit = update;
+        }
+
+        for (uint32_t job = 0u; job < MODEL_JOB_COUNT; job++)
+        {
+            before[job] = Test_Rate_Get_Period(&rate, job);
+        }
+        anomalies = Test_Rate_Update(&rate, &signals);
+        if ((0u != anomalies) && (UINT32_MAX == trace->fault_update) &&
+            (update >= (MODEL_FAULT_HOUR * MODEL_UPDATES_PER_HOUR)))
+        {
+            trace->fault_update = update;
+        }
+
+        for (uint32_t job = 0u; job < MODEL_JOB_COUNT; job++)
+        {
+            uint32_t period = Test_Rate_Get_Period(&rate, job);
+            bool anomaly = (0u != (anomalies & model_tests[job].signals));
+
+            if ((period < model_tests[job].min_period_ms) || (period > model_tests[job].max_period_ms))
+            {
+                printf("  update %u: %s period %u ms out of its bounds\n", (unsigned)update,
+                       model_job_names[job], (unsigned)period);
+                trace->errors++;
+            }
+            if ((period < before[job]) && !anomaly)
+            {
+                printf("  update %u: %s period shrinks without anomaly\n", (unsigned)update,
+                       model_job_names[job]);
+                trace->errors++;
+            }
+            if (anomaly)
+            {
+                last_anomaly[job] = update;
+            }
+            if ((UINT32_MAX != trace->fault_update) && (UINT32_MAX == trace->first_min[job]) &&
+                (period == model_tests[job].min_period_ms))
+            {
+                trace->first_min[job] = update;
+            }
+            if ((UINT32_MAX != trace->fault_update) && (update < fault_end) && (period > before[job]))
+            {
+                trace->increases_in_fault[job]++;
+            }
+        }
+        trace->load_ppm += Test_Rate_Load_Ppm(&rate, model_cost_us);
+    }
+    trace->decreases = rate.decreases;
+
+    for (uint32_t job = 0u; job < MODEL_JOB_COUNT; job++)
+    {
+        if (((updates - last_anomaly[job]) >= Model_Recovery_Updates(&model_tests[job])) &&
+            (Test_Rate_Get_Period(&rate, job) != model_tests[job].max_period_ms))
+        {
+            printf("  %s period %u ms, not back at its maximum\n", model_job_names[job],
+                   (unsigned)Test_Rate_Get_Period(&rate, job));
+            trace->errors++;
+        }
+    }
+}
+
+/*****************************************************************************
+* Function Name: Model_Check
+******************************************************************************
+* Summary:
+* Checks the trace of a fault history against what the history must cause,
+* and prints it.
+*
+* Parameters:
+*  history: Fault history
+*  trace:   Trace of the run
+*  updates: Number of updates
+*
+* Return:
+*  uint32_t: Number of violations, those of the run included
+*****************************************************************************/
+static uint32_t Model_Check(const model_history_t *history, const model_trace_t *trace, uint32_t updates)
+{
+    uint32_t fixed_ppm;
+    uint32_t errors = trace->errors;
+    uint32_t fault = MODEL_FAULT_HOUR * MODEL_UPDATES_PER_HOUR;
+    test_rate_t fixed;
+    test_rate_signals_t none = {0u, 0u, 0, 0u, 0u};
+
+    Test_Rate_Init(&fixed, &model_config, &none);
+    fixed_ppm = Test_Rate_Load_Ppm(&fixed, model_cost_us);
+    printf("%-14s %-48s load %4u ppm (fixed %u ppm)", history->name, history->description,
+           (unsigned)(trace->load_ppm / updates), (unsigned)fixed_ppm);
+
+    if (Model_Healthy == history->signals)
+    {
+        printf(", %u period decreases", (unsigned)trace->decreases);
+        errors += (0u != trace->decreases) ? 1u : 0u;
+    }
+    else if (UINT32_MAX == trace->fault_update)
+    {
+        printf(", fault not seen");
+        errors++;
+    }
+    else if ((Model_Clock_Drift == history->signals) || (Model_Clock_Runaway == history->signals))
+    {
+        /* The clock tests must be at the full rate before the clock leaves
+         * its tolerance */
+        uint32_t at_min = (trace->first_min[MODEL_CLOCK] > trace->first_min[MODEL_CLOCK_TREE]) ?
+                          trace->first_min[MODEL_CLOCK] : trace->first_min[MODEL_CLOCK_TREE];
+
+        if ((UINT32_MAX == at_min) || (at_min >= trace->clock_limit))
+        {
+            printf(", clock tests not at the full rate before the tolerance");
+            errors++;
+        }
+        else
+        {
+            printf(", full rate %u s before the tolerance",
+                   (unsigned)(((trace->clock_limit - at_min) * LOW_POWER_RATE_UPDATE_MS) / 1000u));
+        }
+    }
+    else if (Model_Irq_Noise == history->signals)
+    {
+        /* Hysteresis: the clock test stays at the full rate while the
+         * margin is around its enter threshold */
+        printf(", %u clock period increases", (unsigned)trace->increases_in_fault[MODEL_CLOCK]);
+        errors += (0u != trace->increases_in_fault[MODEL_CLOCK]) ? 1u : 0u;
+    }
+    else
+    {
+        /* An alarm sets the periods of its tests to the minimum at once */
+        uint32_t job = (Model_Ecc == history->signals) ? MODEL_SRAM : MODEL_FLASH;
+
+        printf(", %s at the full rate after %u updates", model_job_names[job],
+               (unsigned)(trace->first_min[job] - fault));
+        errors += (trace->first_min[job] != fault) ? 1u : 0u;
+    }
+    printf(": %s\n", (0u == errors) ? "PASS" : "FAIL");
+    return errors;
+}
+
+/*****************************************************************************
+* Function Name: Model_Option
+******************************************************************************
+* Summary:
+* Handles an option of the command line.
+*
+* Parameters:
+*  opt: Option
+*  arg: Argument
+*
+* Return:
+*  bool: false when the option is invalid
+*****************************************************************************/
+static bool Model_Option(int opt, const char *arg)
+{
+    switch (opt)
+    {
+        case 'd':
+            model_days = Model_Arg(arg);
+            return (model_days >= 1u);
+        case 's':
+            Model_Seed(Model_Arg(arg));
+            break;
+        case 'f':
+            model_only = arg;
+            break;
+        case 'l':
+            model_list = true;
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+/*****************************************************************************
+* Function Name: main
+******************************************************************************
+* Summary:
+* Runs the fault histories and checks the stability of the controller.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS when every history passed
+*****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t errors = 0u;
+    uint32_t runs = 0u;
+    model_trace_t trace;
+
+    if (!Model_Options(argc, argv, "d:s:f:l", Model_Option, MODEL_USAGE))
+    {
+        return EXIT_FAILURE;
+    }
+    if (model_list)
+    {
+        for (uint32_t i = 0u; i < MODEL_HISTORY_COUNT; i++)
+        {
+            printf("%-14s %s\n", model_histories[i].name, model_histories[i].description);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    for (uint32_t i = 0u; i < MODEL_HISTORY_COUNT; i++)
+    {
+        if ((NULL != model_only) && (0 != strcmp(model_only, model_histories[i].name)))
+        {
+            continue;
+        }
+        Model_Run(&model_histories[i], model_days * 24u * MODEL_UPDATES_PER_HOUR, &trace);
+        errors += Model_Check(&model_histories[i], &trace, model_days * 24u * MODEL_UPDATES_PER_HOUR);
+        runs++;
+    }
+    if (0u == runs)
+    {
+        fprintf(stderr, "unknown fault history %s, see -l\n", model_only);
+        return EXIT_FAILURE;
+    }
+    printf("%u fault histories over %u days: %s\n", (unsigned)runs, (unsigned)model_days,
+           (0u == errors) ? "PASS" : "FAIL");
+    return (0u == errors) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
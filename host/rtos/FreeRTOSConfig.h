@@ -0,0 +1,113 @@
+/******************************************************************************
+* File Name:   FreeRTOSConfig.h
+*
+* Description: This file contains the FreeRTOS configuration of the host build of the
+*              FreeRTOS adapter (source/COMPONENT_FREERTOS) on the POSIX port of the kernel,
+*              and maps the run time counter and the exclusive sections of the adapter to
+*              host/rtos/self_test_rtos_host.c.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+#include <assert.h>
+
+/*******************************************************************************
+* Kernel
+*******************************************************************************/
+#define configUSE_PREEMPTION                    1
+#define configUSE_TIME_SLICING                  1
+#define configTICK_RATE_HZ                      ((TickType_t)1000)
+#define configTICK_TYPE_WIDTH_IN_BITS           TICK_TYPE_WIDTH_32_BITS
+#define configMAX_PRIORITIES                    (5)
+#define configMAX_TASK_NAME_LEN                 (16)
+/* In words; the POSIX port runs each task on a thread with this stack */
+#define configMINIMAL_STACK_SIZE                ((unsigned short)4096)
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configSUPPORT_STATIC_ALLOCATION         0
+#define configTOTAL_HEAP_SIZE                   ((size_t)(256 * 1024))
+#define configUSE_TIMERS                        0
+#define configUSE_MUTEXES                       1
+#define configUSE_TICK_HOOK                     0
+#define configUSE_MALLOC_FAILED_HOOK            0
+#define configCHECK_FOR_STACK_OVERFLOW          0
+#define configASSERT(x)                         assert(x)
+
+/* The tests run from the idle hook in the build with
+ * SELF_TEST_RTOS_USE_IDLE_HOOK */
+#if (defined(SELF_TEST_RTOS_USE_IDLE_HOOK) && SELF_TEST_RTOS_USE_IDLE_HOOK)
+#define configUSE_IDLE_HOOK                     1
+#else
+#define configUSE_IDLE_HOOK                     0
+#endif
+
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskDelayUntil                 1
+#define INCLUDE_xTaskGetIdleTaskHandle          1
+#define INCLUDE_vTaskSuspend                    1
+
+/*******************************************************************************
+* Run time stats: host monotonic time in microseconds
+*******************************************************************************/
+#define configGENERATE_RUN_TIME_STATS           1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()        Self_Test_Rtos_Host_Us()
+
+/*******************************************************************************
+* Exclusive steps of the adapter: the critical section of the kernel, which
+* blocks the tick of the POSIX port, and a flag for the preempting task
+*******************************************************************************/
+#define SELF_TEST_RTOS_ENTER_EXCLUSIVE()        Self_Test_Rtos_Host_Enter_Exclusive()
+#define SELF_TEST_RTOS_EXIT_EXCLUSIVE(state)    Self_Test_Rtos_Host_Exit_Exclusive(state)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t Self_Test_Rtos_Host_Us(void);
+uint32_t Self_Test_Rtos_Host_Enter_Exclusive(void);
+void Self_Test_Rtos_Host_Exit_Exclusive(uint32_t state);
+
+#endif /* FREERTOS_CONFIG_H */
+
+
+/* [] END OF FILE */
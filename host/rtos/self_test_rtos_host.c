@@ -0,0 +1,422 @@
+/******************************************************************************
+* File Name:   self_test_rtos_host.c
+*
+* Description: This file contains the host build of the FreeRTOS adapter of the run time
+*              tests on the POSIX port of the kernel. The tests run on the simulated
+*              device of host/sim, a task of higher priority preempts them, and the results
+*              are checked: every test completes in every round, the exclusive steps are
+*              never preempted, the other steps are, and the reported run time excludes
+*              the preempting task.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "self_test_rtos.h"
+#include "sim.h"
+#include "model.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* CPU time of a SelfTest API call, so that the ticks fall into the steps */
+#define HOST_STEP_US                (300u)
+
+/* Task preempting the tests: CPU time it takes in every tick */
+#define HOST_CONTROL_US             (800u)
+#define HOST_CONTROL_PRIORITY       (SELF_TEST_RTOS_TASK_PRIORITY + 2u)
+
+/* Task checking the results */
+#define HOST_CHECK_PRIORITY         (SELF_TEST_RTOS_TASK_PRIORITY + 1u)
+
+/* Bound of the reported run time over the CPU time of the steps. Measured
+ * as elapsed time, the run time would include the preempting task, about
+ * HOST_CONTROL_US per tick */
+#define HOST_RUN_TIME_MAX_RATIO     (2.0)
+
+#define HOST_USAGE \
+    "usage: self_test_rtos_host [-n rounds]\n" \
+    "  -n rounds      rounds of the run time tests (default 20)\n"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static struct
+{
+    uint32_t rounds;
+    volatile bool started;          /* The scheduler runs */
+    volatile bool in_step;          /* A SelfTest API runs */
+    volatile bool exclusive;        /* In an exclusive section of the adapter */
+    volatile uint64_t step_ns;      /* CPU time of the SelfTest API calls */
+    volatile uint32_t exclusive_steps;
+    volatile uint32_t preempted;    /* Steps preempted by the control task */
+    volatile uint32_t preempted_exclusive;
+} host = {.rounds = 20u};
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Host_Us
+******************************************************************************
+* Summary:
+* Run time stats counter: host monotonic time.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Time in microseconds
+*****************************************************************************/
+uint32_t Self_Test_Rtos_Host_Us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * 1000000u) + ((uint64_t)ts.tv_nsec / 1000u));
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Host_Thread_Ns
+******************************************************************************
+* Summary:
+* Returns the CPU time of the calling thread. The POSIX port runs every task
+* on its own thread.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t: CPU time in nanoseconds
+*****************************************************************************/
+static uint64_t Self_Test_Rtos_Host_Thread_Ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Host_Spin
+******************************************************************************
+* Summary:
+* Busy loop for a CPU time of the calling thread.
+*
+* Parameters:
+*  us: CPU time in microseconds
+*
+* Return:
+*  uint64_t: CPU time spent, in nanoseconds
+*****************************************************************************/
+static uint64_t Self_Test_Rtos_Host_Spin(uint32_t us)
+{
+    uint64_t start = Self_Test_Rtos_Host_Thread_Ns();
+    uint64_t now;
+
+    do
+    {
+        now = Self_Test_Rtos_Host_Thread_Ns();
+    } while ((now - start) < ((uint64_t)us * 1000u));
+    return now - start;
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Host_Enter_Exclusive
+******************************************************************************
+* Summary:
+* Starts an exclusive step: the critical section of the kernel masks the
+* tick signal of the POSIX port.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: 0, the state is kept by the kernel
+*****************************************************************************/
+uint32_t Self_Test_Rtos_Host_Enter_Exclusive(void)
+{
+    taskENTER_CRITICAL();
+    host.exclusive = true;
+    return 0u;
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Host_Exit_Exclusive
+******************************************************************************
+* Summary:
+* Ends an exclusive step.
+*
+* Parameters:
+*  state: Unused
+*
+* Return:
+*  void
+*****************************************************************************/
+void Self_Test_Rtos_Host_Exit_Exclusive(uint32_t state)
+{
+    (void)state;
+    host.exclusive = false;
+    taskEXIT_CRITICAL();
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Host_Hook
+******************************************************************************
+* Summary:
+* Event hook of the simulated device: every SelfTest API call takes
+* HOST_STEP_US of CPU time once the scheduler runs.
+*
+* Parameters:
+*  event:   Event
+*  name:    API name
+*  value:   Status of a result
+*  context: Unused
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Self_Test_Rtos_Host_Hook(sim_event_t event, const char *name, uint32_t value, void *context)
+{
+    if (!host.started)
+    {
+        return;
+    }
+    if (SIM_EVENT_TEST_ENTRY == event)
+    {
+        host.in_step = true;
+        host.exclusive_steps += host.exclusive ? 1u : 0u;
+        host.step_ns += Self_Test_Rtos_Host_Spin(HOST_STEP_US);
+    }
+    else if (SIM_EVENT_TEST_RESULT == event)
+    {
+        host.in_step = false;
+    }
+    else
+    {
+        /* Other events are not used */
+    }
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Host_Control_Task
+******************************************************************************
+* Summary:
+* Task of the highest priority, like the control loop of an application:
+* runs at every tick and records the step it has preempted.
+*
+* Parameters:
+*  arg: Unused
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Self_Test_Rtos_Host_Control_Task(void *arg)
+{
+    (void)arg;
+    for (;;)
+    {
+        vTaskDelay(1u);
+        if (host.in_step)
+        {
+            host.preempted++;
+            host.preempted_exclusive += host.exclusive ? 1u : 0u;
+        }
+        (void)Self_Test_Rtos_Host_Spin(HOST_CONTROL_US);
+    }
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Host_Check_Task
+******************************************************************************
+* Summary:
+* Receives the results of host.rounds rounds and checks them. It preempts
+* the tests when a result is posted, so the CPU time of the steps is read
+* at the end of the test of the result. Ends the process.
+*
+* Parameters:
+*  arg: Result queue
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Self_Test_Rtos_Host_Check_Task(void *arg)
+{
+    QueueHandle_t results = (QueueHandle_t)arg;
+    self_test_rtos_result_t result;
+    uint32_t tests = 0u;            /* Tests of a round, counted in round 0 */
+    uint32_t in_round = 0u;
+    uint32_t round = 0u;
+    uint32_t errors = 0u;
+    uint64_t run_time_us = 0u;
+    uint64_t step_ns = 0u;          /* CPU time of the steps of the checked tests */
+    double ratio;
+    bool ok;
+
+    while (round < host.rounds)
+    {
+        if (pdPASS != xQueueReceive(results, &result, portMAX_DELAY))
+        {
+            continue;
+        }
+        if (result.round != round)
+        {
+            errors += ((0u != round) && (in_round != tests)) ? 1u : 0u;
+            tests = (0u == round) ? in_round : tests;
+            round = result.round;
+            in_round = 0u;
+        }
+        if (round < host.rounds)
+        {
+            in_round++;
+            run_time_us += result.run_time;
+            step_ns = host.step_ns;
+            if ((OK_STATUS != result.status) && (PASS_COMPLETE_STATUS != result.status))
+            {
+                printf("  round %lu %s: status %u\n", (unsigned long)result.round, result.name,
+                       (unsigned)result.status);
+                errors++;
+            }
+        }
+    }
+
+    ratio = (double)run_time_us * 1000.0 / (double)step_ns;
+    ok = (0u == errors) && (0u != tests) && (0u != host.exclusive_steps) && (0u != host.preempted) &&
+         (0u == host.preempted_exclusive) && (ratio >= 0.9) && (ratio <= HOST_RUN_TIME_MAX_RATIO);
+    printf("%lu rounds of %lu tests, %lu errors, dropped %lu\n", (unsigned long)host.rounds,
+           (unsigned long)tests, (unsigned long)errors, (unsigned long)Self_Test_Rtos_Get_Dropped());
+    printf("steps preempted %lu, exclusive %lu of %lu\n", (unsigned long)host.preempted,
+           (unsigned long)host.preempted_exclusive, (unsigned long)host.exclusive_steps);
+    printf("run time %lu us for %lu us CPU time of the steps (x%.2f): %s\n",
+           (unsigned long)run_time_us, (unsigned long)(step_ns / 1000u), ratio,
+           ok ? "PASS" : "FAIL");
+    fflush(stdout);
+    exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+#if SELF_TEST_RTOS_USE_IDLE_HOOK
+/*****************************************************************************
+* Function Name: vApplicationIdleHook
+******************************************************************************
+* Summary:
+* Idle hook of the kernel, runs the tests.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void vApplicationIdleHook(void)
+{
+    Self_Test_Rtos_Idle_Hook();
+}
+#endif
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Host_Option
+******************************************************************************
+* Summary:
+* Handles an option of the command line.
+*
+* Parameters:
+*  opt: Option
+*  arg: Argument
+*
+* Return:
+*  bool: false when the option is invalid
+*****************************************************************************/
+static bool Self_Test_Rtos_Host_Option(int opt, const char *arg)
+{
+    if ('n' != opt)
+    {
+        return false;
+    }
+    host.rounds = Model_Arg(arg);
+    return (0u != host.rounds);
+}
+
+/*****************************************************************************
+* Function Name: main
+******************************************************************************
+* Summary:
+* Powers on the simulated device, writes the stack overflow pattern as the
+* boot tests do, starts the run time tests, the control and the check tasks
+* and the scheduler.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: Exit status of the check task, EXIT_FAILURE if the scheduler
+*       does not start
+*****************************************************************************/
+int main(int argc, char *argv[])
+{
+    QueueHandle_t results;
+
+    if (!Model_Options(argc, argv, "n:", Self_Test_Rtos_Host_Option, HOST_USAGE))
+    {
+        return EXIT_FAILURE;
+    }
+
+    Sim_Mem_Power_On();
+    Sim_Core_Reset();
+    Sim_Tcpwm_Reset();
+    Sim_Wdt_Reset();
+    Sim_Selftest_Reset();
+    Sim_Set_Hook(Self_Test_Rtos_Host_Hook, NULL);
+    SelfTests_Init_Stack_Test(PATTERN_BLOCK_SIZE);
+
+    printf("FreeRTOS %s, tests in the %s, period %u ms\n", tskKERNEL_VERSION_NUMBER,
+           SELF_TEST_RTOS_USE_IDLE_HOOK ? "idle hook" : "self test task",
+           (unsigned)SELF_TEST_RTOS_PERIOD_MS);
+    results = xQueueCreate(SELF_TEST_RTOS_QUEUE_LENGTH, sizeof(self_test_rtos_result_t));
+    if ((NULL != results) && (OK_STATUS == Self_Test_Rtos_Start(results)) &&
+        (pdPASS == xTaskCreate(Self_Test_Rtos_Host_Check_Task, "Check", SELF_TEST_RTOS_TASK_STACK_SIZE,
+                               results, HOST_CHECK_PRIORITY, NULL)) &&
+        (pdPASS == xTaskCreate(Self_Test_Rtos_Host_Control_Task, "Control", configMINIMAL_STACK_SIZE,
+                               NULL, HOST_CONTROL_PRIORITY, NULL)))
+    {
+        host.started = true;
+        vTaskStartScheduler();
+    }
+    printf("scheduler not started: FAIL\n");
+    return EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,248 @@
+/******************************************************************************
+* File Name:   sim_clock.c
+*
+* Description: This file contains the virtual clock of the host native build. Time
+*              only advances when a model charges CPU cycles, and the TCPWM and WDT
+*              models are stepped from event to event.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "sim.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Virtual CPU cycles since the process started */
+static uint64_t sim_cycles;
+
+/* Simulated CMSIS debug registers */
+CoreDebug_Type sim_core_debug;
+DWT_Type sim_dwt;
+
+/* Nominal CPU clock, like the CMSIS SystemCoreClock */
+uint32_t SystemCoreClock = SIM_CPU_HZ;
+
+/*****************************************************************************
+* Function Name: Sim_Clock_Hz
+******************************************************************************
+* Summary:
+* Returns the effective CPU clock. SIM_FAULT_CLOCK_DRIFT shifts CLK_HF by a
+* signed percentage against the independent clocks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t: CPU clock in Hz
+*****************************************************************************/
+static uint64_t Sim_Clock_Hz(void)
+{
+    int64_t drift = 0;
+
+    if (Sim_Fault_Active(SIM_FAULT_CLOCK_DRIFT))
+    {
+        drift = (int32_t)Sim_Fault_Param(SIM_FAULT_CLOCK_DRIFT);
+    }
+    return (uint64_t)(((int64_t)SIM_CPU_HZ * (100 + drift)) / 100);
+}
+
+/*****************************************************************************
+* Function Name: Sim_Clock_Ticks
+******************************************************************************
+* Summary:
+* Converts elapsed CPU cycles to ticks of an independent clock. The
+* remainder is kept in the accumulator of the clock, in units of
+* 1 / (CPU clock * clock) seconds.
+*
+* Parameters:
+*  acc:    Accumulator of the clock
+*  hz:     Frequency of the clock
+*  cycles: Elapsed CPU cycles
+*
+* Return:
+*  uint64_t: Elapsed ticks
+*****************************************************************************/
+uint64_t Sim_Clock_Ticks(uint64_t *acc, uint32_t hz, uint64_t cycles)
+{
+    uint64_t cpu_hz = Sim_Clock_Hz();
+    uint64_t ticks;
+
+    *acc += cycles * hz;
+    ticks = *acc / cpu_hz;
+    *acc -= ticks * cpu_hz;
+    return ticks;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Clock_Cycles_Until
+******************************************************************************
+* Summary:
+* Returns the CPU cycles until a clock has advanced by the given ticks.
+*
+* Parameters:
+*  acc:   Accumulator of the clock
+*  hz:    Frequency of the clock
+*  ticks: Ticks to wait for, at least 1
+*
+* Return:
+*  uint64_t: CPU cycles, at least 1
+*****************************************************************************/
+uint64_t Sim_Clock_Cycles_Until(uint64_t acc, uint32_t hz, uint64_t ticks)
+{
+    uint64_t needed = (ticks * Sim_Clock_Hz()) - acc;
+    uint64_t cycles = (needed + hz - 1u) / hz;
+
+    return (0u == cycles) ? 1u : cycles;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Clock_Cycles
+******************************************************************************
+* Summary:
+* Returns the virtual time.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t: CPU cycles since the process started
+*****************************************************************************/
+uint64_t Sim_Clock_Cycles(void)
+{
+    return sim_cycles;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Clock_Advance
+******************************************************************************
+* Summary:
+* Advances the virtual time. The time is split at every TCPWM and WDT event,
+* so interrupts are raised and resets are taken at the exact cycle. A WDT
+* reset does not return.
+*
+* Parameters:
+*  cycles: CPU cycles to advance
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Clock_Advance(uint64_t cycles)
+{
+    while (cycles > 0u)
+    {
+        uint64_t step = cycles;
+        uint64_t next = Sim_Tcpwm_Cycles_To_Event();
+
+        if (next < step)
+        {
+            step = next;
+        }
+        next = Sim_Wdt_Cycles_To_Event();
+        if (next < step)
+        {
+            step = next;
+        }
+
+        sim_cycles += step;
+        cycles -= step;
+        if ((0u != (sim_core_debug.DEMCR & CoreDebug_DEMCR_TRCENA_Msk)) &&
+            (0u != (sim_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk)))
+        {
+            sim_dwt.CYCCNT += (uint32_t)step;
+        }
+
+        Sim_Tcpwm_Elapse(step);
+        Sim_Wdt_Elapse(step);
+    }
+}
+
+/*****************************************************************************
+* Function Name: Sim_Clock_Reset
+******************************************************************************
+* Summary:
+* Resets the debug registers. The virtual time continues across resets.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Clock_Reset(void)
+{
+    sim_core_debug.DEMCR = 0u;
+    sim_dwt.CTRL = 0u;
+    sim_dwt.CYCCNT = 0u;
+    sim_dwt.LAR = 0u;
+}
+
+/*****************************************************************************
+* Function Name: Cy_SysLib_Delay
+******************************************************************************
+* Summary:
+* Busy wait, calibrated to the nominal CPU clock like the PDL delay loop.
+*
+* Parameters:
+*  milliseconds: Delay
+*
+* Return:
+*  void
+*****************************************************************************/
+void Cy_SysLib_Delay(uint32_t milliseconds)
+{
+    Sim_Clock_Advance((uint64_t)milliseconds * SIM_CYCLES_PER_MS);
+}
+
+/*****************************************************************************
+* Function Name: Cy_SysLib_DelayUs
+******************************************************************************
+* Summary:
+* Busy wait, calibrated to the nominal CPU clock.
+*
+* Parameters:
+*  microseconds: Delay
+*
+* Return:
+*  void
+*****************************************************************************/
+void Cy_SysLib_DelayUs(uint16_t microseconds)
+{
+    Sim_Clock_Advance((uint64_t)microseconds * SIM_CYCLES_PER_US);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,238 @@
+/******************************************************************************
+* File Name:   sim_core.c
+*
+* Description: This file contains the core model of the host native build: PRIMASK,
+*              the NVIC with the SysInt vector table, and the FPU presence.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "sim.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static struct
+{
+    uint32_t primask;                       /* 1: interrupts disabled */
+    bool in_handler;                        /* An ISR is running */
+    bool enabled[SIM_IRQ_COUNT];            /* NVIC enable */
+    bool pending[SIM_IRQ_COUNT];            /* NVIC pending */
+    cy_israddress vector[SIM_IRQ_COUNT];    /* Cy_SysInt_Init() handlers */
+} sim_core;
+
+/*****************************************************************************
+* Function Name: Sim_Irq_Dispatch
+******************************************************************************
+* Summary:
+* Runs the handlers of all pending and enabled interrupts, lowest number
+* first, unless interrupts are disabled or a handler is already running.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Sim_Irq_Dispatch(void)
+{
+    uint32_t irqn;
+
+    if ((0u != sim_core.primask) || sim_core.in_handler)
+    {
+        return;
+    }
+    for (irqn = 0u; irqn < SIM_IRQ_COUNT; irqn++)
+    {
+        if (sim_core.pending[irqn] && sim_core.enabled[irqn] && (NULL != sim_core.vector[irqn]))
+        {
+            sim_core.pending[irqn] = false;
+            sim_core.in_handler = true;
+            sim_core.vector[irqn]();
+            sim_core.in_handler = false;
+        }
+    }
+}
+
+/*****************************************************************************
+* Function Name: Sim_Irq_Raise
+******************************************************************************
+* Summary:
+* Sets an interrupt pending and takes it if possible. SIM_FAULT_IRQ_LOST
+* drops the interrupt with the number given as fault parameter, or all
+* interrupts for parameter 0.
+*
+* Parameters:
+*  irqn: Interrupt number
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Irq_Raise(IRQn_Type irqn)
+{
+    if ((irqn < 0) || (irqn >= (IRQn_Type)SIM_IRQ_COUNT))
+    {
+        return;
+    }
+    if (Sim_Fault_Active(SIM_FAULT_IRQ_LOST) &&
+        ((0u == Sim_Fault_Param(SIM_FAULT_IRQ_LOST)) ||
+         ((uint32_t)irqn == Sim_Fault_Param(SIM_FAULT_IRQ_LOST))))
+    {
+        return;
+    }
+    sim_core.pending[irqn] = true;
+    Sim_Irq_Dispatch();
+}
+
+/*****************************************************************************
+* Function Name: Sim_Core_Reset
+******************************************************************************
+* Summary:
+* Resets the core: interrupts disabled, NVIC cleared.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Core_Reset(void)
+{
+    memset(&sim_core, 0, sizeof(sim_core));
+    sim_core.primask = 1u;
+    Sim_Clock_Reset();
+}
+
+/*******************************************************************************
+* CMSIS core, NVIC and SysLib critical section functions
+*******************************************************************************/
+void __enable_irq(void)
+{
+    sim_core.primask = 0u;
+    Sim_Irq_Dispatch();
+}
+
+void __disable_irq(void)
+{
+    sim_core.primask = 1u;
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    return sim_core.primask;
+}
+
+void __set_PRIMASK(uint32_t primask)
+{
+    sim_core.primask = primask & 1u;
+    Sim_Irq_Dispatch();
+}
+
+void __NOP(void)
+{
+    Sim_Clock_Advance(1u);
+}
+
+void NVIC_EnableIRQ(IRQn_Type irqn)
+{
+    if ((irqn >= 0) && (irqn < (IRQn_Type)SIM_IRQ_COUNT))
+    {
+        sim_core.enabled[irqn] = true;
+        Sim_Irq_Dispatch();
+    }
+}
+
+void NVIC_DisableIRQ(IRQn_Type irqn)
+{
+    if ((irqn >= 0) && (irqn < (IRQn_Type)SIM_IRQ_COUNT))
+    {
+        sim_core.enabled[irqn] = false;
+    }
+}
+
+uint32_t Cy_SysLib_EnterCriticalSection(void)
+{
+    uint32_t primask = sim_core.primask;
+
+    sim_core.primask = 1u;
+    return primask;
+}
+
+void Cy_SysLib_ExitCriticalSection(uint32_t savedIntrStatus)
+{
+    __set_PRIMASK(savedIntrStatus);
+}
+
+/*****************************************************************************
+* Function Name: Cy_SysInt_Init
+******************************************************************************
+* Summary:
+* Installs the handler of an interrupt. The priority is not modeled.
+*
+* Parameters:
+*  config:  Interrupt source and priority
+*  userIsr: Handler
+*
+* Return:
+*  cy_en_sysint_status_t: CY_SYSINT_SUCCESS or CY_SYSINT_BAD_PARAM
+*****************************************************************************/
+cy_en_sysint_status_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr)
+{
+    if ((NULL == config) || (NULL == userIsr) ||
+        (config->intrSrc < 0) || (config->intrSrc >= (IRQn_Type)SIM_IRQ_COUNT))
+    {
+        return CY_SYSINT_BAD_PARAM;
+    }
+    sim_core.vector[config->intrSrc] = userIsr;
+    return CY_SYSINT_SUCCESS;
+}
+
+/*******************************************************************************
+* FPU: single precision FPU of the CM4, enabled at reset
+*******************************************************************************/
+uint32_t SCB_GetFPUType(void)
+{
+    return 1u;
+}
+
+void Cy_SystemInitFpuEnable(void)
+{
+}
+
+/* [] END OF FILE */
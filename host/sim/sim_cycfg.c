@@ -0,0 +1,199 @@
+/******************************************************************************
+* File Name:   sim_cycfg.c
+*
+* Description: This file contains the simulated device configuration and board
+*              initialization of the host native build.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdio.h>
+
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Clock test counter: 1 ms period */
+const cy_stc_tcpwm_counter_config_t CYBSP_CLOCK_TEST_TIMER_config =
+{
+    .period = 999UL,
+    .clockPrescaler = 0UL,
+    .interruptSources = CY_TCPWM_INT_ON_TC,
+};
+
+/* Interrupt test counter: 100 us period */
+const cy_stc_tcpwm_counter_config_t CYBSP_TIMER_config =
+{
+    .period = 99UL,
+    .clockPrescaler = 0UL,
+    .interruptSources = CY_TCPWM_INT_ON_TC,
+};
+
+/* Debug UART of retarget-io */
+cyhal_uart_t cy_retarget_io_uart_obj;
+
+DW_Type sim_dw0 = {0u};
+DMAC_Type sim_dmac0 = {0u};
+
+cy_stc_dma_descriptor_t DMA_DW_Descriptor_0;
+cy_stc_dma_descriptor_t DMA_DW_Descriptor_1;
+
+const cy_stc_dma_descriptor_config_t DMA_DW_Descriptor_0_config =
+{
+    .dataSize = 2UL,
+    .srcAddress = NULL,
+    .dstAddress = NULL,
+    .srcXincrement = 0,
+    .dstXincrement = 1,
+    .xCount = 16UL,
+    .nextDescriptor = &DMA_DW_Descriptor_1,
+};
+
+const cy_stc_dma_descriptor_config_t DMA_DW_Descriptor_1_config =
+{
+    .dataSize = 0UL,
+    .srcAddress = NULL,
+    .dstAddress = NULL,
+    .srcXincrement = 0,
+    .dstXincrement = 3,
+    .xCount = 22UL,
+    .nextDescriptor = NULL,
+};
+
+const cy_stc_dma_channel_config_t DMA_DW_channelConfig =
+{
+    .descriptor = &DMA_DW_Descriptor_0,
+    .priority = 3UL,
+    .enable = false,
+};
+
+cy_stc_dmac_descriptor_t DMAC_0_Descriptor_0;
+cy_stc_dmac_descriptor_t DMAC_0_Descriptor_1;
+
+const cy_stc_dmac_descriptor_config_t DMAC_0_Descriptor_0_config =
+{
+    .dataSize = 2UL,
+    .srcAddress = NULL,
+    .dstAddress = NULL,
+    .srcXincrement = 0,
+    .dstXincrement = 1,
+    .xCount = 16UL,
+    .nextDescriptor = &DMAC_0_Descriptor_1,
+};
+
+const cy_stc_dmac_descriptor_config_t DMAC_0_Descriptor_1_config =
+{
+    .dataSize = 0UL,
+    .srcAddress = NULL,
+    .dstAddress = NULL,
+    .srcXincrement = 0,
+    .dstXincrement = 3,
+    .xCount = 22UL,
+    .nextDescriptor = NULL,
+};
+
+const cy_stc_dmac_channel_config_t DMAC_0_channelConfig =
+{
+    .descriptor = &DMAC_0_Descriptor_0,
+    .priority = 3UL,
+    .enable = false,
+};
+
+/*****************************************************************************
+* Function Name: cybsp_init
+******************************************************************************
+* Summary:
+* Board initialization. The simulated peripherals are reset by Sim_Run().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*****************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+/*****************************************************************************
+* Function Name: cy_retarget_io_init_fc
+******************************************************************************
+* Summary:
+* Debug UART initialization. The UART output is the standard output.
+*
+* Parameters:
+*  tx, rx, cts, rts: Pins
+*  baudrate:         Baud rate
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*****************************************************************************/
+cy_rslt_t cy_retarget_io_init_fc(cyhal_gpio_t tx, cyhal_gpio_t rx, cyhal_gpio_t cts,
+                                 cyhal_gpio_t rts, uint32_t baudrate)
+{
+    (void)tx;
+    (void)rx;
+    (void)cts;
+    (void)rts;
+    (void)baudrate;
+    return CY_RSLT_SUCCESS;
+}
+
+/*****************************************************************************
+* Function Name: cyhal_uart_putc
+******************************************************************************
+* Summary:
+* Writes a byte on the debug UART, the standard output.
+*
+* Parameters:
+*  obj:   UART
+*  value: Byte
+*
+* Return:
+*  cy_rslt_t: CY_RSLT_SUCCESS
+*****************************************************************************/
+cy_rslt_t cyhal_uart_putc(cyhal_uart_t *obj, uint32_t value)
+{
+    (void)obj;
+    (void)putchar((int)(uint8_t)value);
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,229 @@
+/******************************************************************************
+* File Name:   sim_fault.c
+*
+* Description: This file contains the fault injection state of the host native build.
+*              A fault stays active until it is cleared, across resets.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "sim.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static struct
+{
+    bool active;
+    uint32_t param;
+} sim_fault[SIM_FAULT_COUNT];
+
+/* Fault names of the command line, in sim_fault_t order. Parameters:
+ *  io:              port << 8 | pin reported by SelfTest_IO_GetPortError()
+ *  startup_regs:    index of the corrupted configuration register
+ *  clock_drift:     signed CLK_HF deviation in percent
+ *  irq_lost:        interrupt number not delivered, 0 for all
+ *  sram_stuck,
+ *  stack_stuck:     word index | bit << 16 | stuck value << 31
+ *  sram_coupling:   aggressor word index | bit << 16; a transition of the bit
+ *                   in the aggressor word inverts it in the next word
+ *  flash_flip:      word index | bit << 16
+ *  others:          unused */
+static const char * const sim_fault_names[SIM_FAULT_COUNT] =
+{
+    "pc",
+    "cpu_regs",
+    "program_flow",
+    "io",
+    "fpu_regs",
+    "dmac",
+    "dma_dw",
+    "ipc",
+    "startup_regs",
+    "wdt_stuck",
+    "clock_drift",
+    "irq_lost",
+    "sram_stuck",
+    "sram_coupling",
+    "stack_stuck",
+    "flash_flip",
+    "stack_overflow",
+    "stack_underflow",
+};
+
+/*****************************************************************************
+* Function Name: Sim_Fault_Inject
+******************************************************************************
+* Summary:
+* Activates a fault.
+*
+* Parameters:
+*  fault: Fault
+*  param: Fault parameter, see sim_fault_names
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Fault_Inject(sim_fault_t fault, uint32_t param)
+{
+    if (fault < SIM_FAULT_COUNT)
+    {
+        sim_fault[fault].active = true;
+        sim_fault[fault].param = param;
+    }
+}
+
+/*****************************************************************************
+* Function Name: Sim_Fault_Clear
+******************************************************************************
+* Summary:
+* Deactivates a fault.
+*
+* Parameters:
+*  fault: Fault
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Fault_Clear(sim_fault_t fault)
+{
+    if (fault < SIM_FAULT_COUNT)
+    {
+        sim_fault[fault].active = false;
+        sim_fault[fault].param = 0u;
+    }
+}
+
+/*****************************************************************************
+* Function Name: Sim_Fault_Clear_All
+******************************************************************************
+* Summary:
+* Deactivates all faults.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Fault_Clear_All(void)
+{
+    memset(sim_fault, 0, sizeof(sim_fault));
+}
+
+/*****************************************************************************
+* Function Name: Sim_Fault_Active
+******************************************************************************
+* Summary:
+* Returns whether a fault is active.
+*
+* Parameters:
+*  fault: Fault
+*
+* Return:
+*  bool: true if active
+*****************************************************************************/
+bool Sim_Fault_Active(sim_fault_t fault)
+{
+    return (fault < SIM_FAULT_COUNT) && sim_fault[fault].active;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Fault_Param
+******************************************************************************
+* Summary:
+* Returns the parameter of a fault.
+*
+* Parameters:
+*  fault: Fault
+*
+* Return:
+*  uint32_t: Parameter, 0 if the fault is not active
+*****************************************************************************/
+uint32_t Sim_Fault_Param(sim_fault_t fault)
+{
+    return (fault < SIM_FAULT_COUNT) ? sim_fault[fault].param : 0u;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Fault_Name
+******************************************************************************
+* Summary:
+* Returns the command line name of a fault.
+*
+* Parameters:
+*  fault: Fault
+*
+* Return:
+*  const char *: Name, "?" for an invalid fault
+*****************************************************************************/
+const char *Sim_Fault_Name(sim_fault_t fault)
+{
+    return (fault < SIM_FAULT_COUNT) ? sim_fault_names[fault] : "?";
+}
+
+/*****************************************************************************
+* Function Name: Sim_Fault_Parse
+******************************************************************************
+* Summary:
+* Looks up a fault by its command line name.
+*
+* Parameters:
+*  name:  Fault name
+*  fault: Found fault
+*
+* Return:
+*  bool: true if the name is known
+*****************************************************************************/
+bool Sim_Fault_Parse(const char *name, sim_fault_t *fault)
+{
+    uint32_t i;
+
+    for (i = 0u; i < (uint32_t)SIM_FAULT_COUNT; i++)
+    {
+        if (0 == strcmp(name, sim_fault_names[i]))
+        {
+            *fault = (sim_fault_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* [] END OF FILE */
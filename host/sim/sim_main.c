@@ -0,0 +1,241 @@
+/******************************************************************************
+* File Name:   sim_main.c
+*
+* Description: This file contains the command line runner of the host native build.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_MAIN_USAGE \
+    "usage: self_test_host [-n runs] [-q] [-e] [-l] [-t ms] [-f fault[:param]]...\r\n" \
+    "  -n runs          number of power-on runs (default 1)\r\n" \
+    "  -q               discard the UART output of the application\r\n" \
+    "  -f fault[:param] inject a fault in every run, repeatable\r\n" \
+    "  -e               expect every run to detect an error\r\n" \
+    "  -t ms            fail a run that does not reach the first control cycle\r\n" \
+    "                   of the fast boot profile within ms of virtual time\r\n" \
+    "  -l               list the faults\r\n"
+
+/*****************************************************************************
+* Function Name: Sim_Main_Host_Us
+******************************************************************************
+* Summary:
+* Returns the host monotonic time.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t: Time in microseconds
+*****************************************************************************/
+static uint64_t Sim_Main_Host_Us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000u) + ((uint64_t)ts.tv_nsec / 1000u);
+}
+
+/*****************************************************************************
+* Function Name: Sim_Main_Add_Fault
+******************************************************************************
+* Summary:
+* Parses a "fault[:param]" argument and injects the fault.
+*
+* Parameters:
+*  arg: Argument
+*
+* Return:
+*  bool: true on success
+*****************************************************************************/
+static bool Sim_Main_Add_Fault(char *arg)
+{
+    sim_fault_t fault;
+    uint32_t param = 0u;
+    char *sep = strchr(arg, ':');
+    char *end;
+
+    if (NULL != sep)
+    {
+        *sep = '\0';
+        /* Base 0 and a signed conversion: hex indexes, negative clock drift */
+        param = (uint32_t)strtol(sep + 1, &end, 0);
+        if (('\0' == sep[1]) || ('\0' != *end))
+        {
+            return false;
+        }
+    }
+    if (!Sim_Fault_Parse(arg, &fault))
+    {
+        return false;
+    }
+    Sim_Fault_Inject(fault, param);
+    return true;
+}
+
+/*****************************************************************************
+* Function Name: main
+******************************************************************************
+* Summary:
+* Runs the application the given number of times and prints a summary on
+* stderr. A run passes when the application reaches its idle loop without
+* a test error; with -e, a run passes when an error, a reset loop or an
+* assert is detected. With -t, a run also fails when the fast boot profile
+* does not reach its first control cycle in time.
+*
+* Parameters:
+*  argc, argv: Command line
+*
+* Return:
+*  int: EXIT_SUCCESS when every run passed
+*****************************************************************************/
+int main(int argc, char *argv[])
+{
+    sim_run_result_t result;
+    uint32_t runs = 1u;
+    uint32_t passed = 0u;
+    uint32_t resets = 0u;
+    uint64_t cycles = 0u;
+    uint64_t app_cycles_max = 0u;
+    uint64_t app_budget = 0u;
+    uint32_t app_runs = 0u;
+    uint64_t start_us;
+    uint64_t host_us;
+    bool expect_error = false;
+    bool quiet = false;
+    bool ok;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "n:qef:lt:")))
+    {
+        switch (opt)
+        {
+            case 'n':
+                runs = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'q':
+                quiet = true;
+                break;
+            case 'e':
+                expect_error = true;
+                break;
+            case 'f':
+                if (!Sim_Main_Add_Fault(optarg))
+                {
+                    fprintf(stderr, "unknown fault: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 't':
+                app_budget = strtoull(optarg, NULL, 0) * SIM_CYCLES_PER_MS;
+                break;
+            case 'l':
+                for (uint32_t i = 0u; i < (uint32_t)SIM_FAULT_COUNT; i++)
+                {
+                    printf("%s\n", Sim_Fault_Name((sim_fault_t)i));
+                }
+                return EXIT_SUCCESS;
+            default:
+                fputs(SIM_MAIN_USAGE, stderr);
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (quiet && (NULL == freopen("/dev/null", "w", stdout)))
+    {
+        return EXIT_FAILURE;
+    }
+
+    start_us = Sim_Main_Host_Us();
+    for (uint32_t i = 0u; i < runs; i++)
+    {
+        Sim_Run(&result);
+        ok = result.completed && (0u == result.errors);
+        if ((0u != app_budget) &&
+            ((0u == result.app_cycles) || (result.app_cycles > app_budget)))
+        {
+            /* Boot time budget missed: the run fails, with or without -e */
+            ok = expect_error;
+        }
+        if (ok != expect_error)
+        {
+            passed++;
+        }
+        resets += result.resets;
+        cycles += result.cycles;
+        if (0u != result.app_cycles)
+        {
+            app_runs++;
+            if (result.app_cycles > app_cycles_max)
+            {
+                app_cycles_max = result.app_cycles;
+            }
+        }
+    }
+    host_us = Sim_Main_Host_Us() - start_us;
+
+    if (0u != runs)
+    {
+        fprintf(stderr,
+                "runs %lu passed %lu failed %lu resets %lu "
+                "virtual %.3f ms/run host %.1f us/run (%.0f runs/s)\n",
+                (unsigned long)runs, (unsigned long)passed,
+                (unsigned long)(runs - passed), (unsigned long)resets,
+                (double)cycles / runs / SIM_CYCLES_PER_MS,
+                (double)host_us / runs,
+                (0u != host_us) ? (runs * 1e6 / (double)host_us) : 0.0);
+    }
+    if (0u != app_runs)
+    {
+        fprintf(stderr, "first control cycle in %lu runs, max %.3f ms after power-on\n",
+                (unsigned long)app_runs, (double)app_cycles_max / SIM_CYCLES_PER_MS);
+    }
+
+    return (passed == runs) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* [] END OF FILE */
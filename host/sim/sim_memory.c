@@ -0,0 +1,319 @@
+/******************************************************************************
+* File Name:   sim_memory.c
+*
+* Description: This file contains the memory model of the host native build: SRAM,
+*              stack, flash and the start-up configuration registers, with stuck-at
+*              and bit flip faults.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Seed of the flash image and of the SRAM power-on content */
+#define SIM_MEM_SEED                    (0x2545F491UL)
+
+/* Fields of the SIM_FAULT_SRAM_STUCK, SIM_FAULT_SRAM_COUPLING,
+ * SIM_FAULT_STACK_STUCK and SIM_FAULT_FLASH_FLIP parameter */
+#define SIM_MEM_FAULT_INDEX(param)      ((param) & 0xFFFFUL)
+#define SIM_MEM_FAULT_BIT(param)        (1UL << (((param) >> 16u) & 0x1FUL))
+#define SIM_MEM_FAULT_VALUE(param)      (((param) >> 31u) & 1UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint32_t sim_sram[SIM_SRAM_WORDS];
+static uint32_t sim_stack[SIM_STACK_WORDS];
+static uint32_t sim_flash[SIM_FLASH_WORDS];
+static uint32_t sim_cfg_regs[SIM_CFG_REGS];
+
+/* Checksum of the flash image as programmed, stands for the checksum that
+ * the post-build step stores in the .flash_checksum section */
+static uint32_t sim_flash_checksum;
+
+static uint32_t * const sim_mem[SIM_MEM_COUNT] = {sim_sram, sim_stack, sim_flash, sim_cfg_regs};
+
+static const uint32_t sim_mem_words[SIM_MEM_COUNT] =
+{
+    SIM_SRAM_WORDS, SIM_STACK_WORDS, SIM_FLASH_WORDS, SIM_CFG_REGS
+};
+
+/*****************************************************************************
+* Function Name: Sim_Mem_Random
+******************************************************************************
+* Summary:
+* xorshift32 generator for the memory content.
+*
+* Parameters:
+*  state: Generator state, not 0
+*
+* Return:
+*  uint32_t: Next value
+*****************************************************************************/
+static uint32_t Sim_Mem_Random(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13u;
+    x ^= x >> 17u;
+    x ^= x << 5u;
+    *state = x;
+    return x;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Crc32
+******************************************************************************
+* Summary:
+* Adds a word, lowest byte first, to a CRC-32 (IEEE 802.3, reflected).
+*
+* Parameters:
+*  crc:  Running CRC, start with 0xFFFFFFFF
+*  word: Data
+*
+* Return:
+*  uint32_t: Updated CRC, invert it after the last word
+*****************************************************************************/
+uint32_t Sim_Crc32(uint32_t crc, uint32_t word)
+{
+    static uint32_t table[256];
+    static bool table_ready = false;
+    uint32_t i;
+
+    if (!table_ready)
+    {
+        for (i = 0u; i < 256u; i++)
+        {
+            uint32_t entry = i;
+            uint32_t bit;
+
+            for (bit = 0u; bit < 8u; bit++)
+            {
+                entry = (0u != (entry & 1u)) ? ((entry >> 1u) ^ 0xEDB88320UL) : (entry >> 1u);
+            }
+            table[i] = entry;
+        }
+        table_ready = true;
+    }
+    for (i = 0u; i < 4u; i++)
+    {
+        crc = (crc >> 8u) ^ table[(crc ^ (word >> (i * 8u))) & 0xFFu];
+    }
+    return crc;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Mem_Power_On
+******************************************************************************
+* Summary:
+* Fills the SRAM with random power-on content and clears the stack. The
+* flash image, its checksum and the configuration registers are set at the
+* first power-on only.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Mem_Power_On(void)
+{
+    static bool flash_programmed = false;
+    static uint32_t state = SIM_MEM_SEED;
+    uint32_t crc = 0xFFFFFFFFUL;
+    uint32_t i;
+
+    if (!flash_programmed)
+    {
+        for (i = 0u; i < SIM_FLASH_WORDS; i++)
+        {
+            sim_flash[i] = Sim_Mem_Random(&state);
+            crc = Sim_Crc32(crc, sim_flash[i]);
+        }
+        sim_flash_checksum = ~crc;
+        for (i = 0u; i < SIM_CFG_REGS; i++)
+        {
+            sim_cfg_regs[i] = Sim_Mem_Random(&state);
+        }
+        flash_programmed = true;
+    }
+
+    for (i = 0u; i < SIM_SRAM_WORDS; i++)
+    {
+        sim_sram[i] = Sim_Mem_Random(&state);
+    }
+    memset(sim_stack, 0, sizeof(sim_stack));
+}
+
+/*****************************************************************************
+* Function Name: Sim_Mem_Words
+******************************************************************************
+* Summary:
+* Returns the size of a region.
+*
+* Parameters:
+*  region: Memory region
+*
+* Return:
+*  uint32_t: Size in words
+*****************************************************************************/
+uint32_t Sim_Mem_Words(sim_mem_region_t region)
+{
+    return (region < SIM_MEM_COUNT) ? sim_mem_words[region] : 0u;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Mem_Read
+******************************************************************************
+* Summary:
+* Reads a word. A stuck-at cell returns its stuck value, a flipped flash
+* cell returns the inverted bit.
+*
+* Parameters:
+*  region: Memory region
+*  index:  Word index
+*
+* Return:
+*  uint32_t: Word, 0 outside the region
+*****************************************************************************/
+uint32_t Sim_Mem_Read(sim_mem_region_t region, uint32_t index)
+{
+    uint32_t value;
+    uint32_t param;
+
+    if ((region >= SIM_MEM_COUNT) || (index >= sim_mem_words[region]))
+    {
+        return 0u;
+    }
+    value = sim_mem[region][index];
+
+    if ((SIM_MEM_SRAM == region) && Sim_Fault_Active(SIM_FAULT_SRAM_STUCK))
+    {
+        param = Sim_Fault_Param(SIM_FAULT_SRAM_STUCK);
+    }
+    else if ((SIM_MEM_STACK == region) && Sim_Fault_Active(SIM_FAULT_STACK_STUCK))
+    {
+        param = Sim_Fault_Param(SIM_FAULT_STACK_STUCK);
+    }
+    else if ((SIM_MEM_FLASH == region) && Sim_Fault_Active(SIM_FAULT_FLASH_FLIP))
+    {
+        param = Sim_Fault_Param(SIM_FAULT_FLASH_FLIP);
+        if (SIM_MEM_FAULT_INDEX(param) == index)
+        {
+            value ^= SIM_MEM_FAULT_BIT(param);
+        }
+        return value;
+    }
+    else
+    {
+        return value;
+    }
+
+    if (SIM_MEM_FAULT_INDEX(param) == index)
+    {
+        if (0u != SIM_MEM_FAULT_VALUE(param))
+        {
+            value |= SIM_MEM_FAULT_BIT(param);
+        }
+        else
+        {
+            value &= ~SIM_MEM_FAULT_BIT(param);
+        }
+    }
+    return value;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Mem_Write
+******************************************************************************
+* Summary:
+* Writes a word. With an SRAM coupling fault, a write that changes the
+* coupled bit of the aggressor word inverts the bit in the victim word,
+* the next word.
+*
+* Parameters:
+*  region: Memory region
+*  index:  Word index
+*  value:  Word
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Mem_Write(sim_mem_region_t region, uint32_t index, uint32_t value)
+{
+    uint32_t param;
+
+    if ((region >= SIM_MEM_COUNT) || (index >= sim_mem_words[region]))
+    {
+        return;
+    }
+
+    if ((SIM_MEM_SRAM == region) && Sim_Fault_Active(SIM_FAULT_SRAM_COUPLING))
+    {
+        param = Sim_Fault_Param(SIM_FAULT_SRAM_COUPLING);
+        if ((SIM_MEM_FAULT_INDEX(param) == index) && ((index + 1u) < SIM_SRAM_WORDS) &&
+            (0u != ((sim_sram[index] ^ value) & SIM_MEM_FAULT_BIT(param))))
+        {
+            sim_sram[index + 1u] ^= SIM_MEM_FAULT_BIT(param);
+        }
+    }
+    sim_mem[region][index] = value;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Mem_Flash_Checksum
+******************************************************************************
+* Summary:
+* Returns the checksum of the flash image as programmed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: CRC-32
+*****************************************************************************/
+uint32_t Sim_Mem_Flash_Checksum(void)
+{
+    return sim_flash_checksum;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,355 @@
+/******************************************************************************
+* File Name:   sim_run.c
+*
+* Description: This file contains the run control of the host native build: it runs
+*              the application from power-on to its idle loop, emulates device resets
+*              and collects the test results.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* longjmp() values of the run loop */
+#define SIM_EXIT_RESET                  (1)
+#define SIM_EXIT_IDLE                   (2)
+#define SIM_EXIT_ASSERT                 (3)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Data and bss of the application objects, renamed by host/Makefile so that
+ * a reset can re-initialize them like the startup code does */
+extern uint8_t __start_app_data[] __attribute__((weak));
+extern uint8_t __stop_app_data[] __attribute__((weak));
+extern uint8_t __start_app_bss[] __attribute__((weak));
+extern uint8_t __stop_app_bss[] __attribute__((weak));
+
+static uint8_t *sim_app_data_image;
+
+static jmp_buf sim_jmp;
+static sim_run_result_t *sim_result;
+static uint64_t sim_run_start;
+static uint32_t sim_reset_reason;
+static sim_hook_t sim_hook;
+static void *sim_hook_context;
+
+/*****************************************************************************
+* Function Name: Sim_Event
+******************************************************************************
+* Summary:
+* Reports an event to the hook.
+*
+* Parameters:
+*  event: Event
+*  name:  API name, NULL for the other events
+*  value: Event value
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Sim_Event(sim_event_t event, const char *name, uint32_t value)
+{
+    if (NULL != sim_hook)
+    {
+        sim_hook(event, name, value, sim_hook_context);
+    }
+}
+
+/*****************************************************************************
+* Function Name: Sim_App_Data_Init
+******************************************************************************
+* Summary:
+* Copies the initial values of the application data and clears its bss.
+* The initial values are saved at the first call.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Sim_App_Data_Init(void)
+{
+    size_t data_size = (size_t)(__stop_app_data - __start_app_data);
+
+    if ((NULL != __start_app_data) && (0u != data_size))
+    {
+        if (NULL == sim_app_data_image)
+        {
+            sim_app_data_image = malloc(data_size);
+            if (NULL == sim_app_data_image)
+            {
+                fprintf(stderr, "sim: out of memory\n");
+                exit(EXIT_FAILURE);
+            }
+            memcpy(sim_app_data_image, __start_app_data, data_size);
+        }
+        memcpy(__start_app_data, sim_app_data_image, data_size);
+    }
+    if (NULL != __start_app_bss)
+    {
+        memset(__start_app_bss, 0, (size_t)(__stop_app_bss - __start_app_bss));
+    }
+}
+
+/*****************************************************************************
+* Function Name: Sim_Run
+******************************************************************************
+* Summary:
+* Powers the device on and runs the application until it reaches its idle
+* loop, hits CY_ASSERT, or resets more than SIM_MAX_RESETS times. Every
+* reset re-initializes the application data and the peripherals; the SRAM
+* and flash of the memory model keep their content.
+*
+* Parameters:
+*  result: Result of the run
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Run(sim_run_result_t *result)
+{
+    int exit_code;
+
+    memset(result, 0, sizeof(*result));
+    sim_result = result;
+    sim_reset_reason = 0u;
+    sim_run_start = Sim_Clock_Cycles();
+    Sim_Mem_Power_On();
+
+    for (;;)
+    {
+        Sim_App_Data_Init();
+        Sim_Core_Reset();
+        Sim_Tcpwm_Reset();
+        Sim_Wdt_Reset();
+        Sim_Selftest_Reset();
+
+        exit_code = setjmp(sim_jmp);
+        if (0 == exit_code)
+        {
+            (void)App_Main();
+            exit_code = SIM_EXIT_IDLE;
+        }
+
+        if (SIM_EXIT_RESET == exit_code)
+        {
+            result->resets++;
+            if (result->resets > SIM_MAX_RESETS)
+            {
+                break;
+            }
+        }
+        else
+        {
+            result->completed = (SIM_EXIT_IDLE == exit_code);
+            result->asserted = (SIM_EXIT_ASSERT == exit_code);
+            break;
+        }
+    }
+
+    result->cycles = Sim_Clock_Cycles() - sim_run_start;
+    fflush(stdout);
+    sim_result = NULL;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Reset
+******************************************************************************
+* Summary:
+* Resets the device and restarts the application. Does not return.
+*
+* Parameters:
+*  reason: CY_SYSLIB_RESET_xx, added to the reset reason
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Reset(uint32_t reason)
+{
+    sim_reset_reason |= reason;
+    Sim_Event(SIM_EVENT_RESET, NULL, reason);
+    longjmp(sim_jmp, SIM_EXIT_RESET);
+}
+
+/*****************************************************************************
+* Function Name: Sim_Idle
+******************************************************************************
+* Summary:
+* Called from the idle loop of the application, ends the run. Does not
+* return.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Idle(void)
+{
+    Sim_Event(SIM_EVENT_IDLE, NULL, 0u);
+    longjmp(sim_jmp, SIM_EXIT_IDLE);
+}
+
+/*****************************************************************************
+* Function Name: Sim_App_Start
+******************************************************************************
+* Summary:
+* Called at the first control cycle of the application. Records the time
+* from power-on to the first control cycle of the run; later calls, after
+* a reset, are only reported to the hook.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_App_Start(void)
+{
+    if ((NULL != sim_result) && (0u == sim_result->app_cycles))
+    {
+        sim_result->app_cycles = Sim_Clock_Cycles() - sim_run_start;
+    }
+    Sim_Event(SIM_EVENT_APP_START, NULL, 0u);
+}
+
+/*****************************************************************************
+* Function Name: Sim_Assert
+******************************************************************************
+* Summary:
+* CY_ASSERT failure, ends the run. Does not return.
+*
+* Parameters:
+*  file: Source file
+*  line: Source line
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Assert(const char *file, int line)
+{
+    fprintf(stderr, "sim: CY_ASSERT failed at %s:%d\n", file, line);
+    longjmp(sim_jmp, SIM_EXIT_ASSERT);
+}
+
+/*****************************************************************************
+* Function Name: Sim_Set_Hook
+******************************************************************************
+* Summary:
+* Installs the event hook, e.g. to inject faults at a given test.
+*
+* Parameters:
+*  hook:    Hook, NULL to remove it
+*  context: Passed to the hook
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Set_Hook(sim_hook_t hook, void *context)
+{
+    sim_hook = hook;
+    sim_hook_context = context;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Test_Entry
+******************************************************************************
+* Summary:
+* Called by the test models when a SelfTest API is entered.
+*
+* Parameters:
+*  name: API name
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Test_Entry(const char *name)
+{
+    Sim_Event(SIM_EVENT_TEST_ENTRY, name, 0u);
+}
+
+/*****************************************************************************
+* Function Name: Sim_Test_Result
+******************************************************************************
+* Summary:
+* Called by the test models with the status they return. Counts the final
+* results and the errors of the run.
+*
+* Parameters:
+*  name:   API name
+*  status: Returned status
+*
+* Return:
+*  uint8_t: status
+*****************************************************************************/
+uint8_t Sim_Test_Result(const char *name, uint8_t status)
+{
+    if ((NULL != sim_result) && (PASS_STILL_TESTING_STATUS != status))
+    {
+        sim_result->tests++;
+        if ((OK_STATUS != status) && (PASS_COMPLETE_STATUS != status))
+        {
+            sim_result->errors++;
+        }
+    }
+    Sim_Event(SIM_EVENT_TEST_RESULT, name, status);
+    return status;
+}
+
+/*******************************************************************************
+* PDL reset reason functions
+*******************************************************************************/
+uint32_t Cy_SysLib_GetResetReason(void)
+{
+    return sim_reset_reason;
+}
+
+void Cy_SysLib_ClearResetReason(void)
+{
+    sim_reset_reason = 0u;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,734 @@
+/******************************************************************************
+* File Name:   sim_selftest.c
+*
+* Description: This file contains the models of the Class-B Safety Software Library
+*              (mtb-stl) tests of the host native build. Each model runs against the
+*              simulated peripherals and memory and charges its CPU cycles to the
+*              virtual clock.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* CPU cycles charged by the tests, approximate CM4 figures */
+#define SIM_CYCLES_PC                   (150u)
+#define SIM_CYCLES_CPU_REGS             (900u)
+#define SIM_CYCLES_PROGRAM_FLOW         (100u)
+#define SIM_CYCLES_IO                   (2500u)
+#define SIM_CYCLES_FPU_REGS             (700u)
+#define SIM_CYCLES_DMAC                 (4000u)
+#define SIM_CYCLES_DMA_DW               (4000u)
+#define SIM_CYCLES_IPC                  (6000u)
+#define SIM_CYCLES_STARTUP_REGS         (400u)
+#define SIM_CYCLES_STACK_CHECK          (120u)
+#define SIM_CYCLES_PER_MARCH_WORD       (14u)
+#define SIM_CYCLES_PER_FLASH_WORD       (9u)
+
+/* WDT test: ignore bits for a short WDT period, and the time to wait for
+ * the reset */
+#define SIM_WDT_TEST_IGNORE_BITS        (12u)
+#define SIM_WDT_TEST_TIMEOUT_MS         (10u)
+
+/* Clock test: measured counter periods, CPU slice per call and tolerance */
+#define SIM_CLOCK_TEST_PERIODS          (4u)
+#define SIM_CLOCK_TEST_SLICE_CYCLES     (25000u)
+#define SIM_CLOCK_TEST_TOLERANCE_PCT    (5u)
+
+/* Interrupt test: counter periods in the observation window */
+#define SIM_INTERRUPT_TEST_PERIODS      (10u)
+
+/* March test block, in words */
+#define SIM_MARCH_BLOCK_WORDS           (64u)
+
+/* Stack test pattern */
+#define SIM_STACK_PATTERN               (0xAA55AA55UL)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Incremental March test of one memory region */
+typedef struct
+{
+    sim_mem_region_t region;
+    uint32_t shift;         /* Offset of the first block */
+    uint32_t offset;        /* Next block */
+} sim_march_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Checksum calculated by the last SelfTest_FlashCheckSum() pass */
+uint32_t flash_CheckSum;
+
+/* Library state, reset with the device */
+static struct
+{
+    struct
+    {
+        TCPWM_Type *base;
+        uint32_t num;
+        bool running;
+        uint32_t isr_count;
+        uint64_t start;
+        uint64_t first_isr;
+        uint64_t last_isr;
+    } clock;
+
+    struct
+    {
+        TCPWM_Type *base;
+        uint32_t num;
+        uint32_t isr_count;
+    } interrupt;
+
+    sim_march_t sram_march;
+    sim_march_t stack_march;
+    uint32_t stack_pattern_words;
+
+    struct
+    {
+        uint32_t words;
+        uint32_t pos;
+        uint32_t crc;
+    } flash;
+} sim_stl;
+
+/* Configuration registers saved to flash, kept across resets */
+static uint32_t sim_saved_cfg_regs[SIM_CFG_REGS];
+static bool sim_saved_cfg_valid = false;
+
+/*****************************************************************************
+* Function Name: Sim_Selftest_Reset
+******************************************************************************
+* Summary:
+* Resets the library state. The saved configuration registers are in flash
+* and are kept.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Selftest_Reset(void)
+{
+    memset(&sim_stl, 0, sizeof(sim_stl));
+    sim_stl.sram_march.region = SIM_MEM_SRAM;
+    sim_stl.stack_march.region = SIM_MEM_STACK;
+    sim_stl.flash.crc = 0xFFFFFFFFUL;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Selftest_Simple
+******************************************************************************
+* Summary:
+* Model of a test without simulated hardware: charges its cycles and fails
+* while its fault is active.
+*
+* Parameters:
+*  name:   API name
+*  fault:  Fault detected by the test
+*  cycles: CPU cycles of the test
+*
+* Return:
+*  uint8_t: OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+static uint8_t Sim_Selftest_Simple(const char *name, sim_fault_t fault, uint32_t cycles)
+{
+    Sim_Test_Entry(name);
+    Sim_Clock_Advance(cycles);
+    return Sim_Test_Result(name, Sim_Fault_Active(fault) ? ERROR_STATUS : OK_STATUS);
+}
+
+uint8_t SelfTest_PC(void)
+{
+    return Sim_Selftest_Simple("SelfTest_PC", SIM_FAULT_PC, SIM_CYCLES_PC);
+}
+
+uint8_t SelfTest_CPU_Registers(void)
+{
+    return Sim_Selftest_Simple("SelfTest_CPU_Registers", SIM_FAULT_CPU_REGS, SIM_CYCLES_CPU_REGS);
+}
+
+uint8_t SelfTest_PROGRAM_FLOW(void)
+{
+    return Sim_Selftest_Simple("SelfTest_PROGRAM_FLOW", SIM_FAULT_PROGRAM_FLOW, SIM_CYCLES_PROGRAM_FLOW);
+}
+
+uint8_t SelfTest_IO(void)
+{
+    return Sim_Selftest_Simple("SelfTest_IO", SIM_FAULT_IO, SIM_CYCLES_IO);
+}
+
+uint8_t SelfTest_IO_GetPortError(void)
+{
+    return (uint8_t)(Sim_Fault_Param(SIM_FAULT_IO) >> 8u);
+}
+
+uint8_t SelfTest_IO_GetPinError(void)
+{
+    return (uint8_t)Sim_Fault_Param(SIM_FAULT_IO);
+}
+
+uint8_t SelfTest_FPU_Registers(void)
+{
+    return Sim_Selftest_Simple("SelfTest_FPU_Registers", SIM_FAULT_FPU_REGS, SIM_CYCLES_FPU_REGS);
+}
+
+uint8_t SelfTest_IPC(void)
+{
+    return Sim_Selftest_Simple("SelfTest_IPC", SIM_FAULT_IPC, SIM_CYCLES_IPC);
+}
+
+uint8_t SelfTest_DMAC(DMAC_Type *base, uint32_t channel,
+                      cy_stc_dmac_descriptor_t *descriptor0,
+                      cy_stc_dmac_descriptor_t *descriptor1,
+                      const cy_stc_dmac_descriptor_config_t *descriptor0Config,
+                      const cy_stc_dmac_descriptor_config_t *descriptor1Config,
+                      const cy_stc_dmac_channel_config_t *channelConfig,
+                      uint32_t trigLine)
+{
+    (void)channel;
+    (void)trigLine;
+    if ((NULL == base) || (NULL == descriptor0) || (NULL == descriptor1) ||
+        (NULL == descriptor0Config) || (NULL == descriptor1Config) || (NULL == channelConfig))
+    {
+        Sim_Test_Entry("SelfTest_DMAC");
+        return Sim_Test_Result("SelfTest_DMAC", ERROR_STATUS);
+    }
+    return Sim_Selftest_Simple("SelfTest_DMAC", SIM_FAULT_DMAC, SIM_CYCLES_DMAC);
+}
+
+uint8_t SelfTest_DMA_DW(DW_Type *base, uint32_t channel,
+                        cy_stc_dma_descriptor_t *descriptor0,
+                        cy_stc_dma_descriptor_t *descriptor1,
+                        const cy_stc_dma_descriptor_config_t *descriptor0Config,
+                        const cy_stc_dma_descriptor_config_t *descriptor1Config,
+                        const cy_stc_dma_channel_config_t *channelConfig,
+                        uint32_t trigLine)
+{
+    (void)channel;
+    (void)trigLine;
+    if ((NULL == base) || (NULL == descriptor0) || (NULL == descriptor1) ||
+        (NULL == descriptor0Config) || (NULL == descriptor1Config) || (NULL == channelConfig))
+    {
+        Sim_Test_Entry("SelfTest_DMA_DW");
+        return Sim_Test_Result("SelfTest_DMA_DW", ERROR_STATUS);
+    }
+    return Sim_Selftest_Simple("SelfTest_DMA_DW", SIM_FAULT_DMA_DW, SIM_CYCLES_DMA_DW);
+}
+
+/*****************************************************************************
+* Function Name: SelfTest_WDT
+******************************************************************************
+* Summary:
+* WDT test model. After a WDT reset the test passes. Otherwise it starts
+* the WDT with a short period and waits for the reset, which restarts the
+* application. If the reset does not come, the test fails.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t SelfTest_WDT(void)
+{
+    uint32_t waited;
+
+    Sim_Test_Entry("SelfTest_WDT");
+    if (0u != (Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HWWDT))
+    {
+        Cy_SysLib_ClearResetReason();
+        return Sim_Test_Result("SelfTest_WDT", OK_STATUS);
+    }
+
+    Cy_WDT_Unlock();
+    Cy_WDT_Disable();
+    Cy_WDT_SetIgnoreBits(SIM_WDT_TEST_IGNORE_BITS);
+    Cy_WDT_ClearInterrupt();
+    Cy_WDT_Enable();
+    for (waited = 0u; waited < SIM_WDT_TEST_TIMEOUT_MS; waited++)
+    {
+        Sim_Clock_Advance(SIM_CYCLES_PER_MS);
+    }
+    Cy_WDT_Disable();
+    return Sim_Test_Result("SelfTest_WDT", ERROR_STATUS);
+}
+
+/*****************************************************************************
+* Function Name: SelfTest_Clock
+******************************************************************************
+* Summary:
+* Clock test model (independent time slot monitoring). The first call
+* starts the counter; every call runs a CPU slice. When the counter has
+* interrupted SIM_CLOCK_TEST_PERIODS + 1 times, the CPU cycles per counter
+* period are compared with the nominal value.
+*
+* Parameters:
+*  base:   TCPWM group of the counter
+*  cntNum: Counter number
+*
+* Return:
+*  uint8_t: PASS_STILL_TESTING_STATUS, OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t SelfTest_Clock(TCPWM_Type *base, uint32_t cntNum)
+{
+    uint64_t nominal;
+    uint64_t measured;
+    uint8_t status = PASS_STILL_TESTING_STATUS;
+
+    Sim_Test_Entry("SelfTest_Clock");
+    if (!sim_stl.clock.running)
+    {
+        sim_stl.clock.base = base;
+        sim_stl.clock.num = cntNum;
+        sim_stl.clock.isr_count = 0u;
+        sim_stl.clock.running = true;
+        sim_stl.clock.start = Sim_Clock_Cycles();
+        Cy_TCPWM_Counter_SetCounter(base, cntNum, 0u);
+        Cy_TCPWM_TriggerStart_Single(base, cntNum);
+    }
+
+    Sim_Clock_Advance(SIM_CLOCK_TEST_SLICE_CYCLES);
+
+    nominal = ((uint64_t)Cy_TCPWM_Counter_GetPeriod(base, cntNum) + 1u) *
+              (SIM_CPU_HZ / SIM_TCPWM_CLK_HZ);
+    if (sim_stl.clock.isr_count > SIM_CLOCK_TEST_PERIODS)
+    {
+        measured = (sim_stl.clock.last_isr - sim_stl.clock.first_isr) / SIM_CLOCK_TEST_PERIODS;
+        status = ((measured * 100u >= nominal * (100u - SIM_CLOCK_TEST_TOLERANCE_PCT)) &&
+                  (measured * 100u <= nominal * (100u + SIM_CLOCK_TEST_TOLERANCE_PCT))) ?
+                 OK_STATUS : ERROR_STATUS;
+    }
+    else if ((Sim_Clock_Cycles() - sim_stl.clock.start) > (4u * (SIM_CLOCK_TEST_PERIODS + 1u) * nominal))
+    {
+        /* The counter does not interrupt */
+        status = ERROR_STATUS;
+    }
+
+    if (PASS_STILL_TESTING_STATUS != status)
+    {
+        Cy_TCPWM_TriggerStopOrKill_Single(base, cntNum);
+        sim_stl.clock.running = false;
+    }
+    return Sim_Test_Result("SelfTest_Clock", status);
+}
+
+void SelfTest_Clock_ISR_TIMER(void)
+{
+    uint64_t now = Sim_Clock_Cycles();
+
+    Cy_TCPWM_ClearInterrupt(sim_stl.clock.base, sim_stl.clock.num, CY_TCPWM_INT_ON_TC);
+    if (0u == sim_stl.clock.isr_count)
+    {
+        sim_stl.clock.first_isr = now;
+    }
+    sim_stl.clock.last_isr = now;
+    sim_stl.clock.isr_count++;
+}
+
+/*****************************************************************************
+* Function Name: SelfTest_Interrupt
+******************************************************************************
+* Summary:
+* Interrupt test model. Runs the counter for SIM_INTERRUPT_TEST_PERIODS
+* periods and checks that the handler was called once per period.
+*
+* Parameters:
+*  base:   TCPWM group of the counter
+*  cntNum: Counter number
+*
+* Return:
+*  uint8_t: OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t SelfTest_Interrupt(TCPWM_Type *base, uint32_t cntNum)
+{
+    uint64_t period;
+    uint32_t count;
+
+    Sim_Test_Entry("SelfTest_Interrupt");
+    sim_stl.interrupt.base = base;
+    sim_stl.interrupt.num = cntNum;
+    sim_stl.interrupt.isr_count = 0u;
+
+    period = ((uint64_t)Cy_TCPWM_Counter_GetPeriod(base, cntNum) + 1u) *
+             (SIM_CPU_HZ / SIM_TCPWM_CLK_HZ);
+    Cy_TCPWM_Counter_SetCounter(base, cntNum, 0u);
+    Cy_TCPWM_TriggerStart_Single(base, cntNum);
+    Sim_Clock_Advance((SIM_INTERRUPT_TEST_PERIODS * period) + (period / 2u));
+    Cy_TCPWM_TriggerStopOrKill_Single(base, cntNum);
+
+    count = sim_stl.interrupt.isr_count;
+    return Sim_Test_Result("SelfTest_Interrupt",
+                           ((count + 1u >= SIM_INTERRUPT_TEST_PERIODS) &&
+                            (count <= SIM_INTERRUPT_TEST_PERIODS + 1u)) ? OK_STATUS : ERROR_STATUS);
+}
+
+void SelfTest_Interrupt_ISR_TIMER(void)
+{
+    Cy_TCPWM_ClearInterrupt(sim_stl.interrupt.base, sim_stl.interrupt.num, CY_TCPWM_INT_ON_TC);
+    sim_stl.interrupt.isr_count++;
+}
+
+/*****************************************************************************
+* Function Name: Sim_March_Block
+******************************************************************************
+* Summary:
+* Runs March C- on a block of the memory model. The block content is saved
+* and restored.
+*
+* Parameters:
+*  region: Memory region
+*  start:  First word
+*  words:  Number of words, at most SIM_MARCH_BLOCK_WORDS
+*
+* Return:
+*  bool: true if no fault was found
+*****************************************************************************/
+static bool Sim_March_Block(sim_mem_region_t region, uint32_t start, uint32_t words)
+{
+    uint32_t saved[SIM_MARCH_BLOCK_WORDS];
+    bool pass = true;
+    uint32_t i;
+
+    for (i = 0u; i < words; i++)
+    {
+        saved[i] = Sim_Mem_Read(region, start + i);
+        Sim_Mem_Write(region, start + i, 0u);
+    }
+    for (i = 0u; i < words; i++)
+    {
+        pass = pass && (0u == Sim_Mem_Read(region, start + i));
+        Sim_Mem_Write(region, start + i, 0xFFFFFFFFUL);
+    }
+    for (i = 0u; i < words; i++)
+    {
+        pass = pass && (0xFFFFFFFFUL == Sim_Mem_Read(region, start + i));
+        Sim_Mem_Write(region, start + i, 0u);
+    }
+    for (i = words; i > 0u; i--)
+    {
+        pass = pass && (0u == Sim_Mem_Read(region, start + i - 1u));
+        Sim_Mem_Write(region, start + i - 1u, 0xFFFFFFFFUL);
+    }
+    for (i = words; i > 0u; i--)
+    {
+        pass = pass && (0xFFFFFFFFUL == Sim_Mem_Read(region, start + i - 1u));
+        Sim_Mem_Write(region, start + i - 1u, 0u);
+    }
+    for (i = 0u; i < words; i++)
+    {
+        pass = pass && (0u == Sim_Mem_Read(region, start + i));
+        Sim_Mem_Write(region, start + i, saved[i]);
+    }
+    Sim_Clock_Advance((uint64_t)words * SIM_CYCLES_PER_MARCH_WORD);
+    return pass;
+}
+
+/*****************************************************************************
+* Function Name: Sim_March_Step
+******************************************************************************
+* Summary:
+* Tests the next block of an incremental March test.
+*
+* Parameters:
+*  march: March test state
+*
+* Return:
+*  uint8_t: PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS or ERROR_STATUS
+*****************************************************************************/
+static uint8_t Sim_March_Step(sim_march_t *march)
+{
+    uint32_t size = Sim_Mem_Words(march->region);
+    uint32_t words = SIM_MARCH_BLOCK_WORDS;
+
+    if (march->offset + words > size)
+    {
+        words = size - march->offset;
+    }
+    if (!Sim_March_Block(march->region, march->offset, words))
+    {
+        march->offset = march->shift;
+        return ERROR_STATUS;
+    }
+    march->offset += words;
+    if (march->offset >= size)
+    {
+        march->offset = march->shift;
+        return PASS_COMPLETE_STATUS;
+    }
+    return PASS_STILL_TESTING_STATUS;
+}
+
+void SelfTests_Init_March_SRAM_Test(uint8_t shift)
+{
+    sim_stl.sram_march.shift = shift % SIM_SRAM_WORDS;
+    sim_stl.sram_march.offset = sim_stl.sram_march.shift;
+}
+
+uint8_t SelfTests_SRAM_March(void)
+{
+    Sim_Test_Entry("SelfTests_SRAM_March");
+    return Sim_Test_Result("SelfTests_SRAM_March", Sim_March_Step(&sim_stl.sram_march));
+}
+
+void SelfTests_Init_March_Stack_Test(uint8_t shift)
+{
+    sim_stl.stack_march.shift = shift % SIM_STACK_WORDS;
+    sim_stl.stack_march.offset = sim_stl.stack_march.shift;
+}
+
+uint8_t SelfTests_Stack_March(void)
+{
+    Sim_Test_Entry("SelfTests_Stack_March");
+    return Sim_Test_Result("SelfTests_Stack_March", Sim_March_Step(&sim_stl.stack_march));
+}
+
+/*****************************************************************************
+* Function Name: SelfTests_Init_Stack_Test
+******************************************************************************
+* Summary:
+* Writes the stack test pattern at both ends of the simulated stack.
+*
+* Parameters:
+*  block_size: Pattern size in bytes
+*
+* Return:
+*  void
+*****************************************************************************/
+void SelfTests_Init_Stack_Test(uint8_t block_size)
+{
+    uint32_t i;
+
+    sim_stl.stack_pattern_words = (block_size + 3u) / 4u;
+    for (i = 0u; i < sim_stl.stack_pattern_words; i++)
+    {
+        Sim_Mem_Write(SIM_MEM_STACK, i, SIM_STACK_PATTERN ^ i);
+        Sim_Mem_Write(SIM_MEM_STACK, SIM_STACK_WORDS - 1u - i, SIM_STACK_PATTERN ^ i);
+    }
+}
+
+/*****************************************************************************
+* Function Name: SelfTests_Stack_Check
+******************************************************************************
+* Summary:
+* Checks the stack test pattern. SIM_FAULT_STACK_OVERFLOW and
+* SIM_FAULT_STACK_UNDERFLOW overwrite the pattern at the stack limit or top
+* before the check.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: OK_STATUS or ERROR_STACK_OVERFLOW / ERROR_STACK_UNDERFLOW flags
+*****************************************************************************/
+uint8_t SelfTests_Stack_Check(void)
+{
+    uint8_t status = OK_STATUS;
+    uint32_t i;
+
+    Sim_Test_Entry("SelfTests_Stack_Check");
+    if (Sim_Fault_Active(SIM_FAULT_STACK_OVERFLOW))
+    {
+        Sim_Mem_Write(SIM_MEM_STACK, 0u, 0u);
+    }
+    if (Sim_Fault_Active(SIM_FAULT_STACK_UNDERFLOW))
+    {
+        Sim_Mem_Write(SIM_MEM_STACK, SIM_STACK_WORDS - 1u, 0u);
+    }
+    for (i = 0u; i < sim_stl.stack_pattern_words; i++)
+    {
+        if (Sim_Mem_Read(SIM_MEM_STACK, i) != (SIM_STACK_PATTERN ^ i))
+        {
+            status |= ERROR_STACK_OVERFLOW;
+        }
+        if (Sim_Mem_Read(SIM_MEM_STACK, SIM_STACK_WORDS - 1u - i) != (SIM_STACK_PATTERN ^ i))
+        {
+            status |= ERROR_STACK_UNDERFLOW;
+        }
+    }
+    Sim_Clock_Advance(SIM_CYCLES_STACK_CHECK);
+    return Sim_Test_Result("SelfTests_Stack_Check", status);
+}
+
+/*****************************************************************************
+* Function Name: SelfTest_Flash_init
+******************************************************************************
+* Summary:
+* Starts a flash checksum pass. The stored checksum of the application is
+* patched by the post-build step on the target; the model compares with
+* the checksum of the simulated flash image instead.
+*
+* Parameters:
+*  startAddr:     First address
+*  endAddr:       End address
+*  flashChecksum: Stored checksum, not used
+*
+* Return:
+*  void
+*****************************************************************************/
+void SelfTest_Flash_init(uint32_t startAddr, uint32_t endAddr, uint32_t flashChecksum)
+{
+    (void)flashChecksum;
+    sim_stl.flash.words = (endAddr - startAddr) / 4u;
+    if (sim_stl.flash.words > SIM_FLASH_WORDS)
+    {
+        sim_stl.flash.words = SIM_FLASH_WORDS;
+    }
+    sim_stl.flash.pos = 0u;
+    sim_stl.flash.crc = 0xFFFFFFFFUL;
+}
+
+/*****************************************************************************
+* Function Name: SelfTest_FlashCheckSum
+******************************************************************************
+* Summary:
+* Adds the next double words to the CRC-32 of the flash and compares the
+* result at the end of the flash.
+*
+* Parameters:
+*  doubleWordsToTest: Double words per call
+*
+* Return:
+*  uint8_t: PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t SelfTest_FlashCheckSum(uint32_t doubleWordsToTest)
+{
+    uint32_t words = doubleWordsToTest * 2u;
+    uint8_t status = PASS_STILL_TESTING_STATUS;
+    uint32_t i;
+
+    Sim_Test_Entry("SelfTest_FlashCheckSum");
+    if (words > (sim_stl.flash.words - sim_stl.flash.pos))
+    {
+        words = sim_stl.flash.words - sim_stl.flash.pos;
+    }
+    for (i = 0u; i < words; i++)
+    {
+        sim_stl.flash.crc = Sim_Crc32(sim_stl.flash.crc, Sim_Mem_Read(SIM_MEM_FLASH, sim_stl.flash.pos + i));
+    }
+    sim_stl.flash.pos += words;
+    Sim_Clock_Advance((uint64_t)words * SIM_CYCLES_PER_FLASH_WORD);
+
+    if (sim_stl.flash.pos >= sim_stl.flash.words)
+    {
+        flash_CheckSum = ~sim_stl.flash.crc;
+        status = (flash_CheckSum == Sim_Mem_Flash_Checksum()) ? PASS_COMPLETE_STATUS : ERROR_STATUS;
+        sim_stl.flash.pos = 0u;
+        sim_stl.flash.crc = 0xFFFFFFFFUL;
+    }
+    return Sim_Test_Result("SelfTest_FlashCheckSum", status);
+}
+
+void SelfTests_Init_StartUp_ConfigReg(void)
+{
+    Sim_Clock_Advance(SIM_CYCLES_STARTUP_REGS / 4u);
+}
+
+/*****************************************************************************
+* Function Name: SelfTests_Save_StartUp_ConfigReg
+******************************************************************************
+* Summary:
+* Saves the configuration registers to flash, once after programming.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: CY_FLASH_DRV_SUCCESS
+*****************************************************************************/
+uint32_t SelfTests_Save_StartUp_ConfigReg(void)
+{
+    uint32_t i;
+
+    if (!sim_saved_cfg_valid)
+    {
+        for (i = 0u; i < SIM_CFG_REGS; i++)
+        {
+            sim_saved_cfg_regs[i] = Sim_Mem_Read(SIM_MEM_CFG_REGS, i);
+        }
+        sim_saved_cfg_valid = true;
+        Sim_Clock_Advance(SIM_CYCLES_PER_MS);
+    }
+    return CY_FLASH_DRV_SUCCESS;
+}
+
+/*****************************************************************************
+* Function Name: SelfTests_StartUp_ConfigReg
+******************************************************************************
+* Summary:
+* Compares the configuration registers with the saved copy.
+* SIM_FAULT_STARTUP_REGS corrupts the register given as parameter.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t SelfTests_StartUp_ConfigReg(void)
+{
+    uint8_t status = OK_STATUS;
+    uint32_t value;
+    uint32_t i;
+
+    Sim_Test_Entry("SelfTests_StartUp_ConfigReg");
+    for (i = 0u; i < SIM_CFG_REGS; i++)
+    {
+        value = Sim_Mem_Read(SIM_MEM_CFG_REGS, i);
+        if (Sim_Fault_Active(SIM_FAULT_STARTUP_REGS) &&
+            ((Sim_Fault_Param(SIM_FAULT_STARTUP_REGS) % SIM_CFG_REGS) == i))
+        {
+            value ^= 1u;
+        }
+        if ((!sim_saved_cfg_valid) || (value != sim_saved_cfg_regs[i]))
+        {
+            status = ERROR_STATUS;
+        }
+    }
+    Sim_Clock_Advance(SIM_CYCLES_STARTUP_REGS);
+    return Sim_Test_Result("SelfTests_StartUp_ConfigReg", status);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,274 @@
+/******************************************************************************
+* File Name:   sim_sram_dma.c
+*
+* Description: This file contains the model of the DMA accelerated SRAM test of
+*              source/sram_dma_test.c on the SRAM of the memory model: March C- on
+*              two data backgrounds per block, with the fills and the final reads
+*              of the DW, and an address pattern. Built into the campaign binary
+*              with SRAM_DMA_TEST_ENABLE.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "sim.h"
+#include "sram_dma_test.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* CPU cycles charged per word of a block: the DW save, fills, CRC transfers
+ * and restore, and the CPU read and write elements */
+#define SIM_CYCLES_PER_SRAM_DMA_WORD    (30u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* March C- data backgrounds of source/sram_dma_test.c */
+static const uint32_t sim_sram_dma_backgrounds[] = {0x00000000UL, 0x55555555UL};
+
+#define SIM_SRAM_DMA_BACKGROUNDS        (sizeof(sim_sram_dma_backgrounds) / sizeof(sim_sram_dma_backgrounds[0]))
+
+/* Test state, set up by Sram_Dma_Test_Init() */
+static struct
+{
+    uint32_t next;              /* Next block, word index */
+    uintptr_t error_address;
+} sim_sram_dma;
+
+/*****************************************************************************
+* Function Name: Sim_Sram_Dma_Fail
+******************************************************************************
+* Summary:
+* Records the first failing word. The memory model has no addresses, the
+* byte offset of the word in the SRAM model is reported.
+*
+* Parameters:
+*  index: Failing word, or first word of the block for a CRC mismatch
+*
+* Return:
+*  bool: false
+*****************************************************************************/
+static bool Sim_Sram_Dma_Fail(uint32_t index)
+{
+    if (0u == sim_sram_dma.error_address)
+    {
+        sim_sram_dma.error_address = (uintptr_t)index * sizeof(uint32_t);
+    }
+    return false;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Sram_Dma_Crc
+******************************************************************************
+* Summary:
+* DW CRC transfer: the CRC of a block of the SRAM model.
+*
+* Parameters:
+*  start: First word
+*  words: Number of words
+*
+* Return:
+*  uint32_t: CRC
+*****************************************************************************/
+static uint32_t Sim_Sram_Dma_Crc(uint32_t start, uint32_t words)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+
+    for (uint32_t i = 0u; i < words; i++)
+    {
+        crc = Sim_Crc32(crc, Sim_Mem_Read(SIM_MEM_SRAM, start + i));
+    }
+    return crc;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Sram_Dma_March
+******************************************************************************
+* Summary:
+* March C- on a block with one background: the DW fill, the CPU read and
+* write elements, and the final read as a DW CRC transfer.
+*
+* Parameters:
+*  start:      First word
+*  words:      Number of words
+*  background: Data background
+*
+* Return:
+*  bool: true if no fault was found
+*****************************************************************************/
+static bool Sim_Sram_Dma_March(uint32_t start, uint32_t words, uint32_t background)
+{
+    const uint32_t inverse = ~background;
+    uint32_t expected_crc = 0xFFFFFFFFUL;
+    uint32_t i;
+
+    for (i = 0u; i < words; i++)
+    {
+        Sim_Mem_Write(SIM_MEM_SRAM, start + i, background);
+        expected_crc = Sim_Crc32(expected_crc, background);
+    }
+    for (i = 0u; i < words; i++)
+    {
+        if (background != Sim_Mem_Read(SIM_MEM_SRAM, start + i))
+        {
+            return Sim_Sram_Dma_Fail(start + i);
+        }
+        Sim_Mem_Write(SIM_MEM_SRAM, start + i, inverse);
+    }
+    for (i = 0u; i < words; i++)
+    {
+        if (inverse != Sim_Mem_Read(SIM_MEM_SRAM, start + i))
+        {
+            return Sim_Sram_Dma_Fail(start + i);
+        }
+        Sim_Mem_Write(SIM_MEM_SRAM, start + i, background);
+    }
+    for (i = words; i > 0u; i--)
+    {
+        if (background != Sim_Mem_Read(SIM_MEM_SRAM, start + i - 1u))
+        {
+            return Sim_Sram_Dma_Fail(start + i - 1u);
+        }
+        Sim_Mem_Write(SIM_MEM_SRAM, start + i - 1u, inverse);
+    }
+    for (i = words; i > 0u; i--)
+    {
+        if (inverse != Sim_Mem_Read(SIM_MEM_SRAM, start + i - 1u))
+        {
+            return Sim_Sram_Dma_Fail(start + i - 1u);
+        }
+        Sim_Mem_Write(SIM_MEM_SRAM, start + i - 1u, background);
+    }
+    return (expected_crc == Sim_Sram_Dma_Crc(start, words)) || Sim_Sram_Dma_Fail(start);
+}
+
+/*****************************************************************************
+* Function Name: Sim_Sram_Dma_Block
+******************************************************************************
+* Summary:
+* Tests one block: saves it, runs March C- on every background, writes and
+* verifies the address pattern, then restores the saved contents.
+*
+* Parameters:
+*  start: First word
+*  words: Number of words, at most SRAM_DMA_TEST_BLOCK_WORDS
+*
+* Return:
+*  bool: true if no fault was found
+*****************************************************************************/
+static bool Sim_Sram_Dma_Block(uint32_t start, uint32_t words)
+{
+    uint32_t saved[SRAM_DMA_TEST_BLOCK_WORDS];
+    uint32_t expected_crc = 0xFFFFFFFFUL;
+    bool pass = true;
+    uint32_t i;
+
+    for (i = 0u; i < words; i++)
+    {
+        saved[i] = Sim_Mem_Read(SIM_MEM_SRAM, start + i);
+    }
+    for (i = 0u; (i < SIM_SRAM_DMA_BACKGROUNDS) && pass; i++)
+    {
+        pass = Sim_Sram_Dma_March(start, words, sim_sram_dma_backgrounds[i]);
+    }
+    if (pass)
+    {
+        for (i = 0u; i < words; i++)
+        {
+            uint32_t value = (i << 16u) | (~i & 0xFFFFUL);
+
+            Sim_Mem_Write(SIM_MEM_SRAM, start + i, value);
+            expected_crc = Sim_Crc32(expected_crc, value);
+        }
+        pass = (expected_crc == Sim_Sram_Dma_Crc(start, words)) || Sim_Sram_Dma_Fail(start);
+    }
+    for (i = 0u; i < words; i++)
+    {
+        Sim_Mem_Write(SIM_MEM_SRAM, start + i, saved[i]);
+    }
+    for (i = 0u; (i < words) && pass; i++)
+    {
+        pass = (saved[i] == Sim_Mem_Read(SIM_MEM_SRAM, start + i)) || Sim_Sram_Dma_Fail(start + i);
+    }
+    Sim_Clock_Advance((uint64_t)words * SIM_CYCLES_PER_SRAM_DMA_WORD);
+    return pass;
+}
+
+uint8_t Sram_Dma_Test_Init(void)
+{
+    sim_sram_dma.next = 0u;
+    sim_sram_dma.error_address = 0u;
+    return OK_STATUS;
+}
+
+uint8_t Sram_Dma_Test_Step(void)
+{
+    uint8_t status = PASS_STILL_TESTING_STATUS;
+
+    Sim_Test_Entry("Sram_Dma_Test_Step");
+    for (uint32_t n = 0u; (n < SRAM_DMA_TEST_BLOCKS_PER_STEP) && (PASS_STILL_TESTING_STATUS == status); n++)
+    {
+        uint32_t words = SRAM_DMA_TEST_BLOCK_WORDS;
+
+        if (sim_sram_dma.next >= SIM_SRAM_WORDS)
+        {
+            sim_sram_dma.next = 0u;
+            status = PASS_COMPLETE_STATUS;
+        }
+        else
+        {
+            if ((sim_sram_dma.next + words) > SIM_SRAM_WORDS)
+            {
+                words = SIM_SRAM_WORDS - sim_sram_dma.next;
+            }
+            if (!Sim_Sram_Dma_Block(sim_sram_dma.next, words))
+            {
+                status = ERROR_STATUS;
+            }
+            sim_sram_dma.next += words;
+        }
+    }
+    return Sim_Test_Result("Sram_Dma_Test_Step", status);
+}
+
+uintptr_t Sram_Dma_Test_Get_Error_Address(void)
+{
+    return sim_sram_dma.error_address;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,314 @@
+/******************************************************************************
+* File Name:   sim_tcpwm.c
+*
+* Description: This file contains the TCPWM counter model of the host native build.
+*              The counters run on an independent clock and raise their interrupt at
+*              the terminal count.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "sim.h"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Counter model */
+typedef struct
+{
+    bool initialized;
+    bool enabled;
+    bool running;
+    uint32_t period;        /* Terminal count */
+    uint32_t prescaler;     /* log2 of the clock prescaler */
+    uint32_t count;
+    uint32_t int_mask;
+    uint32_t int_status;
+    uint64_t acc;           /* Clock accumulator, see Sim_Clock_Ticks() */
+} sim_tcpwm_counter_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* TCPWM group of the clock test and interrupt test counters */
+TCPWM_Type sim_tcpwm0 = {0u};
+
+static sim_tcpwm_counter_t sim_cnt[SIM_TCPWM_COUNTERS];
+
+/*****************************************************************************
+* Function Name: Sim_Tcpwm_Counter
+******************************************************************************
+* Summary:
+* Returns the model of a counter.
+*
+* Parameters:
+*  base:   TCPWM group
+*  cntNum: Counter number
+*
+* Return:
+*  sim_tcpwm_counter_t *: Counter model, NULL for an invalid counter
+*****************************************************************************/
+static sim_tcpwm_counter_t *Sim_Tcpwm_Counter(TCPWM_Type const *base, uint32_t cntNum)
+{
+    if ((base != &sim_tcpwm0) || (cntNum >= SIM_TCPWM_COUNTERS))
+    {
+        return NULL;
+    }
+    return &sim_cnt[cntNum];
+}
+
+/*****************************************************************************
+* Function Name: Sim_Tcpwm_Reset
+******************************************************************************
+* Summary:
+* Resets all counters.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Tcpwm_Reset(void)
+{
+    memset(sim_cnt, 0, sizeof(sim_cnt));
+}
+
+/*****************************************************************************
+* Function Name: Sim_Tcpwm_Cycles_To_Event
+******************************************************************************
+* Summary:
+* Returns the CPU cycles until the next terminal count of a running counter.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t: CPU cycles, UINT64_MAX if no counter runs
+*****************************************************************************/
+uint64_t Sim_Tcpwm_Cycles_To_Event(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint32_t num;
+
+    for (num = 0u; num < SIM_TCPWM_COUNTERS; num++)
+    {
+        if (sim_cnt[num].running)
+        {
+            uint64_t ticks = (uint64_t)(sim_cnt[num].period - sim_cnt[num].count) + 1u;
+            uint64_t cycles = Sim_Clock_Cycles_Until(sim_cnt[num].acc,
+                                                     SIM_TCPWM_CLK_HZ >> sim_cnt[num].prescaler,
+                                                     ticks);
+            if (cycles < next)
+            {
+                next = cycles;
+            }
+        }
+    }
+    return next;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Tcpwm_Elapse
+******************************************************************************
+* Summary:
+* Advances the running counters. A counter that passes its terminal count
+* wraps to 0, sets its TC interrupt and raises its interrupt line if the TC
+* interrupt is enabled.
+*
+* Parameters:
+*  cycles: Elapsed CPU cycles
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Tcpwm_Elapse(uint64_t cycles)
+{
+    uint32_t num;
+
+    for (num = 0u; num < SIM_TCPWM_COUNTERS; num++)
+    {
+        if (sim_cnt[num].running)
+        {
+            uint64_t ticks = Sim_Clock_Ticks(&sim_cnt[num].acc,
+                                             SIM_TCPWM_CLK_HZ >> sim_cnt[num].prescaler, cycles);
+            uint64_t count = (uint64_t)sim_cnt[num].count + ticks;
+
+            if (count > sim_cnt[num].period)
+            {
+                sim_cnt[num].count = (uint32_t)((count - sim_cnt[num].period - 1u) %
+                                                ((uint64_t)sim_cnt[num].period + 1u));
+                sim_cnt[num].int_status |= CY_TCPWM_INT_ON_TC;
+                if (0u != (sim_cnt[num].int_mask & CY_TCPWM_INT_ON_TC))
+                {
+                    Sim_Irq_Raise(SIM_TCPWM_IRQ_BASE + (IRQn_Type)num);
+                }
+            }
+            else
+            {
+                sim_cnt[num].count = (uint32_t)count;
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* PDL TCPWM counter functions
+*******************************************************************************/
+cy_en_tcpwm_status_t Cy_TCPWM_Counter_Init(TCPWM_Type *base, uint32_t cntNum,
+                                           const cy_stc_tcpwm_counter_config_t *config)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    if ((NULL == cnt) || (NULL == config) || (0u == config->period))
+    {
+        return CY_TCPWM_BAD_PARAM;
+    }
+    memset(cnt, 0, sizeof(*cnt));
+    cnt->initialized = true;
+    cnt->period = config->period;
+    cnt->prescaler = config->clockPrescaler;
+    cnt->int_mask = config->interruptSources;
+    return CY_TCPWM_SUCCESS;
+}
+
+void Cy_TCPWM_Counter_DeInit(TCPWM_Type *base, uint32_t cntNum)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    if (NULL != cnt)
+    {
+        memset(cnt, 0, sizeof(*cnt));
+    }
+}
+
+void Cy_TCPWM_Counter_Enable(TCPWM_Type *base, uint32_t cntNum)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    if ((NULL != cnt) && cnt->initialized)
+    {
+        cnt->enabled = true;
+    }
+}
+
+void Cy_TCPWM_Counter_Disable(TCPWM_Type *base, uint32_t cntNum)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    if (NULL != cnt)
+    {
+        cnt->enabled = false;
+        cnt->running = false;
+    }
+}
+
+uint32_t Cy_TCPWM_Counter_GetCounter(TCPWM_Type const *base, uint32_t cntNum)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    return (NULL != cnt) ? cnt->count : 0u;
+}
+
+void Cy_TCPWM_Counter_SetCounter(TCPWM_Type *base, uint32_t cntNum, uint32_t count)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    if (NULL != cnt)
+    {
+        cnt->count = (count > cnt->period) ? cnt->period : count;
+        cnt->acc = 0u;
+    }
+}
+
+uint32_t Cy_TCPWM_Counter_GetPeriod(TCPWM_Type const *base, uint32_t cntNum)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    return (NULL != cnt) ? cnt->period : 0u;
+}
+
+void Cy_TCPWM_TriggerStart_Single(TCPWM_Type *base, uint32_t cntNum)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    if ((NULL != cnt) && cnt->enabled)
+    {
+        cnt->running = true;
+    }
+}
+
+void Cy_TCPWM_TriggerStopOrKill_Single(TCPWM_Type *base, uint32_t cntNum)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    if (NULL != cnt)
+    {
+        cnt->running = false;
+    }
+}
+
+void Cy_TCPWM_SetInterruptMask(TCPWM_Type *base, uint32_t cntNum, uint32_t source)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    if (NULL != cnt)
+    {
+        cnt->int_mask = source;
+    }
+}
+
+uint32_t Cy_TCPWM_GetInterruptStatus(TCPWM_Type const *base, uint32_t cntNum)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    return (NULL != cnt) ? cnt->int_status : 0u;
+}
+
+void Cy_TCPWM_ClearInterrupt(TCPWM_Type *base, uint32_t cntNum, uint32_t source)
+{
+    sim_tcpwm_counter_t *cnt = Sim_Tcpwm_Counter(base, cntNum);
+
+    if (NULL != cnt)
+    {
+        cnt->int_status &= ~source;
+    }
+}
+
+/* [] END OF FILE */
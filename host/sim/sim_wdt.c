@@ -0,0 +1,265 @@
+/******************************************************************************
+* File Name:   sim_wdt.c
+*
+* Description: This file contains the WDT model of the host native build: a 16-bit
+*              counter on the ILO that resets the device on the third unhandled match
+*              interrupt.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Width of the WDT counter */
+#define SIM_WDT_COUNTER_BITS            (16u)
+
+/* Unhandled match interrupts before the reset (the reset is taken on the
+ * third match) */
+#define SIM_WDT_UNHANDLED_LIMIT         (2u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static struct
+{
+    bool enabled;
+    bool locked;
+    uint32_t ignore_bits;
+    uint32_t match;
+    uint32_t count;
+    bool int_pending;
+    uint32_t unhandled;     /* Match interrupts while the previous one was pending */
+    uint64_t acc;           /* ILO accumulator, see Sim_Clock_Ticks() */
+} sim_wdt;
+
+/*****************************************************************************
+* Function Name: Sim_Wdt_Period
+******************************************************************************
+* Summary:
+* Returns the number of ILO ticks between two match events. The ignore bits
+* remove the upper bits of the counter from the match.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: ILO ticks
+*****************************************************************************/
+static uint32_t Sim_Wdt_Period(void)
+{
+    return 1UL << (SIM_WDT_COUNTER_BITS - sim_wdt.ignore_bits);
+}
+
+/*****************************************************************************
+* Function Name: Sim_Wdt_Reset
+******************************************************************************
+* Summary:
+* Resets the WDT: disabled and locked, as left by SystemInit().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Wdt_Reset(void)
+{
+    memset(&sim_wdt, 0, sizeof(sim_wdt));
+    sim_wdt.locked = true;
+}
+
+/*****************************************************************************
+* Function Name: Sim_Wdt_Cycles_To_Event
+******************************************************************************
+* Summary:
+* Returns the CPU cycles until the next match event.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint64_t: CPU cycles, UINT64_MAX if the WDT does not count
+*****************************************************************************/
+uint64_t Sim_Wdt_Cycles_To_Event(void)
+{
+    uint32_t period = Sim_Wdt_Period();
+    uint32_t phase;
+
+    if ((!sim_wdt.enabled) || Sim_Fault_Active(SIM_FAULT_WDT_STUCK))
+    {
+        return UINT64_MAX;
+    }
+    phase = (sim_wdt.match - sim_wdt.count) & (period - 1u);
+    return Sim_Clock_Cycles_Until(sim_wdt.acc, SIM_ILO_HZ, (0u == phase) ? period : phase);
+}
+
+/*****************************************************************************
+* Function Name: Sim_Wdt_Elapse
+******************************************************************************
+* Summary:
+* Advances the WDT counter. On a match the interrupt is set; the third
+* match without Cy_WDT_ClearInterrupt() in between resets the device.
+* SIM_FAULT_WDT_STUCK stops the counter.
+*
+* Parameters:
+*  cycles: Elapsed CPU cycles
+*
+* Return:
+*  void
+*****************************************************************************/
+void Sim_Wdt_Elapse(uint64_t cycles)
+{
+    uint32_t period = Sim_Wdt_Period();
+    uint64_t ticks;
+
+    if ((!sim_wdt.enabled) || Sim_Fault_Active(SIM_FAULT_WDT_STUCK))
+    {
+        return;
+    }
+    ticks = Sim_Clock_Ticks(&sim_wdt.acc, SIM_ILO_HZ, cycles);
+    while (ticks > 0u)
+    {
+        uint32_t phase = (sim_wdt.match - sim_wdt.count) & (period - 1u);
+        uint64_t step = (0u == phase) ? period : phase;
+
+        if (ticks < step)
+        {
+            sim_wdt.count = (uint32_t)(sim_wdt.count + ticks) & ((1UL << SIM_WDT_COUNTER_BITS) - 1u);
+            break;
+        }
+        ticks -= step;
+        sim_wdt.count = (uint32_t)(sim_wdt.count + step) & ((1UL << SIM_WDT_COUNTER_BITS) - 1u);
+
+        if (sim_wdt.int_pending)
+        {
+            sim_wdt.unhandled++;
+            if (sim_wdt.unhandled >= SIM_WDT_UNHANDLED_LIMIT)
+            {
+                Sim_Reset(CY_SYSLIB_RESET_HWWDT);
+            }
+        }
+        sim_wdt.int_pending = true;
+    }
+}
+
+/*******************************************************************************
+* PDL WDT functions. Configuration writes are ignored while the WDT is locked.
+*******************************************************************************/
+void Cy_WDT_Enable(void)
+{
+    if (!sim_wdt.locked)
+    {
+        sim_wdt.enabled = true;
+    }
+}
+
+void Cy_WDT_Disable(void)
+{
+    if (!sim_wdt.locked)
+    {
+        sim_wdt.enabled = false;
+    }
+}
+
+bool Cy_WDT_IsEnabled(void)
+{
+    return sim_wdt.enabled;
+}
+
+void Cy_WDT_Lock(void)
+{
+    sim_wdt.locked = true;
+}
+
+void Cy_WDT_Unlock(void)
+{
+    sim_wdt.locked = false;
+}
+
+bool Cy_WDT_Locked(void)
+{
+    return sim_wdt.locked;
+}
+
+void Cy_WDT_SetMatch(uint32_t match)
+{
+    if (!sim_wdt.locked)
+    {
+        sim_wdt.match = match & ((1UL << SIM_WDT_COUNTER_BITS) - 1u);
+    }
+}
+
+uint32_t Cy_WDT_GetMatch(void)
+{
+    return sim_wdt.match;
+}
+
+uint32_t Cy_WDT_GetCount(void)
+{
+    return sim_wdt.count;
+}
+
+void Cy_WDT_SetIgnoreBits(uint32_t bitsNum)
+{
+    if ((!sim_wdt.locked) && (bitsNum < SIM_WDT_COUNTER_BITS))
+    {
+        sim_wdt.ignore_bits = bitsNum;
+    }
+}
+
+uint32_t Cy_WDT_GetIgnoreBits(void)
+{
+    return sim_wdt.ignore_bits;
+}
+
+void Cy_WDT_ClearInterrupt(void)
+{
+    sim_wdt.int_pending = false;
+    sim_wdt.unhandled = 0u;
+}
+
+void Cy_WDT_ClearWatchdog(void)
+{
+    Cy_WDT_ClearInterrupt();
+}
+
+/* [] END OF FILE */
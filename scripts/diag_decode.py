@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+################################################################################
+# \file diag_decode.py
+# \version 1.0
+#
+# \brief
+# Decodes the binary dump of the diagnostic log (source/diag_log.h) from a
+# capture of the debug UART output. The dump is found by its magic words; the
+# last dump of the capture is decoded. Records with a bad CRC, cut by a reset
+# while they were written, are dropped. The records are sorted by their
+# sequence number and grouped by boot. The test names are taken from the
+# result table printed in the same capture, when present.
+#
+# Usage:
+#   python3 diag_decode.py [--mhz f] [--csv] capture
+#
+################################################################################
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import csv
+import re
+import struct
+import sys
+
+# Layout of diag_log_t and diag_log_record_t, little endian
+MAGIC = 0x474F4C44
+VERSION = 1
+HEADER = struct.Struct("<IIHHI")
+RECORD = struct.Struct("<IIIBBBB")
+
+TYPE_BOOT = 1
+TYPE_RESULT = 2
+TYPE_FAULT = 3
+
+STATUS_NAMES = {0: "SUCCESS", 1: "ERROR", 2: "SUCCESS", 3: "IN PROGRESS"}
+FAULT_NAMES = {1: "IO", 2: "CHECKSUM", 3: "STACK", 4: "ADDRESS", 5: "SIGNATURE", 6: "CLOCK"}
+STACK_ERRORS = {0x04: "overflow", 0x08: "underflow"}
+
+# CY_SYSLIB_RESET_xx bits, no bit set: power-on or XRES
+RESET_NAMES = [(0x00001, "HWWDT"), (0x00002, "ACT_FAULT"), (0x00004, "DPSLP_FAULT"),
+               (0x00008, "TC_DBGRESET"), (0x00010, "SOFT"), (0x00020, "SWWDT0"),
+               (0x00040, "SWWDT1"), (0x00080, "SWWDT2"), (0x00100, "SWWDT3"),
+               (0x10000, "CSV_WCO_LOSS"), (0x40000, "HIB_WAKEUP")]
+
+# "| 3   | Flash Test                      | SUCCESS     |"
+ROW_RE = re.compile(rb"\|\s*(\d+)\s*\|\s*([^|\r\n]*?)\s*\|\s*(?:SUCCESS|ERROR|IN PROGRESS)")
+
+
+def crc8(data):
+    """CRC-8, polynomial 0x07, initial value 0, as Diag_Log_Crc()."""
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def find_log(capture):
+    """Returns the offset of the last valid log header in the capture."""
+    found = None
+    start = 0
+    magic = struct.pack("<I", MAGIC)
+    while True:
+        offset = capture.find(magic, start)
+        if offset < 0:
+            return found
+        start = offset + 1
+        if offset + HEADER.size > len(capture):
+            continue
+        _, magic_inv, version, records, _ = HEADER.unpack_from(capture, offset)
+        if (magic_inv == MAGIC ^ 0xFFFFFFFF and version == VERSION and
+                offset + HEADER.size + records * RECORD.size <= len(capture)):
+            found = offset
+
+
+def test_names(capture):
+    """Returns the test names by table index from the result table."""
+    return {int(m.group(1)): m.group(2).decode("ascii", "replace")
+            for m in ROW_RE.finditer(capture)}
+
+
+def reset_reason(value):
+    names = [name for bit, name in RESET_NAMES if value & bit]
+    return "|".join(names) if names else "POWER_ON/XRES"
+
+
+def describe(record, names):
+    """Returns the test and the text of a record."""
+    seq, _, detail, rtype, test, status = record
+    if rtype == TYPE_BOOT:
+        return "", "BOOT reset 0x%08X %s" % (detail, reset_reason(detail))
+    name = "%d %s" % (test, names.get(test, "?"))
+    if rtype == TYPE_RESULT:
+        return name, "RESULT %s" % STATUS_NAMES.get(status, "status %d" % status)
+    if rtype == TYPE_FAULT:
+        kind = FAULT_NAMES.get(status, "kind %d" % status)
+        if status == 1:
+            text = "PORT %d[%d]" % (detail >> 8, detail & 0xFF)
+        elif status == 3:
+            text = STACK_ERRORS.get(detail & 0x0C, "0x%02X" % detail)
+        elif status == 6:
+            # Clock of the monitor, signed 24-bit deviation
+            deviation = (detail & 0xFFFFFF) - ((detail & 0x800000) << 1)
+            text = "clock %d %+d ppm" % (detail >> 24, deviation)
+        else:
+            text = "0x%08X" % detail
+        return name, "FAULT %s %s" % (kind, text)
+    return name, "type %d detail 0x%08X" % (rtype, detail)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the diagnostic log dump")
+    parser.add_argument("capture", help="capture of the debug UART output")
+    parser.add_argument("--mhz", type=float, help="CPU clock, prints the deltas in us")
+    parser.add_argument("--csv", action="store_true", help="print the records as CSV")
+    args = parser.parse_args()
+
+    with open(args.capture, "rb") as capture_file:
+        capture = capture_file.read()
+    offset = find_log(capture)
+    if offset is None:
+        print("error: no diagnostic log in %s" % args.capture, file=sys.stderr)
+        return 1
+    _, _, _, count, next_seq = HEADER.unpack_from(capture, offset)
+    names = test_names(capture[:offset])
+
+    records = []
+    dropped = 0
+    for i in range(count):
+        start = offset + HEADER.size + i * RECORD.size
+        raw = capture[start:start + RECORD.size]
+        seq, cycles, detail, rtype, test, status, crc = RECORD.unpack(raw)
+        if seq == 0:
+            continue
+        if crc8(raw[:-1]) != crc:
+            dropped += 1
+            continue
+        records.append((seq, cycles, detail, rtype, test, status))
+    records.sort()
+
+    rows = []
+    boot = 0
+    previous = None
+    for record in records:
+        seq, cycles = record[0], record[1]
+        if record[3] == TYPE_BOOT:
+            boot += 1
+            previous = None
+        # The cycle counter restarts with every boot and wraps after 2^32
+        delta = (cycles - previous) & 0xFFFFFFFF if previous is not None else None
+        previous = cycles
+        test, text = describe(record, names)
+        rows.append((boot, seq, cycles, delta, test, text))
+
+    if args.csv:
+        writer = csv.writer(sys.stdout, lineterminator="\n")
+        writer.writerow(["boot", "seq", "cycles", "delta", "test", "record"])
+        for row in rows:
+            writer.writerow(["" if v is None else v for v in row])
+        return 0
+
+    print("diagnostic log: %d records, next sequence %d, %d dropped (bad CRC)" %
+          (len(records), next_seq, dropped))
+    for boot_row, seq, cycles, delta, test, text in rows:
+        if text.startswith("BOOT"):
+            print("boot %d" % boot_row)
+        elif boot_row == 0 and seq == rows[0][1]:
+            print("boot 0 (boot record overwritten)")
+        if delta is None:
+            delta_text = ""
+        elif args.mhz:
+            delta_text = "+%.1f us" % (delta / args.mhz)
+        else:
+            delta_text = "+%d" % delta
+        print("  %6d %10d %14s  %-36s %s" % (seq, cycles, delta_text, test, text))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
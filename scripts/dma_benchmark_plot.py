@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+################################################################################
+# \file dma_benchmark_plot.py
+# \version 1.0
+#
+# \brief
+# Extracts the DMA benchmark CSV from one or more captured UART logs (one per
+# target) and plots/compares the sustained throughput in bytes per CPU cycle.
+#
+# Usage:
+#   python3 dma_benchmark_plot.py [--out DIR] LOG [LOG ...]
+#
+# Each LOG is a terminal capture that contains the block printed between
+# #DMA_BENCHMARK_CSV_BEGIN and #DMA_BENCHMARK_CSV_END. The file name (without
+# extension) is used as the target label. A summary of the best configuration
+# per engine/source/contention is always printed; plots are written to DIR
+# when matplotlib is installed.
+#
+################################################################################
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import csv
+import os
+import sys
+from collections import defaultdict
+
+CSV_BEGIN = "#DMA_BENCHMARK_CSV_BEGIN"
+CSV_END = "#DMA_BENCHMARK_CSV_END"
+INT_FIELDS = ("size", "width", "chain", "contention", "cycles", "cpu_ops")
+
+
+def read_log(path):
+    """Returns the benchmark rows found in a captured log as dicts."""
+    lines = []
+    inside = False
+    with open(path, encoding="utf-8", errors="replace") as log:
+        for line in log:
+            line = line.strip()
+            if line.startswith(CSV_BEGIN):
+                inside, lines = True, []
+            elif line.startswith(CSV_END):
+                inside = False
+            elif inside and line:
+                lines.append(line)
+    rows = []
+    for row in csv.DictReader(lines):
+        for field in INT_FIELDS:
+            row[field] = int(row[field])
+        row["bytes_per_cycle"] = float(row["bytes_per_cycle"])
+        rows.append(row)
+    return rows
+
+
+def summarize(target, rows):
+    """Prints the best configuration per engine, source and contention."""
+    best = {}
+    for row in rows:
+        if row["result"] != "OK":
+            print("%s: FAILED %s" % (target, row))
+            continue
+        key = (row["engine"], row["src"], row["contention"])
+        if key not in best or row["bytes_per_cycle"] > best[key]["bytes_per_cycle"]:
+            best[key] = row
+    print("\n%s" % target)
+    print("%-5s %-6s %-10s %6s %5s %5s %15s" %
+          ("eng", "src", "contention", "size", "width", "chain", "bytes/cycle"))
+    for key in sorted(best):
+        row = best[key]
+        print("%-5s %-6s %-10s %6d %5d %5d %15.3f" %
+              (row["engine"], row["src"], "yes" if row["contention"] else "no",
+               row["size"], row["width"], row["chain"], row["bytes_per_cycle"]))
+
+
+def plot(results, out_dir):
+    """Plots bytes/cycle over transfer size, one figure per engine/source/width."""
+    try:
+        import matplotlib
+        matplotlib.use("Agg")
+        import matplotlib.pyplot as plt
+    except ImportError:
+        print("\nmatplotlib not installed, skipping plots")
+        return
+
+    os.makedirs(out_dir, exist_ok=True)
+    groups = defaultdict(list)
+    for target, rows in results.items():
+        for row in rows:
+            if row["result"] == "OK":
+                groups[(row["engine"], row["src"], row["width"])].append((target, row))
+
+    for (engine, src, width), entries in sorted(groups.items()):
+        series = defaultdict(list)
+        for target, row in entries:
+            label = "%s chain=%d%s" % (target, row["chain"],
+                                       " +cpu" if row["contention"] else "")
+            series[label].append((row["size"], row["bytes_per_cycle"]))
+        fig, axis = plt.subplots(figsize=(8, 5))
+        for label, points in sorted(series.items()):
+            points.sort()
+            axis.plot([p[0] for p in points], [p[1] for p in points], marker="o", label=label)
+        axis.set_xscale("log", base=2)
+        axis.set_xlabel("transfer size [bytes]")
+        axis.set_ylabel("bytes per CPU cycle")
+        axis.set_title("%s %s->SRAM, %d-byte elements" % (engine, src, width))
+        axis.grid(True, which="both", alpha=0.3)
+        axis.legend(fontsize="x-small", ncol=2)
+        name = "dma_%s_%s_w%d.png" % (engine.lower(), src.lower(), width)
+        fig.savefig(os.path.join(out_dir, name), dpi=120, bbox_inches="tight")
+        plt.close(fig)
+    print("\nplots written to %s" % out_dir)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Plot and compare DMA benchmark results")
+    parser.add_argument("logs", nargs="+", help="captured UART logs, one per target")
+    parser.add_argument("--out", default="dma_benchmark_plots", help="output directory for plots")
+    args = parser.parse_args()
+
+    results = {}
+    for path in args.logs:
+        rows = read_log(path)
+        if not rows:
+            print("%s: no benchmark data found" % path, file=sys.stderr)
+            continue
+        results[os.path.splitext(os.path.basename(path))[0]] = rows
+
+    if not results:
+        return 1
+    for target, rows in results.items():
+        summarize(target, rows)
+    plot(results, args.out)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,323 @@
+#!/usr/bin/env python3
+################################################################################
+# \file flash_regions.py
+# \version 1.0
+#
+# \brief
+# Generates source/flash_regions_sums.h, the reference checksums of the
+# multi-region flash test, from the region lists of source/flash_regions.h
+# and the Intel HEX image of the application. The lists are the ones the
+# firmware is built with: the regions, their algorithm, slice budget and
+# deadline are read from the header, not repeated here. Flash bytes that are
+# not in the image are read as the erased value (--fill).
+#
+# The checksums are stored in the .flash_region_sums section, outside of
+# every region: rebuilding the application with the generated header does
+# not change the checksums. The checksums of the other device are kept.
+#
+# Usage:
+#   python3 flash_regions.py --device cat1c --hex app.hex [-D NAME=value]...
+#                            [--fill 0xFF] [--period-ms 1] [--check] [--out file]
+#   (FLASH_END_ADDR of the SelfTest library must be given with -D, for
+#   example -D FLASH_END_ADDR=0x101FFFF8 for 2 MB of PSoC 6 flash)
+#
+################################################################################
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import array
+import os
+import re
+import sys
+import zlib
+
+DEVICES = ("CAT1A", "CAT1C")
+
+COMMENT_RE = re.compile(r"//[^\n]*|/\*.*?\*/", re.S)
+DEFINE_RE = re.compile(r"^[ \t]*#[ \t]*define[ \t]+([A-Za-z_]\w*)(\(([^)]*)\))?[ \t]*(.*)$", re.M)
+NAME_RE = re.compile(r"\b[A-Za-z_]\w*\b")
+SUFFIX_RE = re.compile(r"\b(0[xX][0-9a-fA-F]+|\d+)[uUlL]+\b")
+SUM_RE = re.compile(r"#define\s+FLASH_REGION_SUM_(CAT1[AC])_(\w+)\s+\((0x[0-9A-Fa-f]+)ULL\)")
+IMAGE_RE = re.compile(r"/\* (CAT1[AC]): (.*) \*/")
+
+FLETCHER_MOD = 0xFFFFFFFF
+
+
+class Region:
+    def __init__(self, name, base, size, algorithm, words, deadline):
+        self.name = name
+        self.base = base
+        self.size = size
+        self.algorithm = algorithm
+        self.words = words
+        self.deadline = deadline
+        self.sum = 0
+        self.loaded = 0
+
+
+def parse_header(path):
+    """Returns the object-like macros and the region lists of the header.
+    Each list entry is the list of its argument texts."""
+    with open(path, encoding="utf-8") as header:
+        text = COMMENT_RE.sub(" ", header.read()).replace("\\\n", " ")
+    defines = {}
+    lists = {}
+    for match in DEFINE_RE.finditer(text):
+        name, params, body = match.group(1), match.group(2), match.group(4).strip()
+        if name.startswith("FLASH_REGION_LIST_") and params:
+            lists[name[len("FLASH_REGION_LIST_"):]] = split_entries(body)
+        elif not params:
+            defines.setdefault(name, body)
+    return defines, lists
+
+
+def split_args(text):
+    """Splits a macro argument list at its top level commas."""
+    args, depth, current = [], 0, ""
+    for char in text:
+        if char == "," and depth == 0:
+            args.append(current.strip())
+            current = ""
+            continue
+        depth += (char == "(") - (char == ")")
+        current += char
+    args.append(current.strip())
+    return args
+
+
+def split_entries(body):
+    """Returns the X(...) entries of a region list."""
+    entries = []
+    i = 0
+    while True:
+        i = body.find("X(", i)
+        if i < 0:
+            return entries
+        depth, j = 0, i + 1
+        while True:
+            depth += (body[j] == "(") - (body[j] == ")")
+            if depth == 0:
+                break
+            j += 1
+        entries.append(split_args(body[i + 2:j]))
+        i = j + 1
+
+
+def evaluate(expr, defines, depth=0):
+    """Evaluates an integer expression of the header."""
+    if depth > 16:
+        raise ValueError("recursive macro in %s" % expr)
+
+    def expand(match):
+        name = match.group(0)
+        if name not in defines:
+            raise ValueError("unknown macro %s, give its value with -D %s=..." % (name, name))
+        return "(%d)" % evaluate(defines[name], defines, depth + 1)
+
+    text = SUFFIX_RE.sub(r"\1", expr)
+    text = NAME_RE.sub(lambda m: m.group(0) if re.match(r"0[xX]", m.group(0)) else expand(m),
+                       text)
+    if not re.match(r"^[0-9a-fA-FxX+\-*/()<>|&~ \t]*$", text):
+        raise ValueError("unsupported expression %s" % expr)
+    return int(eval(text.replace("/", "//"), {"__builtins__": {}}))
+
+
+def regions_of(entries, defines):
+    regions = []
+    for args in entries:
+        if len(args) != 6:
+            raise ValueError("invalid region %s" % ", ".join(args))
+        name = args[0]
+        values = [evaluate(a, defines) for a in args[1:]]
+        region = Region(name, *values)
+        if region.size <= 0 or region.size % 4 or region.base % 4:
+            raise ValueError("region %s: base and size must be multiples of 4" % name)
+        if region.words <= 0 or region.deadline <= 0:
+            raise ValueError("region %s: invalid slice or deadline" % name)
+        regions.append(region)
+    return regions
+
+
+def read_hex(path):
+    """Returns the data records of an Intel HEX file as (address, bytes)."""
+    chunks = []
+    upper = 0
+    with open(path, encoding="ascii") as image:
+        for number, line in enumerate(image, 1):
+            line = line.strip()
+            if not line:
+                continue
+            if not line.startswith(":"):
+                raise ValueError("%s:%d: not an Intel HEX record" % (path, number))
+            record = bytes.fromhex(line[1:])
+            if len(record) < 5 or len(record) != record[0] + 5 or sum(record) & 0xFF:
+                raise ValueError("%s:%d: invalid record" % (path, number))
+            address = (record[1] << 8) | record[2]
+            kind, data = record[3], record[4:-1]
+            if kind == 0:
+                chunks.append((upper + address, data))
+            elif kind == 1:
+                break
+            elif kind == 2:
+                upper = int.from_bytes(data, "big") << 4
+            elif kind == 4:
+                upper = int.from_bytes(data, "big") << 16
+    return chunks
+
+
+def checksum(region, data):
+    """Checksum of a region, as Flash_Regions_Slice()."""
+    if region.algorithm == 1:
+        return zlib.crc32(data) & 0xFFFFFFFF
+    words = array.array("I")
+    if words.itemsize != 4:
+        words = array.array("L")
+    words.frombytes(bytes(data))
+    if sys.byteorder != "little":
+        words.byteswap()
+    sum1 = sum2 = 0
+    for word in words:
+        sum1 += word
+        if sum1 >= FLETCHER_MOD:
+            sum1 -= FLETCHER_MOD
+        sum2 += sum1
+        if sum2 >= FLETCHER_MOD:
+            sum2 -= FLETCHER_MOD
+    return (sum2 << 32) | sum1
+
+
+def load(regions, chunks, fill):
+    for region in regions:
+        data = bytearray([fill]) * region.size
+        end = region.base + region.size
+        for address, chunk in chunks:
+            start, stop = max(address, region.base), min(address + len(chunk), end)
+            if start < stop:
+                data[start - region.base:stop - region.base] = \
+                    chunk[start - address:stop - address]
+                region.loaded += stop - start
+        region.sum = checksum(region, data)
+
+
+def load_permille(regions, period_ms):
+    """Load of the steps, as Flash_Regions_Load_Permille()."""
+    total = 0
+    for region in regions:
+        slices = (region.size // 4 + region.words - 1) // region.words
+        total += slices * period_ms * 1000 // region.deadline
+    return total
+
+
+def render(names, sums, images):
+    out = ["/* Generated by scripts/flash_regions.py - do not edit. */",
+           "/* FLASH_REGION_SUM_<device>_<region>: reference checksum of a region of",
+           " * flash_regions.h, the CRC-32 in the low word */",
+           "#ifndef FLASH_REGIONS_SUMS_H_",
+           "#define FLASH_REGIONS_SUMS_H_"]
+    for device in DEVICES:
+        out.append("")
+        out.append("/* %s: %s */" % (device, images.get(device, "no image")))
+        width = max([len(n) for n in names[device]] + [1]) + len(device) + 20
+        for name in names[device]:
+            macro = "FLASH_REGION_SUM_%s_%s" % (device, name)
+            out.append("#define %-*s (0x%016XULL)" % (width, macro, sums.get((device, name), 0)))
+    out.append("")
+    out.append("#endif /* FLASH_REGIONS_SUMS_H_ */")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    source_dir = os.path.normpath(os.path.join(here, "..", "source"))
+    parser = argparse.ArgumentParser(description="Generate the flash region checksums")
+    parser.add_argument("--device", required=True, choices=[d.lower() for d in DEVICES],
+                        help="region list of the image")
+    parser.add_argument("--hex", help="Intel HEX image of the application")
+    parser.add_argument("-D", dest="defines", action="append", default=[],
+                        metavar="NAME=value", help="value of a macro of the region list")
+    parser.add_argument("--fill", type=lambda v: int(v, 0), default=0x00,
+                        help="erased flash value (default 0x00)")
+    parser.add_argument("--period-ms", type=int, default=1,
+                        help="time between two steps, for the load (default 1)")
+    parser.add_argument("--header", default=os.path.join(source_dir, "flash_regions.h"),
+                        help="region lists")
+    parser.add_argument("--out", default=os.path.join(source_dir, "flash_regions_sums.h"),
+                        help="generated header")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the generated header is not up to date, do not write it")
+    args = parser.parse_args()
+    device = args.device.upper()
+
+    try:
+        defines, lists = parse_header(args.header)
+        for define in args.defines:
+            name, _, value = define.partition("=")
+            defines[name] = value
+        names = {d: [e[0] for e in lists.get(d, [])] for d in DEVICES}
+        if not names[device]:
+            raise ValueError("no region list FLASH_REGION_LIST_%s in %s" % (device, args.header))
+
+        # Checksums of the other device, and the image of each device
+        sums, images = {}, {}
+        try:
+            with open(args.out, encoding="utf-8") as current:
+                current_text = current.read()
+        except OSError:
+            current_text = None
+        for match in SUM_RE.finditer(current_text or ""):
+            if match.group(1) != device:
+                sums[(match.group(1), match.group(2))] = int(match.group(3), 16)
+        for match in IMAGE_RE.finditer(current_text or ""):
+            if match.group(1) != device:
+                images[match.group(1)] = match.group(2)
+
+        if args.hex:
+            regions = regions_of(lists[device], defines)
+            load(regions, read_hex(args.hex), args.fill)
+            images[device] = os.path.basename(args.hex)
+            print("%-12s %-10s %-10s %-9s %6s %-18s %7s %9s" % ("region", "base", "size",
+                  "algorithm", "image", "checksum", "slices", "deadline"))
+            for region in regions:
+                sums[(device, region.name)] = region.sum
+                print("%-12s 0x%08X 0x%08X %-9s %5d%% 0x%016X %7d %7dms" % (
+                    region.name, region.base, region.size,
+                    "CRC32" if region.algorithm == 1 else "FLETCHER64",
+                    100 * region.loaded // region.size, region.sum,
+                    (region.size // 4 + region.words - 1) // region.words, region.deadline))
+            permille = load_permille(regions, args.period_ms)
+            print("load %d permille with one step every %d ms%s" % (
+                permille, args.period_ms, "" if permille <= 1000 else ": deadlines will be missed"))
+    except (OSError, ValueError) as error:
+        print("error: %s" % error, file=sys.stderr)
+        return 1
+
+    text = render(names, sums, images)
+    if args.check:
+        if current_text != text:
+            print("error: %s is not up to date, run scripts/flash_regions.py" % args.out,
+                  file=sys.stderr)
+            return 1
+        return 0
+    with open(args.out, "w", encoding="utf-8", newline="\n") as header:
+        header.write(text)
+    print("wrote " + args.out)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
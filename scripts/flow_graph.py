@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+################################################################################
+# \file flow_graph.py
+# \version 1.0
+#
+# \brief
+# Builds the expected flow graph of the program flow monitor from the
+# FLOW_MONITOR_INIT/FLOW_CHECKPOINT/FLOW_VERIFY checkpoints of the sources and
+# generates source/flow_monitor_sigs.h.
+#
+# Every checkpoint X gets a running signature S_X and an update constant
+# D_X = S_P ^ S_X, where P is any predecessor of X. All predecessors of a
+# checkpoint must therefore share one signature: checkpoints are grouped into
+# classes of shared predecessors and each class gets a distinct signature.
+# The tool then checks every legal transition and every illegal transition
+# (a checkpoint reached from a checkpoint that is not its predecessor) against
+# the generated constants. Illegal transitions between checkpoints of the same
+# class cannot be detected and are reported.
+#
+# Usage:
+#   python3 flow_graph.py [--check] [--strict] [--dot graph.dot] [sources...]
+#   (default sources: ../source/*.c ../source/*.h)
+#
+################################################################################
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import glob
+import os
+import random
+import re
+import sys
+
+CHECKPOINT_RE = re.compile(r"\b(FLOW_MONITOR_INIT|FLOW_CHECKPOINT|FLOW_VERIFY)\s*\(([^()]*)\)")
+COMMENT_RE = re.compile(r"//[^\n]*|/\*.*?\*/", re.S)
+DIRECTIVE_RE = re.compile(r"^[ \t]*#(?:[^\n]*\\\n)*[^\n]*", re.M)
+NAME_RE = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+
+# Minimum Hamming distance between two class signatures
+MIN_DISTANCE = 8
+# Seed of the signature generator: the same graph gives the same header
+SEED = 0x5AFE5AFE
+# Length and number of the random legal walks
+WALK_STEPS = 64
+WALKS = 256
+
+
+class Node:
+    def __init__(self, name, preds, entry, where):
+        self.name = name
+        self.preds = preds
+        self.entry = entry
+        self.where = where
+        self.succs = []
+        self.sig = None
+        self.delta = None
+
+
+def strip(text):
+    """Replaces comments and preprocessor directives (the macro definitions)
+    with blanks, keeping the line numbers."""
+    blank = lambda m: re.sub(r"[^\n]", " ", m.group(0))
+    return DIRECTIVE_RE.sub(blank, COMMENT_RE.sub(blank, text))
+
+
+def parse(paths):
+    """Returns the checkpoints of the sources by name."""
+    nodes = {}
+    errors = []
+    for path in paths:
+        with open(path, encoding="utf-8", errors="replace") as source:
+            text = strip(source.read())
+        for match in CHECKPOINT_RE.finditer(text):
+            line = text.count("\n", 0, match.start()) + 1
+            where = "%s:%d" % (os.path.basename(path), line)
+            args = [a.strip() for a in match.group(2).split(",")]
+            if not all(NAME_RE.match(a) for a in args):
+                errors.append("%s: invalid checkpoint %s" % (where, match.group(0)))
+                continue
+            entry = match.group(1) == "FLOW_MONITOR_INIT"
+            name, preds = args[0], list(dict.fromkeys(args[1:]))
+            if entry and preds:
+                errors.append("%s: entry checkpoint %s has predecessors" % (where, name))
+            if not entry and not preds:
+                errors.append("%s: checkpoint %s has no predecessor" % (where, name))
+            if name in nodes:
+                errors.append("%s: checkpoint %s already at %s" % (where, name, nodes[name].where))
+                continue
+            nodes[name] = Node(name, preds, entry, where)
+    for node in nodes.values():
+        for pred in node.preds:
+            if pred not in nodes:
+                errors.append("%s: unknown predecessor %s of %s" % (node.where, pred, node.name))
+            else:
+                nodes[pred].succs.append(node.name)
+    return nodes, errors
+
+
+def assign(nodes):
+    """Groups the predecessors of each checkpoint into one class and assigns
+    the signatures and update constants. Returns the classes."""
+    parent = {name: name for name in nodes}
+
+    def find(name):
+        while parent[name] != name:
+            parent[name] = parent[parent[name]]
+            name = parent[name]
+        return name
+
+    for node in nodes.values():
+        for pred in node.preds[1:]:
+            parent[find(pred)] = find(node.preds[0])
+
+    classes = {}
+    for name in sorted(nodes):
+        classes.setdefault(find(name), []).append(name)
+
+    rng = random.Random(SEED)
+    used = []
+    for members in sorted(classes.values()):
+        while True:
+            sig = rng.getrandbits(32)
+            if sig != 0 and all(bin(sig ^ u).count("1") >= MIN_DISTANCE for u in used):
+                break
+        used.append(sig)
+        for name in members:
+            nodes[name].sig = sig
+    for node in nodes.values():
+        node.delta = 0 if node.entry else nodes[node.preds[0]].sig ^ node.sig
+    return sorted(classes.values())
+
+
+def verify(nodes):
+    """Runs the legal and illegal transitions on the generated constants.
+    Returns the list of errors and the undetected illegal transitions."""
+    errors = []
+    for node in nodes.values():
+        for pred in node.preds:
+            if nodes[pred].sig ^ node.delta != node.sig:
+                errors.append("legal transition %s -> %s fails" % (pred, node.name))
+
+    # Random walks along legal transitions never fail a check
+    valid = set(n.sig for n in nodes.values())
+    rng = random.Random(SEED)
+    entries = sorted(n.name for n in nodes.values() if n.entry)
+    for _ in range(WALKS if entries else 0):
+        current = rng.choice(entries)
+        signature = nodes[current].sig
+        for _ in range(WALK_STEPS):
+            succs = nodes[current].succs
+            if not succs:
+                break
+            current = rng.choice(succs)
+            signature ^= nodes[current].delta
+            if signature != nodes[current].sig or signature not in valid:
+                errors.append("legal walk fails at %s" % current)
+                break
+
+    undetected = []
+    for node in nodes.values():
+        for source in nodes.values():
+            if node.entry or source.name in node.preds:
+                continue
+            if source.sig ^ node.delta == node.sig:
+                undetected.append((source.name, node.name))
+    return errors, sorted(undetected)
+
+
+def render(nodes):
+    """Returns the text of flow_monitor_sigs.h."""
+    width = max([len(name) for name in nodes] + [1]) + 8
+    out = ["/* Generated by scripts/flow_graph.py - do not edit. */",
+           "/* FLOW_S_x: running signature after checkpoint x",
+           " * FLOW_D_x: update constant of checkpoint x, FLOW_S_x ^ FLOW_S_<predecessor> */",
+           "#ifndef FLOW_MONITOR_SIGS_H_",
+           "#define FLOW_MONITOR_SIGS_H_",
+           ""]
+    for name in sorted(nodes):
+        node = nodes[name]
+        out.append("/* %s%s */" % (node.where.split(":")[0], ", entry" if node.entry else
+                                    ", from " + ", ".join(node.preds)))
+        out.append("#define %-*s (0x%08XUL)" % (width, "FLOW_S_" + name, node.sig))
+        out.append("#define %-*s (0x%08XUL)" % (width, "FLOW_D_" + name, node.delta))
+    sigs = sorted(set(n.sig for n in nodes.values()))
+    out.append("")
+    out.append("/* Running signatures of all checkpoints, sorted */")
+    out.append("#define FLOW_MONITOR_SIGNATURE_COUNT (%du)" % max(len(sigs), 1))
+    out.append("#define FLOW_MONITOR_SIGNATURES \\")
+    out.append("    {%s}" % ", ".join("0x%08XUL" % s for s in sigs) if sigs else "    {0UL}")
+    out.append("")
+    out.append("#endif /* FLOW_MONITOR_SIGS_H_ */")
+    return "\n".join(out) + "\n"
+
+
+def render_dot(nodes):
+    """Returns the expected flow graph in Graphviz format."""
+    out = ["digraph flow {"]
+    for name in sorted(nodes):
+        node = nodes[name]
+        out.append('    %s [label="%s\\n0x%08X"%s];' % (name, name, node.sig,
+                                                       ", shape=box" if node.entry else ""))
+        for pred in node.preds:
+            out.append("    %s -> %s;" % (pred, name))
+    out.append("}")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    source_dir = os.path.normpath(os.path.join(here, "..", "source"))
+    parser = argparse.ArgumentParser(description="Generate the program flow monitor signatures")
+    parser.add_argument("sources", nargs="*", help="annotated sources (default: source/*.c *.h)")
+    parser.add_argument("--out", default=os.path.join(source_dir, "flow_monitor_sigs.h"),
+                        help="generated header")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if the generated header is not up to date, do not write it")
+    parser.add_argument("--strict", action="store_true",
+                        help="fail if an illegal transition is not detected")
+    parser.add_argument("--dot", help="write the flow graph in Graphviz format")
+    args = parser.parse_args()
+
+    paths = args.sources or sorted(glob.glob(os.path.join(source_dir, "*.c")) +
+                                   glob.glob(os.path.join(source_dir, "*.h")))
+    nodes, errors = parse(paths)
+    if errors:
+        for error in errors:
+            print("error: " + error, file=sys.stderr)
+        return 1
+
+    classes = assign(nodes)
+    errors, undetected = verify(nodes)
+    for error in errors:
+        print("error: " + error, file=sys.stderr)
+
+    illegal = sum(len(nodes) - len(n.preds) for n in nodes.values() if not n.entry)
+    print("%d checkpoints, %d signature classes, %d legal transitions" %
+          (len(nodes), len(classes), sum(len(n.preds) for n in nodes.values())))
+    print("%d of %d illegal transitions detected" % (illegal - len(undetected), illegal))
+    for source, target in undetected:
+        print("  undetected: %s -> %s (%s shares the signature of a predecessor)" %
+              (source, target, source))
+
+    text = render(nodes)
+    if args.check:
+        try:
+            with open(args.out, encoding="utf-8") as header:
+                current = header.read()
+        except OSError:
+            current = None
+        if current != text:
+            print("error: %s is not up to date, run scripts/flow_graph.py" % args.out,
+                  file=sys.stderr)
+            errors.append("stale header")
+    elif not errors:
+        with open(args.out, "w", encoding="utf-8", newline="\n") as header:
+            header.write(text)
+        print("wrote " + args.out)
+    if args.dot:
+        with open(args.dot, "w", encoding="utf-8") as dot:
+            dot.write(render_dot(nodes))
+
+    if errors or (args.strict and undetected):
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
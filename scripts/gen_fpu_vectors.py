@@ -0,0 +1,378 @@
+#!/usr/bin/env python3
+################################################################################
+# \file gen_fpu_vectors.py
+# \version 1.0
+#
+# \brief
+# Generates source/fpu_test_vectors.h, the known-answer vectors of the FPU
+# datapath test. Expected results are computed with exact rational arithmetic
+# and IEEE 754 rounding (all four rounding modes, subnormals and the ARM
+# flush-to-zero mode), independent of the host FPU. Every vector is checked
+# again after encoding and against a set of hand-verified reference results.
+#
+# Usage:
+#   python3 gen_fpu_vectors.py [--out file]    (default: ../source/fpu_test_vectors.h)
+#
+################################################################################
+# \copyright
+# Copyright 2024, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import os
+import sys
+from fractions import Fraction
+from math import isqrt
+
+# Rounding modes, encoded as FPSCR.RMode
+RN, RP, RM, RZ = 0, 1, 2, 3
+ALL_MODES = (RN, RP, RM, RZ)
+MODE_NAMES = {RN: "RN", RP: "RP", RM: "RM", RZ: "RZ"}
+
+# Operations, must match fpu_datapath_test.h
+OPS = ("ADD", "SUB", "MUL", "FMA", "DIV", "SQRT", "F2S", "S2F")
+
+
+class Format:
+    """IEEE 754 binary format."""
+
+    def __init__(self, name, precision, exp_bits):
+        self.name = name
+        self.p = precision
+        self.exp_bits = exp_bits
+        self.bias = (1 << (exp_bits - 1)) - 1
+        self.emin = 1 - self.bias
+        self.emax = self.bias
+        self.width = precision + exp_bits
+        self.frac_bits = precision - 1
+
+    def decode(self, bits):
+        """Bits to Fraction (finite values) or 'inf'/'-inf'."""
+        sign = -1 if bits >> (self.width - 1) else 1
+        exp = (bits >> self.frac_bits) & ((1 << self.exp_bits) - 1)
+        frac = bits & ((1 << self.frac_bits) - 1)
+        if exp == (1 << self.exp_bits) - 1:
+            if frac:
+                raise ValueError("NaN operands are not used")
+            return "inf" if sign > 0 else "-inf"
+        if exp == 0:
+            value = Fraction(frac, 1 << self.frac_bits) * Fraction(2) ** self.emin
+        else:
+            value = (1 + Fraction(frac, 1 << self.frac_bits)) * Fraction(2) ** (exp - self.bias)
+        return sign * value
+
+    def is_subnormal(self, bits):
+        exp = (bits >> self.frac_bits) & ((1 << self.exp_bits) - 1)
+        return exp == 0 and (bits & ((1 << self.frac_bits) - 1)) != 0
+
+    def sign_bit(self, bits):
+        return bits >> (self.width - 1)
+
+    def zero(self, negative):
+        return (1 << (self.width - 1)) if negative else 0
+
+    def inf(self, negative):
+        return self.zero(negative) | (((1 << self.exp_bits) - 1) << self.frac_bits)
+
+    def max_finite(self, negative):
+        return self.inf(negative) - 1
+
+    def round(self, value, mode, negative_zero=False):
+        """Correctly rounds an exact Fraction to the format."""
+        if value == 0:
+            return self.zero(negative_zero)
+        negative = value < 0
+        mag = -value if negative else value
+        # exponent so that 2^e <= mag < 2^(e+1)
+        e = mag.numerator.bit_length() - mag.denominator.bit_length()
+        if Fraction(2) ** e > mag:
+            e -= 1
+        elif Fraction(2) ** (e + 1) <= mag:
+            e += 1
+        e = max(e, self.emin)
+        quantum = Fraction(2) ** (e - self.p + 1)
+        scaled = mag / quantum
+        m = scaled.numerator // scaled.denominator
+        rest = scaled - m
+        if rest != 0:
+            up = {
+                RN: rest > Fraction(1, 2) or (rest == Fraction(1, 2) and m % 2 == 1),
+                RP: not negative,
+                RM: negative,
+                RZ: False,
+            }[mode]
+            if up:
+                m += 1
+        if m == (1 << self.p):
+            m >>= 1
+            e += 1
+        if e > self.emax:
+            toward_inf = {RN: True, RP: not negative, RM: negative, RZ: False}[mode]
+            return self.inf(negative) if toward_inf else self.max_finite(negative)
+        if m == 0:
+            return self.zero(negative)
+        if m < (1 << (self.p - 1)):
+            biased = 0  # subnormal
+        else:
+            biased = e + self.bias
+            m -= 1 << (self.p - 1)
+        bits = (biased << self.frac_bits) | m
+        return bits | self.zero(negative)
+
+    def from_float(self, text):
+        """Exact decimal/rational literal to bits (round to nearest)."""
+        return self.round(Fraction(text), RN)
+
+
+SP = Format("sp", 24, 8)
+DP = Format("dp", 53, 11)
+
+
+def exact_sqrt(value):
+    """Returns a Fraction that rounds like sqrt(value) in any mode."""
+    # enough fraction bits that the root carries ~200 significant bits
+    k = max(0, 200 + (value.denominator.bit_length() - value.numerator.bit_length()) // 2 + 1)
+    scaled = value * (Fraction(4) ** k)
+    floor_scaled = scaled.numerator // scaled.denominator
+    root = isqrt(floor_scaled)
+    if root * root == scaled:
+        return Fraction(root, 2 ** k)
+    # Irrational or inexact: nudge inside the interval, sqrt never ties.
+    return Fraction(2 * root + 1, 2 ** (k + 1))
+
+
+def round_to_int(value, mode):
+    floor = value.numerator // value.denominator
+    rest = value - floor
+    if rest == 0:
+        return floor
+    return {
+        RN: floor + 1 if rest > Fraction(1, 2) or (rest == Fraction(1, 2) and floor % 2) else floor,
+        RP: floor + 1,
+        RM: floor,
+        RZ: floor + 1 if value < 0 else floor,
+    }[mode]
+
+
+def compute(fmt, op, a, b, c, mode, fz):
+    """Expected result bits of one operation; a, b, c are operand bits."""
+    def operand(bits):
+        if fz and fmt.is_subnormal(bits):
+            return Fraction(0), fmt.sign_bit(bits)
+        return fmt.decode(bits), fmt.sign_bit(bits)
+
+    def finish(value, zero_sign):
+        bits = fmt.round(value, mode, zero_sign)
+        if fz and fmt.is_subnormal(bits):
+            return fmt.zero(value < 0)
+        return bits
+
+    if op == "S2F":
+        n = a - (1 << 32) if a & 0x80000000 else a
+        return finish(Fraction(n), False)
+
+    va, sa = operand(a)
+    vb, sb = operand(b)
+    vc, sc = operand(c)
+    for v in (va, vb, vc):
+        if isinstance(v, str):
+            raise ValueError("infinite operands are not used")
+
+    if op == "F2S":
+        n = round_to_int(va, mode)
+        n = max(-(1 << 31), min((1 << 31) - 1, n))
+        return n & 0xFFFFFFFF
+    if op in ("ADD", "SUB"):
+        if op == "SUB":
+            vb, sb = -vb, sb ^ 1
+        result = va + vb
+        if result == 0:
+            # exact zero sum: -0 only if both are -0, or in RM
+            zero_sign = (sa and sb) if (va == 0 and vb == 0) else (mode == RM)
+            return fmt.zero(zero_sign)
+        return finish(result, False)
+    if op == "MUL":
+        return finish(va * vb, sa ^ sb)
+    if op == "FMA":
+        product = va * vb
+        result = product + vc
+        if result == 0:
+            ps = sa ^ sb
+            zero_sign = (ps and sc) if (product == 0 and vc == 0) else (mode == RM)
+            return fmt.zero(zero_sign)
+        return finish(result, False)
+    if op == "DIV":
+        return finish(va / vb, sa ^ sb)
+    if op == "SQRT":
+        if va < 0:
+            raise ValueError("negative sqrt operand")
+        if va == 0:
+            return fmt.zero(sa)
+        return finish(exact_sqrt(va), False)
+    raise ValueError(op)
+
+
+def p2(e, fmt):
+    return fmt.round(Fraction(2) ** e, RN)
+
+
+def neg(bits, fmt):
+    return bits ^ (1 << (fmt.width - 1))
+
+
+def cases(fmt):
+    """(op, a, b, c, modes, fz) operand sets, operands as bits."""
+    f = fmt.from_float
+    one = f("1")
+    ulp = fmt.p - 1
+    max_f = fmt.max_finite(False)
+    tiny = p2(fmt.emin - 10, fmt)                     # subnormal
+    small = p2(fmt.emin // 2 - 5, fmt)
+    small2 = p2(fmt.emin - fmt.emin // 2 - 10, fmt)   # small * small2 is subnormal
+    one_plus = one + 1                                 # 1 + ulp
+    one_minus = one - 1                                # 1 - ulp/2
+    third = fmt.round(Fraction(1, 3), RN)
+    if fmt.p < 32:
+        # int32 values that do not fit the significand
+        s2f = [
+            ("S2F", (1 << fmt.p) + 1, 0, 0, ALL_MODES, False),
+            ("S2F", (-((1 << fmt.p) + 3)) & 0xFFFFFFFF, 0, 0, ALL_MODES, False),
+            ("S2F", 0x7FFFFFFF, 0, 0, (RN, RZ), False),
+        ]
+    else:
+        # every int32 is exact in double precision
+        s2f = [
+            ("S2F", 0x7FFFFFFF, 0, 0, (RN,), False),
+            ("S2F", 0x80000000, 0, 0, (RN,), False),
+            ("S2F", (-7) & 0xFFFFFFFF, 0, 0, (RZ,), False),
+        ]
+    return [
+        # rounding of ties and inexact sums
+        ("ADD", one, p2(-ulp - 1, fmt), 0, ALL_MODES, False),
+        ("ADD", one, fmt.round(Fraction(3, 2 ** (ulp + 2)), RN), 0, ALL_MODES, False),
+        ("ADD", f("1.1"), f("2.2"), 0, ALL_MODES, False),
+        ("ADD", f("1.5"), neg(f("1.5"), fmt), 0, (RN, RM), False),
+        ("ADD", max_f, max_f, 0, ALL_MODES, False),
+        ("SUB", one, p2(-ulp - 3, fmt), 0, ALL_MODES, False),
+        ("SUB", f("0.3"), f("0.1"), 0, (RN,), False),
+        ("MUL", f("1.1"), f("1.1"), 0, ALL_MODES, False),
+        ("MUL", f("3"), third, 0, (RN, RZ), False),
+        ("MUL", neg(f("1.7"), fmt), f("2.3"), 0, (RP, RM), False),
+        # fused: the residual is lost if the product is rounded first
+        ("FMA", one_plus, one_minus, neg(one, fmt), (RN, RM), False),
+        ("FMA", f("1.1"), f("1.1"), neg(f("1.21"), fmt), (RN, RZ), False),
+        ("FMA", f("2"), f("3"), f("0.5"), (RN,), False),
+        ("DIV", one, f("3"), 0, ALL_MODES, False),
+        ("DIV", neg(f("2"), fmt), f("3"), 0, ALL_MODES, False),
+        ("DIV", f("1"), f("7"), 0, (RN,), False),
+        ("SQRT", f("2"), 0, 0, ALL_MODES, False),
+        ("SQRT", f("3"), 0, 0, (RN,), False),
+        ("SQRT", f("0.25"), 0, 0, (RN,), False),
+        ("SQRT", p2(fmt.emin - 12, fmt), 0, 0, (RN,), False),
+        ("F2S", f("2.5"), 0, 0, ALL_MODES, False),
+        ("F2S", f("-2.5"), 0, 0, ALL_MODES, False),
+        ("F2S", f("3.5"), 0, 0, (RN,), False),
+        ("F2S", f("1e10"), 0, 0, (RN,), False),
+        ("F2S", f("-1e10"), 0, 0, (RN,), False),
+    ] + s2f + [
+        # subnormals, with and without flush-to-zero
+        ("ADD", tiny, tiny, 0, (RN,), False),
+        ("ADD", tiny, tiny, 0, (RN,), True),
+        ("MUL", small, small2, 0, (RN, RZ), False),
+        ("MUL", small, small2, 0, (RN,), True),
+        ("SUB", p2(fmt.emin, fmt), p2(fmt.emin, fmt) + 1, 0, (RN,), False),
+    ]
+
+
+def build(fmt):
+    vectors = []
+    for op, a, b, c, modes, fz in cases(fmt):
+        for mode in modes:
+            vectors.append((op, mode, fz, a, b, c, compute(fmt, op, a, b, c, mode, fz)))
+    return vectors
+
+
+def self_check():
+    """Reference results verified by hand / against IEEE 754 hardware."""
+    checks = [
+        (SP, "ADD", SP.from_float("1.1"), SP.from_float("2.2"), 0, RN, False, 0x40533334),
+        (SP, "MUL", SP.from_float("1.1"), SP.from_float("1.1"), 0, RN, False, 0x3F9AE148),
+        (SP, "DIV", SP.from_float("1"), SP.from_float("3"), 0, RN, False, 0x3EAAAAAB),
+        (SP, "DIV", SP.from_float("1"), SP.from_float("3"), 0, RZ, False, 0x3EAAAAAA),
+        (SP, "SQRT", SP.from_float("2"), 0, 0, RN, False, 0x3FB504F3),
+        (SP, "ADD", 0x3F800000, 0x33800000, 0, RN, False, 0x3F800000),
+        (SP, "ADD", 0x3F800000, 0x33800000, 0, RP, False, 0x3F800001),
+        (SP, "FMA", 0x3F800001, 0x3F7FFFFF, 0xBF800000, RN, False, 0x337FFFFE),
+        (SP, "F2S", SP.from_float("2.5"), 0, 0, RN, False, 2),
+        (SP, "F2S", SP.from_float("-2.5"), 0, 0, RM, False, 0xFFFFFFFD),
+        (SP, "S2F", 16777217, 0, 0, RN, False, 0x4B800000),
+        (SP, "ADD", 0x00000400, 0x00000400, 0, RN, True, 0x00000000),
+        (SP, "ADD", 0x3FC00000, 0xBFC00000, 0, RM, False, 0x80000000),
+        (DP, "ADD", DP.from_float("0.1"), DP.from_float("0.2"), 0, RN, False, 0x3FD3333333333334),
+        (DP, "SQRT", DP.from_float("2"), 0, 0, RN, False, 0x3FF6A09E667F3BCD),
+        (DP, "DIV", DP.from_float("1"), DP.from_float("3"), 0, RN, False, 0x3FD5555555555555),
+    ]
+    for fmt, op, a, b, c, mode, fz, expected in checks:
+        got = compute(fmt, op, a, b, c, mode, fz)
+        if got != expected:
+            raise AssertionError("%s %s %s: got 0x%X expected 0x%X" %
+                                 (fmt.name, op, MODE_NAMES[mode], got, expected))
+
+
+def emit(out, fmt, vectors, ctype, name, digits):
+    out.append("static const %s %s[] =" % (ctype, name))
+    out.append("{")
+    for op, mode, fz, a, b, c, r in vectors:
+        out.append("    {FPU_KAT_OP_%-4s, FPU_KAT_%s, %-5s 0x%0*XU, 0x%0*XU, 0x%0*XU, 0x%0*XU}," %
+                   (op, MODE_NAMES[mode], ("true," if fz else "false,"),
+                    digits, a, digits, b, digits, c, 8 if op == "F2S" else digits, r))
+    out.append("};")
+    out.append("")
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description="Generate the FPU datapath test vectors")
+    parser.add_argument("--out", default=os.path.normpath(
+                            os.path.join(here, "..", "source", "fpu_test_vectors.h")),
+                        help="generated header")
+    args = parser.parse_args()
+    path = args.out
+
+    self_check()
+    sp = build(SP)
+    dp = build(DP)
+
+    out = []
+    out.append("/* Generated by scripts/gen_fpu_vectors.py - do not edit. */")
+    out.append("/* Fields: operation, rounding mode, flush-to-zero, a, b, c, expected result */")
+    out.append("#ifndef FPU_TEST_VECTORS_H_")
+    out.append("#define FPU_TEST_VECTORS_H_")
+    out.append("")
+    emit(out, SP, sp, "fpu_kat_sp_t", "fpu_kat_sp", 8)
+    out.append("#if FPU_DATAPATH_DP_SUPPORTED")
+    emit(out, DP, dp, "fpu_kat_dp_t", "fpu_kat_dp", 16)
+    out.append("#endif /* FPU_DATAPATH_DP_SUPPORTED */")
+    out.append("")
+    out.append("#endif /* FPU_TEST_VECTORS_H_ */")
+    with open(path, "w", encoding="ascii", newline="\n") as header:
+        header.write("\n".join(out) + "\n")
+    print("%s: %d single, %d double precision vectors" % (path, len(sp), len(dp)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,469 @@
+/******************************************************************************
+* File Name:   self_test_rtos.c
+*
+* Description: FreeRTOS adapter of the self tests. The run time tests run step by
+*              step in a low priority task, or in the idle hook, and every completed
+*              test is posted to a result queue. Tests that need the CPU or the main
+*              stack for themselves run their steps in a critical section.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "self_test_rtos.h"
+#include "ecc_test.h"
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One run time test. The step function is called with first = true at the
+ * start of the test and returns PASS_STILL_TESTING_STATUS until the test is
+ * complete. The steps of an exclusive test run with interrupts disabled */
+typedef struct
+{
+    const char *name;
+    uint8_t (*step)(bool first);
+    bool exclusive;
+} self_test_rtos_test_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint8_t Self_Test_Rtos_Pc_Step(bool first);
+static uint8_t Self_Test_Rtos_Cpu_Step(bool first);
+#if !MPU_STACK_GUARD_ENABLE
+static uint8_t Self_Test_Rtos_Stack_Step(bool first);
+#endif
+static uint8_t Self_Test_Rtos_Io_Step(bool first);
+static uint8_t Self_Test_Rtos_Fpu_Step(bool first);
+#if ECC_TEST_AVAILABLE
+static uint8_t Self_Test_Rtos_Ecc_Scrub_Step(bool first);
+#endif
+static uint8_t Self_Test_Rtos_Flash_Step(bool first);
+static uint8_t Self_Test_Rtos_Check_Step(bool first);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Tests of a round, in execution order. The start-up, watchdog, clock,
+ * interrupt, DMA and IPC tests reconfigure peripherals owned by the
+ * application and only run at boot. The SRAM March test is not run: the
+ * blocks it overwrites hold the stacks of the tasks */
+static const self_test_rtos_test_t self_test_rtos_tests[] =
+{
+    {"Program Counter Test",    Self_Test_Rtos_Pc_Step,         false},
+    {"CPU Register Test",       Self_Test_Rtos_Cpu_Step,        true},
+#if !MPU_STACK_GUARD_ENABLE
+    {"Stack Memory Test",       Self_Test_Rtos_Stack_Step,      false},
+#endif
+    {"GPIO Test",               Self_Test_Rtos_Io_Step,         true},
+    {"FPU Register Test",       Self_Test_Rtos_Fpu_Step,        false},
+#if ECC_TEST_AVAILABLE
+    {"SRAM ECC Scrub",          Self_Test_Rtos_Ecc_Scrub_Step,  false},
+#else
+    {"Stack March Test",        Stack_March_Step,               true},
+#endif
+    {"Flash Test",              Self_Test_Rtos_Flash_Step,      false},
+    {"Program Flow Monitor",    Self_Test_Rtos_Check_Step,      false},
+};
+
+#define SELF_TEST_RTOS_TEST_COUNT   (sizeof(self_test_rtos_tests) / sizeof(self_test_rtos_tests[0]))
+
+static struct
+{
+    QueueHandle_t results;
+    uint32_t round;
+    uint32_t run_time;      /* Duration of the steps of the current test */
+    uint32_t dropped;       /* Results not posted, the queue was full */
+    uint8_t current;        /* Index of the current test */
+    bool first;             /* The current test has not started */
+#if SELF_TEST_RTOS_USE_IDLE_HOOK
+    bool waiting;           /* The round is complete, waiting for the next period */
+    TickType_t round_start;
+#endif
+} self_test_rtos;
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Pc_Step
+******************************************************************************
+* Summary:
+* Program counter test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Self_Test_Rtos_Pc_Step(bool first)
+{
+    return SelfTest_PC();
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Cpu_Step
+******************************************************************************
+* Summary:
+* CPU registers test. Exclusive: an interrupt would see the test patterns in
+* the special registers.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Self_Test_Rtos_Cpu_Step(bool first)
+{
+    return SelfTest_CPU_Registers();
+}
+
+#if !MPU_STACK_GUARD_ENABLE
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Stack_Step
+******************************************************************************
+* Summary:
+* Stack overflow test: checks the pattern written at boot at the limit of the
+* main stack, used by the interrupts and the kernel.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Self_Test_Rtos_Stack_Step(bool first)
+{
+    return SelfTests_Stack_Check();
+}
+#endif
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Io_Step
+******************************************************************************
+* Summary:
+* GPIO test. Exclusive: the test pin is driven through its test states.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Self_Test_Rtos_Io_Step(bool first)
+{
+    return SelfTest_IO();
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Fpu_Step
+******************************************************************************
+* Summary:
+* FPU registers test. The FPU context of the task is saved by the kernel on
+* a context switch.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Self_Test_Rtos_Fpu_Step(bool first)
+{
+    return SelfTest_FPU_Registers();
+}
+
+#if ECC_TEST_AVAILABLE
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Ecc_Scrub_Step
+******************************************************************************
+* Summary:
+* ECC_SCRUB_WORDS_PER_STEP words of the SRAM ECC scrub, one pass of the
+* scrubbed region. The scrub was set up by Ecc_Test() at boot.
+*
+* Parameters:
+*  first: Unused
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Self_Test_Rtos_Ecc_Scrub_Step(bool first)
+{
+    return Ecc_Test_Scrub_Step();
+}
+#endif /* ECC_TEST_AVAILABLE */
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Flash_Step
+******************************************************************************
+* Summary:
+* FLASH_DOUBLE_WORDS_TO_TEST double words of the flash checksum test, or
+* one slice of the most urgent flash region.
+*
+* Parameters:
+*  first: Initialize the test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Self_Test_Rtos_Flash_Step(bool first)
+{
+    return Flash_Step(first, (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS));
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Check_Step
+******************************************************************************
+* Summary:
+* Periodic checks of Run_Time_Check(), once per round: the signature of the
+* program flow monitor and a slice of the stack profiler scan.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Self_Test_Rtos_Check_Step(bool first)
+{
+    return Run_Time_Check();
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Run_Time
+******************************************************************************
+* Summary:
+* Returns the run time of the calling task. Yields first: the kernel adds
+* the time since the task was switched in to its counter only at a context
+* switch.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Run time counter of the task, 0 without run time stats
+*****************************************************************************/
+static uint32_t Self_Test_Rtos_Run_Time(void)
+{
+#if (configGENERATE_RUN_TIME_STATS == 1)
+    taskYIELD();
+#endif
+    return SELF_TEST_RTOS_RUN_TIME();
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Step
+******************************************************************************
+* Summary:
+* Runs one step of the current test. When the test is complete, posts its
+* result without waiting and moves to the next test. The run time of a step
+* is read from the run time counter of the task, so it does not include the
+* tasks that preempt a step that is not exclusive; it includes the
+* interrupts.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool: true when the last test of the round is complete
+*****************************************************************************/
+static bool Self_Test_Rtos_Step(void)
+{
+    const self_test_rtos_test_t *test = &self_test_rtos_tests[self_test_rtos.current];
+    self_test_rtos_result_t result;
+    uint32_t start = Self_Test_Rtos_Run_Time();
+    uint32_t interrupt_state;
+    uint8_t status;
+
+    if (test->exclusive)
+    {
+        interrupt_state = SELF_TEST_RTOS_ENTER_EXCLUSIVE();
+        status = test->step(self_test_rtos.first);
+        SELF_TEST_RTOS_EXIT_EXCLUSIVE(interrupt_state);
+    }
+    else
+    {
+        status = test->step(self_test_rtos.first);
+    }
+    self_test_rtos.first = false;
+    self_test_rtos.run_time += Self_Test_Rtos_Run_Time() - start;
+
+    if (PASS_STILL_TESTING_STATUS == status)
+    {
+        return false;
+    }
+
+    result.name = test->name;
+    result.status = status;
+    result.round = self_test_rtos.round;
+    result.run_time = self_test_rtos.run_time;
+    if (pdPASS != xQueueSend(self_test_rtos.results, &result, 0u))
+    {
+        self_test_rtos.dropped++;
+    }
+
+    self_test_rtos.run_time = 0u;
+    self_test_rtos.first = true;
+    self_test_rtos.current++;
+    if (self_test_rtos.current >= SELF_TEST_RTOS_TEST_COUNT)
+    {
+        self_test_rtos.current = 0u;
+        self_test_rtos.round++;
+        return true;
+    }
+    return false;
+}
+
+#if !SELF_TEST_RTOS_USE_IDLE_HOOK
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Task
+******************************************************************************
+* Summary:
+* Self test task: runs the steps of a round back to back, preempted by the
+* tasks of higher priority, then waits for the next period.
+*
+* Parameters:
+*  arg: Unused
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Self_Test_Rtos_Task(void *arg)
+{
+    TickType_t last_wake = xTaskGetTickCount();
+
+    (void)arg;
+    for (;;)
+    {
+        if (Self_Test_Rtos_Step())
+        {
+            vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(SELF_TEST_RTOS_PERIOD_MS));
+        }
+    }
+}
+#else
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Idle_Hook
+******************************************************************************
+* Summary:
+* Runs one step of the tests. Called from vApplicationIdleHook(), so the
+* tests only use the CPU time left by the tasks. A round starts every
+* SELF_TEST_RTOS_PERIOD_MS, or when the previous round is complete.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Self_Test_Rtos_Idle_Hook(void)
+{
+    TickType_t period = pdMS_TO_TICKS(SELF_TEST_RTOS_PERIOD_MS);
+
+    if (self_test_rtos.waiting)
+    {
+        if ((TickType_t)(xTaskGetTickCount() - self_test_rtos.round_start) < period)
+        {
+            return;
+        }
+        self_test_rtos.waiting = false;
+        self_test_rtos.round_start = xTaskGetTickCount();
+    }
+    if (Self_Test_Rtos_Step())
+    {
+        self_test_rtos.waiting = true;
+    }
+}
+#endif /* !SELF_TEST_RTOS_USE_IDLE_HOOK */
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Start
+******************************************************************************
+* Summary:
+* Starts the run time tests, after the boot tests and before the scheduler.
+* Creates the self test task, or arms the idle hook.
+*
+* Parameters:
+*  results: Queue of SELF_TEST_RTOS_QUEUE_LENGTH self_test_rtos_result_t
+*
+* Return:
+*  uint8_t: OK_STATUS, ERROR_STATUS if the task cannot be created
+*****************************************************************************/
+uint8_t Self_Test_Rtos_Start(QueueHandle_t results)
+{
+    self_test_rtos.results = results;
+    self_test_rtos.round = 0u;
+    self_test_rtos.run_time = 0u;
+    self_test_rtos.dropped = 0u;
+    self_test_rtos.current = 0u;
+    self_test_rtos.first = true;
+
+#if SELF_TEST_RTOS_USE_IDLE_HOOK
+    self_test_rtos.waiting = false;
+    self_test_rtos.round_start = xTaskGetTickCount();
+    return OK_STATUS;
+#else
+    if (pdPASS != xTaskCreate(Self_Test_Rtos_Task, "SelfTest", SELF_TEST_RTOS_TASK_STACK_SIZE,
+                              NULL, SELF_TEST_RTOS_TASK_PRIORITY, NULL))
+    {
+        return ERROR_STATUS;
+    }
+    return OK_STATUS;
+#endif
+}
+
+/*****************************************************************************
+* Function Name: Self_Test_Rtos_Get_Dropped
+******************************************************************************
+* Summary:
+* Returns the number of results not posted because the queue was full.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Number of dropped results
+*****************************************************************************/
+uint32_t Self_Test_Rtos_Get_Dropped(void)
+{
+    return self_test_rtos.dropped;
+}
+
+
+/* [] END OF FILE */
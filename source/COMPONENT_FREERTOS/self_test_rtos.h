@@ -0,0 +1,124 @@
+/******************************************************************************
+* File Name:   self_test_rtos.h
+*
+* Description: Header of the FreeRTOS adapter: runs the run time self tests in a
+*              low priority task or in the idle hook and posts the results to a
+*              queue. Built with COMPONENTS=FREERTOS.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef SELF_TEST_RTOS_H_
+#define SELF_TEST_RTOS_H_
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "self_test.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* 1: the tests run from the idle hook, the application calls
+ * Self_Test_Rtos_Idle_Hook() from vApplicationIdleHook() (configUSE_IDLE_HOOK).
+ * 0: the tests run in a task created by Self_Test_Rtos_Start() */
+#ifndef SELF_TEST_RTOS_USE_IDLE_HOOK
+#define SELF_TEST_RTOS_USE_IDLE_HOOK        (0u)
+#endif
+
+/* Priority and stack size (in words) of the self test task. The task must
+ * have a lower priority than every task with a deadline */
+#define SELF_TEST_RTOS_TASK_PRIORITY        (tskIDLE_PRIORITY + 1u)
+#define SELF_TEST_RTOS_TASK_STACK_SIZE      (configMINIMAL_STACK_SIZE * 4u)
+
+/* Time from the start of a round of the tests to the start of the next round */
+#ifndef SELF_TEST_RTOS_PERIOD_MS
+#define SELF_TEST_RTOS_PERIOD_MS            (1000u)
+#endif
+
+/* Length of the result queue created by the application */
+#define SELF_TEST_RTOS_QUEUE_LENGTH         (8u)
+
+/* Run time of the task that runs the tests, the self test task or the idle
+ * task, 0 without configGENERATE_RUN_TIME_STATS. The kernel adds the time of
+ * the running task to its counter at a context switch, so the adapter
+ * yields before it reads the counter */
+#if ((configGENERATE_RUN_TIME_STATS == 1) && SELF_TEST_RTOS_USE_IDLE_HOOK)
+#define SELF_TEST_RTOS_RUN_TIME()           ((uint32_t)ulTaskGetIdleRunTimeCounter())
+#elif (configGENERATE_RUN_TIME_STATS == 1)
+#define SELF_TEST_RTOS_RUN_TIME()           ((uint32_t)ulTaskGetRunTimeCounter(NULL))
+#else
+#define SELF_TEST_RTOS_RUN_TIME()           (0u)
+#endif
+
+/* Critical section of the exclusive steps: all interrupts are disabled, also
+ * those above configMAX_SYSCALL_INTERRUPT_PRIORITY */
+#ifndef SELF_TEST_RTOS_ENTER_EXCLUSIVE
+#define SELF_TEST_RTOS_ENTER_EXCLUSIVE()        Cy_SysLib_EnterCriticalSection()
+#define SELF_TEST_RTOS_EXIT_EXCLUSIVE(state)    Cy_SysLib_ExitCriticalSection(state)
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Item of the result queue, posted when a test is complete */
+typedef struct
+{
+    const char *name;   /* Test name */
+    uint8_t status;     /* OK_STATUS, PASS_COMPLETE_STATUS or ERROR_STATUS */
+    uint32_t round;     /* Round of the tests, from 0 */
+    uint32_t run_time;  /* Run time of the test steps, in run time stats ticks,
+                         * without the time of the preempting tasks */
+} self_test_rtos_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t Self_Test_Rtos_Start(QueueHandle_t results);
+#if SELF_TEST_RTOS_USE_IDLE_HOOK
+void Self_Test_Rtos_Idle_Hook(void);
+#endif
+uint32_t Self_Test_Rtos_Get_Dropped(void);
+
+#endif /* SELF_TEST_RTOS_H_ */
+
+
+/* [] END OF FILE */
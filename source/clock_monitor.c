@@ -0,0 +1,491 @@
+/******************************************************************************
+* File Name:   clock_monitor.c
+*
+* Description: This file contains the clock tree monitor. Each enabled clock of the
+*              table is measured in a window of reference cycles: the FLL and PLL paths and
+*              the high frequency clocks with the SRSS clock measurement counters, the
+*              peripheral dividers with the TCPWM counter of the clock test, switched from
+*              divider to divider. The counter and the measurement counters run in the
+*              same window, which the measurement counters time.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "clock_monitor.h"
+
+#if CLOCK_MONITOR_ENABLE
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Clock sources */
+#define CLOCK_MONITOR_SRC_PATH      (0u)    /* CLK_PATHn: FLL, PLL or bypass */
+#define CLOCK_MONITOR_SRC_HF        (1u)    /* CLK_HFn */
+#define CLOCK_MONITOR_SRC_DIV       (2u)    /* Peripheral divider */
+
+/* Dividers that can clock the counter: on XMC7000 only the dividers of its
+ * peripheral group */
+#if COMPONENT_CAT1C
+#define CLOCK_MONITOR_DIV_ASSIGN(type, num) \
+    Cy_SysClk_PeriPclkAssignDivider(CLOCK_MONITOR_TIMER_PCLK, (type), (num))
+#define CLOCK_MONITOR_DIV_FREQ(type, num) \
+    Cy_SysClk_PeriPclkGetFrequency(CLOCK_MONITOR_TIMER_PCLK, (type), (num))
+#else
+#define CLOCK_MONITOR_DIV_ASSIGN(type, num) \
+    Cy_SysClk_PeriphAssignDivider(CLOCK_MONITOR_TIMER_PCLK, (type), (num))
+#define CLOCK_MONITOR_DIV_FREQ(type, num) \
+    Cy_SysClk_PeriphGetFrequency((type), (num))
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* A clock of the clock tree */
+typedef struct
+{
+    const char *name;
+    uint8_t source;                 /* CLOCK_MONITOR_SRC_xx */
+    uint8_t index;                  /* Path, CLK_HF or divider number */
+    cy_en_divider_types_t div_type;
+} clock_monitor_clock_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Clock tree of the kit (design.modus). The clocks that are not enabled are
+ * not measured */
+static const clock_monitor_clock_t clock_monitor_clocks[] =
+{
+#if COMPONENT_CAT1C
+    {"PATH0 FLL",   CLOCK_MONITOR_SRC_PATH, 0u,  CY_SYSCLK_DIV_8_BIT},
+    {"PATH1 PLL",   CLOCK_MONITOR_SRC_PATH, 1u,  CY_SYSCLK_DIV_8_BIT},
+    {"PATH2 PLL",   CLOCK_MONITOR_SRC_PATH, 2u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF0",     CLOCK_MONITOR_SRC_HF,   0u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF1",     CLOCK_MONITOR_SRC_HF,   1u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF2",     CLOCK_MONITOR_SRC_HF,   2u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF3",     CLOCK_MONITOR_SRC_HF,   3u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF4",     CLOCK_MONITOR_SRC_HF,   4u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF5",     CLOCK_MONITOR_SRC_HF,   5u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF6",     CLOCK_MONITOR_SRC_HF,   6u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF7",     CLOCK_MONITOR_SRC_HF,   7u,  CY_SYSCLK_DIV_8_BIT},
+    {"DIV_8[0]",    CLOCK_MONITOR_SRC_DIV,  0u,  CY_SYSCLK_DIV_8_BIT},
+    {"DIV_8[1]",    CLOCK_MONITOR_SRC_DIV,  1u,  CY_SYSCLK_DIV_8_BIT},
+#else
+    {"PATH0 FLL",   CLOCK_MONITOR_SRC_PATH, 0u,  CY_SYSCLK_DIV_8_BIT},
+    {"PATH1 PLL",   CLOCK_MONITOR_SRC_PATH, 1u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF0",     CLOCK_MONITOR_SRC_HF,   0u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF1",     CLOCK_MONITOR_SRC_HF,   1u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF2",     CLOCK_MONITOR_SRC_HF,   2u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF3",     CLOCK_MONITOR_SRC_HF,   3u,  CY_SYSCLK_DIV_8_BIT},
+    {"CLK_HF4",     CLOCK_MONITOR_SRC_HF,   4u,  CY_SYSCLK_DIV_8_BIT},
+    {"DIV_8[0]",    CLOCK_MONITOR_SRC_DIV,  0u,  CY_SYSCLK_DIV_8_BIT},
+    {"DIV_16[15]",  CLOCK_MONITOR_SRC_DIV,  15u, CY_SYSCLK_DIV_16_BIT},
+#endif
+};
+
+#define CLOCK_MONITOR_CLOCK_COUNT   (sizeof(clock_monitor_clocks) / sizeof(clock_monitor_clocks[0]))
+
+/* One measurement counter and the TCPWM counters per window */
+static const clock_monitor_ref_t clock_monitor_ref =
+{
+    .ref_hz     = CLOCK_MONITOR_REF_HZ,
+    .max_cycles = CLOCK_MONITOR_MAX_WINDOW_CYCLES,
+    .capacity   = {1u, CLOCK_MONITOR_TCPWM_COUNTERS},
+};
+
+static struct
+{
+    clock_monitor_path_t path[CLOCK_MONITOR_MEAS_MAX_PATHS];
+    uint8_t clock[CLOCK_MONITOR_MEAS_MAX_PATHS];        /* Entry of clock_monitor_clocks */
+    int32_t deviation_ppm[CLOCK_MONITOR_MEAS_MAX_PATHS];
+    clock_monitor_window_t window[CLOCK_MONITOR_MEAS_MAX_PATHS];
+    uint32_t path_count;
+    uint32_t window_count;
+    uint32_t next_window;
+    uint32_t error_path;
+} clock_monitor;
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Expected_Hz
+******************************************************************************
+* Summary:
+* Returns the configured frequency of a clock.
+*
+* Parameters:
+*  clock: Clock
+*
+* Return:
+*  uint32_t: Frequency in Hz, 0 for a clock that is not enabled
+*****************************************************************************/
+static uint32_t Clock_Monitor_Expected_Hz(const clock_monitor_clock_t *clock)
+{
+    uint32_t hz = 0u;
+
+    switch (clock->source)
+    {
+        case CLOCK_MONITOR_SRC_PATH:
+            hz = Cy_SysClk_ClkPathGetFrequency(clock->index);
+            break;
+        case CLOCK_MONITOR_SRC_HF:
+            if (Cy_SysClk_ClkHfIsEnabled(clock->index))
+            {
+                hz = Cy_SysClk_ClkHfGetFrequency(clock->index);
+            }
+            break;
+        default:
+            hz = CLOCK_MONITOR_DIV_FREQ(clock->div_type, clock->index);
+            break;
+    }
+    return hz;
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Meas_Clk
+******************************************************************************
+* Summary:
+* Returns the input of the measurement counter for a path or CLK_HF clock.
+*
+* Parameters:
+*  clock: Clock
+*
+* Return:
+*  cy_en_meas_clks_t: Measured clock
+*****************************************************************************/
+static cy_en_meas_clks_t Clock_Monitor_Meas_Clk(const clock_monitor_clock_t *clock)
+{
+    uint32_t base = (CLOCK_MONITOR_SRC_PATH == clock->source) ?
+                    (uint32_t)CY_SYSCLK_MEAS_CLK_PATH_CLK0 : (uint32_t)CY_SYSCLK_MEAS_CLK_CLK_HF0;
+
+    return (cy_en_meas_clks_t)(base + clock->index);
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Timer_Setup
+******************************************************************************
+* Summary:
+* Clocks CYBSP_CLOCK_TEST_TIMER from a divider and clears it, without
+* interrupts and with the full counter range.
+*
+* Parameters:
+*  clock: Divider
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Clock_Monitor_Timer_Setup(const clock_monitor_clock_t *clock)
+{
+    Cy_TCPWM_Counter_Disable(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM);
+    (void)CLOCK_MONITOR_DIV_ASSIGN(clock->div_type, clock->index);
+    Cy_TCPWM_SetInterruptMask(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM, CY_TCPWM_INT_NONE);
+    Cy_TCPWM_Counter_SetPeriod(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM,
+                               CLOCK_MONITOR_TCPWM_COUNTER_MAX);
+    Cy_TCPWM_Counter_Enable(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM);
+    Cy_TCPWM_Counter_SetCounter(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM, 0u);
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Timer_Restore
+******************************************************************************
+* Summary:
+* Stops CYBSP_CLOCK_TEST_TIMER and gives it back its divider and period.
+* Clock_Test_Init() sets it up again for the clock test.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Clock_Monitor_Timer_Restore(void)
+{
+    Cy_TCPWM_Counter_Disable(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM);
+    (void)CLOCK_MONITOR_DIV_ASSIGN(CLOCK_MONITOR_TIMER_DIV_TYPE, CLOCK_MONITOR_TIMER_DIV_NUM);
+    Cy_TCPWM_Counter_SetPeriod(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM,
+                               CYBSP_CLOCK_TEST_TIMER_config.period);
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Init
+******************************************************************************
+* Summary:
+* Reads the configured frequency of every clock of the table and shares the
+* reference windows between the enabled clocks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: OK_STATUS, ERROR_STATUS when a clock cannot be measured within
+*           CLOCK_MONITOR_MAX_WINDOW_CYCLES
+*****************************************************************************/
+uint8_t Clock_Monitor_Init(void)
+{
+    CY_ASSERT(CLOCK_MONITOR_CLOCK_COUNT <= CLOCK_MONITOR_MEAS_MAX_PATHS);
+
+    clock_monitor.path_count = 0u;
+    for (uint32_t i = 0u; i < CLOCK_MONITOR_CLOCK_COUNT; i++)
+    {
+        const clock_monitor_clock_t *clock = &clock_monitor_clocks[i];
+        clock_monitor_path_t *path = &clock_monitor.path[clock_monitor.path_count];
+        uint32_t hz = Clock_Monitor_Expected_Hz(clock);
+
+        if (0u == hz)
+        {
+            continue;
+        }
+        path->expected_hz = hz;
+        path->tolerance_permille = CLOCK_MONITOR_TOLERANCE_PERMILLE;
+        if (CLOCK_MONITOR_SRC_DIV == clock->source)
+        {
+            path->unit = CLOCK_MONITOR_MEAS_UNIT_TCPWM;
+            path->counter_max = CLOCK_MONITOR_TCPWM_COUNTER_MAX;
+        }
+        else
+        {
+            path->unit = CLOCK_MONITOR_MEAS_UNIT_CAL;
+            path->counter_max = CLOCK_MONITOR_CAL_COUNTER_MAX;
+        }
+        clock_monitor.clock[clock_monitor.path_count] = (uint8_t)i;
+        clock_monitor.deviation_ppm[clock_monitor.path_count] = 0;
+        clock_monitor.path_count++;
+    }
+
+    clock_monitor.window_count = Clock_Monitor_Meas_Plan(clock_monitor.path, clock_monitor.path_count,
+                                                         &clock_monitor_ref, clock_monitor.window,
+                                                         CLOCK_MONITOR_MEAS_MAX_PATHS);
+    clock_monitor.next_window = 0u;
+    clock_monitor.error_path = CLOCK_MONITOR_NO_PATH;
+    return (0u != clock_monitor.window_count) ? OK_STATUS : ERROR_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Step
+******************************************************************************
+* Summary:
+* Measures the clocks of the next window. The TCPWM counter is started with
+* the measurement counters; it runs up to one reference cycle longer than
+* the window, which the window length allows for. A window without a path
+* or CLK_HF clock is timed by measuring the IMO, which is not checked.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: ERROR_STATUS when a clock is out of tolerance or the measurement
+*           counters are busy, PASS_STILL_TESTING_STATUS while windows
+*           remain, PASS_COMPLETE_STATUS after the last window
+*****************************************************************************/
+uint8_t Clock_Monitor_Step(void)
+{
+    const clock_monitor_window_t *window = &clock_monitor.window[clock_monitor.next_window];
+    uint32_t counts[CLOCK_MONITOR_MEAS_MAX_WINDOW_PATHS];
+    uint32_t timer_path = CLOCK_MONITOR_NO_PATH;
+    uint32_t cal_path = CLOCK_MONITOR_NO_PATH;
+    cy_en_meas_clks_t cal_clk = CY_SYSCLK_MEAS_CLK_IMO;
+    cy_en_sysclk_status_t start;
+    uint32_t interrupt_state;
+    uint8_t status = PASS_STILL_TESTING_STATUS;
+
+    if (0u == clock_monitor.window_count)
+    {
+        return ERROR_STATUS;
+    }
+
+    for (uint32_t i = 0u; i < window->path_count; i++)
+    {
+        uint32_t path = window->path[i];
+
+        if (CLOCK_MONITOR_MEAS_UNIT_TCPWM == clock_monitor.path[path].unit)
+        {
+            timer_path = i;
+            Clock_Monitor_Timer_Setup(&clock_monitor_clocks[clock_monitor.clock[path]]);
+        }
+        else
+        {
+            cal_path = i;
+            cal_clk = Clock_Monitor_Meas_Clk(&clock_monitor_clocks[clock_monitor.clock[path]]);
+        }
+    }
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    start = Cy_SysClk_StartClkMeasurementCounters(CLOCK_MONITOR_REF_CLK, window->ref_cycles, cal_clk);
+    if ((CY_SYSCLK_SUCCESS == start) && (CLOCK_MONITOR_NO_PATH != timer_path))
+    {
+        Cy_TCPWM_TriggerStart_Single(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM);
+    }
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    if (CY_SYSCLK_SUCCESS == start)
+    {
+        while (!Cy_SysClk_ClkMeasurementCountersDone())
+        {
+        }
+    }
+    if (CLOCK_MONITOR_NO_PATH != timer_path)
+    {
+        Cy_TCPWM_TriggerStopOrKill_Single(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM);
+        counts[timer_path] = Cy_TCPWM_Counter_GetCounter(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM);
+        Clock_Monitor_Timer_Restore();
+    }
+    if (CY_SYSCLK_SUCCESS != start)
+    {
+        clock_monitor.error_path = window->path[0];
+        return ERROR_STATUS;
+    }
+    if (CLOCK_MONITOR_NO_PATH != cal_path)
+    {
+        uint32_t hz = Cy_SysClk_ClkMeasurementCountersGetFreq(true, CLOCK_MONITOR_REF_HZ);
+
+        counts[cal_path] = (uint32_t)(((uint64_t)hz * window->ref_cycles) / CLOCK_MONITOR_REF_HZ);
+    }
+
+    for (uint32_t i = 0u; i < window->path_count; i++)
+    {
+        uint32_t path = window->path[i];
+
+        if (!Clock_Monitor_Meas_Check(&clock_monitor.path[path], &clock_monitor_ref, window->ref_cycles,
+                                      counts[i], &clock_monitor.deviation_ppm[path]))
+        {
+            clock_monitor.error_path = path;
+            status = ERROR_STATUS;
+        }
+    }
+
+    clock_monitor.next_window++;
+    if (clock_monitor.next_window == clock_monitor.window_count)
+    {
+        clock_monitor.next_window = 0u;
+        if (ERROR_STATUS != status)
+        {
+            status = PASS_COMPLETE_STATUS;
+        }
+    }
+    return status;
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Get_Path_Count
+******************************************************************************
+* Summary:
+* Returns the number of measured clocks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Enabled clocks of the table
+*****************************************************************************/
+uint32_t Clock_Monitor_Get_Path_Count(void)
+{
+    return clock_monitor.path_count;
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Get_Window_Count
+******************************************************************************
+* Summary:
+* Returns the number of windows that measure all clocks once.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Windows
+*****************************************************************************/
+uint32_t Clock_Monitor_Get_Window_Count(void)
+{
+    return clock_monitor.window_count;
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Get_Name
+******************************************************************************
+* Summary:
+* Returns the name of a measured clock.
+*
+* Parameters:
+*  path: Index of the measured clock
+*
+* Return:
+*  const char *: Name, "?" for an invalid index
+*****************************************************************************/
+const char *Clock_Monitor_Get_Name(uint32_t path)
+{
+    return (path < clock_monitor.path_count) ?
+           clock_monitor_clocks[clock_monitor.clock[path]].name : "?";
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Get_Deviation
+******************************************************************************
+* Summary:
+* Returns the deviation of the last measurement of a clock from its
+* configured frequency.
+*
+* Parameters:
+*  path: Index of the measured clock
+*
+* Return:
+*  int32_t: Deviation in ppm, 0 before the first measurement
+*****************************************************************************/
+int32_t Clock_Monitor_Get_Deviation(uint32_t path)
+{
+    return (path < clock_monitor.path_count) ? clock_monitor.deviation_ppm[path] : 0;
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Get_Error_Path
+******************************************************************************
+* Summary:
+* Returns the clock of the last error.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Index of the measured clock, CLOCK_MONITOR_NO_PATH without error
+*****************************************************************************/
+uint32_t Clock_Monitor_Get_Error_Path(void)
+{
+    return clock_monitor.error_path;
+}
+#endif /* CLOCK_MONITOR_ENABLE */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,120 @@
+/******************************************************************************
+* File Name:   clock_monitor.h
+*
+* Description: This file contains the configuration and the declarations of the
+*              clock tree monitor. The FLL and PLL paths and the high frequency clocks are
+*              measured with the SRSS clock measurement counters, the peripheral dividers
+*              with the TCPWM counter of the clock test, against the ILO or the WCO.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef CLOCK_MONITOR_H_
+#define CLOCK_MONITOR_H_
+
+#include "self_test.h"
+#include "clock_monitor_meas.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Reference of the windows: the WCO when set, otherwise the ILO. The WCO must
+ * be enabled by the application */
+#define CLOCK_MONITOR_REF_WCO               (0u)
+
+#if CLOCK_MONITOR_REF_WCO
+#define CLOCK_MONITOR_REF_CLK               (CY_SYSCLK_MEAS_CLK_WCO)
+#define CLOCK_MONITOR_REF_HZ                (32768UL)
+/* Tolerance of the measured clocks, including the reference */
+#define CLOCK_MONITOR_TOLERANCE_PERMILLE    (20u)
+#else
+#define CLOCK_MONITOR_REF_CLK               (CY_SYSCLK_MEAS_CLK_ILO)
+#define CLOCK_MONITOR_REF_HZ                (32000UL)
+/* Tolerance of the measured clocks, including the ILO accuracy */
+#define CLOCK_MONITOR_TOLERANCE_PERMILLE    (100u)
+#endif
+
+/* Longest window, in reference cycles */
+#define CLOCK_MONITOR_MAX_WINDOW_CYCLES     (1024u)
+
+/* Counter widths: 24-bit clock measurement counter, 32-bit TCPWM counter */
+#define CLOCK_MONITOR_CAL_COUNTER_MAX       (0x00FFFFFFUL)
+#define CLOCK_MONITOR_TCPWM_COUNTER_MAX     (0xFFFFFFFFUL)
+
+/* TCPWM counters per window. The monitor uses the counter of the clock
+ * test, CYBSP_CLOCK_TEST_TIMER; Clock_Monitor_Step() reads one counter */
+#define CLOCK_MONITOR_TCPWM_COUNTERS        (1u)
+
+#if (CLOCK_MONITOR_TCPWM_COUNTERS != 1u)
+#error "CLOCK_MONITOR_TCPWM_COUNTERS: Clock_Monitor_Step() supports one TCPWM counter per window"
+#endif
+
+/* Clock input of CYBSP_CLOCK_TEST_TIMER and the divider of design.modus it is
+ * restored to after the monitor */
+#if COMPONENT_CAT1C
+#define CLOCK_MONITOR_TIMER_PCLK            (PCLK_TCPWM0_CLOCKS513)     /* tcpwm[0].group[2].cnt[1] */
+#define CLOCK_MONITOR_TIMER_DIV_TYPE        (CY_SYSCLK_DIV_8_BIT)
+#define CLOCK_MONITOR_TIMER_DIV_NUM         (1u)
+#else
+#define CLOCK_MONITOR_TIMER_PCLK            (PCLK_TCPWM0_CLOCKS0)       /* tcpwm[0].cnt[0] */
+#define CLOCK_MONITOR_TIMER_DIV_TYPE        (CY_SYSCLK_DIV_16_BIT)
+#define CLOCK_MONITOR_TIMER_DIV_NUM         (15u)
+#endif
+
+/* Path returned without error */
+#define CLOCK_MONITOR_NO_PATH               (0xFFu)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if CLOCK_MONITOR_ENABLE
+uint8_t Clock_Monitor_Init(void);
+uint8_t Clock_Monitor_Step(void);
+uint32_t Clock_Monitor_Get_Path_Count(void);
+uint32_t Clock_Monitor_Get_Window_Count(void);
+const char *Clock_Monitor_Get_Name(uint32_t path);
+int32_t Clock_Monitor_Get_Deviation(uint32_t path);
+uint32_t Clock_Monitor_Get_Error_Path(void);
+#endif
+
+#endif /* CLOCK_MONITOR_H_ */
+
+
+/* [] END OF FILE */
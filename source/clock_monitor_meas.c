@@ -0,0 +1,258 @@
+/******************************************************************************
+* File Name:   clock_monitor_meas.c
+*
+* Description: Measurement core of the clock tree monitor. A path is measured by
+*              counting its cycles in a window of reference clock cycles; the window is
+*              long enough for the counting error to stay well below the tolerance of the
+*              path and short enough for the counter not to wrap. Paths whose window
+*              limits overlap and whose counters are free share one window.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "clock_monitor_meas.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Deviation reported for a stopped clock or a window without cycles */
+#define CLOCK_MONITOR_MEAS_STOPPED_PPM      (-1000000L)
+
+/* The difference of two counts is scaled by 10^6 in 64 bits */
+#define CLOCK_MONITOR_MEAS_SCALE_LIMIT      (1ULL << 43u)
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Meas_Min_Cycles
+******************************************************************************
+* Summary:
+* Returns the shortest window for a path. Counting is off by up to one
+* cycle of the path and, for a counter started by software, by up to one
+* reference cycle of a path running at the limit of its tolerance: at that
+* limit, the error of the deviation must stay below
+* 1/CLOCK_MONITOR_MEAS_RESOLUTION of the tolerance.
+*
+* Parameters:
+*  path: Path
+*  ref:  Reference clock
+*
+* Return:
+*  uint32_t: Reference cycles, UINT32_MAX for a path without frequency or
+*            tolerance
+*****************************************************************************/
+uint32_t Clock_Monitor_Meas_Min_Cycles(const clock_monitor_path_t *path,
+                                       const clock_monitor_ref_t *ref)
+{
+    uint64_t num = (((uint64_t)ref->ref_hz * 1000u) +
+                    ((uint64_t)path->expected_hz * (1000u + path->tolerance_permille))) *
+                   CLOCK_MONITOR_MEAS_RESOLUTION;
+    uint64_t den = (uint64_t)path->expected_hz * path->tolerance_permille;
+    uint64_t cycles;
+
+    if (0u == den)
+    {
+        return UINT32_MAX;
+    }
+    cycles = (num + den - 1u) / den;
+    return (cycles > UINT32_MAX) ? UINT32_MAX : (uint32_t)cycles;
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Meas_Max_Cycles
+******************************************************************************
+* Summary:
+* Returns the longest window for a path: its counter does not wrap while
+* the path runs at the upper end of its tolerance.
+*
+* Parameters:
+*  path: Path
+*  ref:  Reference clock
+*
+* Return:
+*  uint32_t: Reference cycles, at most ref->max_cycles
+*****************************************************************************/
+uint32_t Clock_Monitor_Meas_Max_Cycles(const clock_monitor_path_t *path,
+                                       const clock_monitor_ref_t *ref)
+{
+    uint64_t den = (uint64_t)path->expected_hz * (1000u + path->tolerance_permille);
+    uint64_t cycles;
+
+    if (0u == den)
+    {
+        return 0u;
+    }
+    cycles = ((uint64_t)path->counter_max * ref->ref_hz * 1000u) / den;
+    return (cycles > ref->max_cycles) ? ref->max_cycles : (uint32_t)cycles;
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Meas_Plan
+******************************************************************************
+* Summary:
+* Distributes the paths over reference windows. A path joins the first
+* window that has a free counter of its unit and whose window limits
+* overlap its own; the window is then as short as its paths allow. The
+* windows are measured one after the other.
+*
+* Parameters:
+*  paths:       Paths, at most CLOCK_MONITOR_MEAS_MAX_PATHS
+*  path_count:  Number of paths
+*  ref:         Reference clock and counters per window
+*  windows:     Returns the windows
+*  max_windows: Size of windows
+*
+* Return:
+*  uint32_t: Number of windows, 0 when a path cannot be measured
+*****************************************************************************/
+uint32_t Clock_Monitor_Meas_Plan(const clock_monitor_path_t *paths, uint32_t path_count,
+                                 const clock_monitor_ref_t *ref,
+                                 clock_monitor_window_t *windows, uint32_t max_windows)
+{
+    uint32_t max_cycles[CLOCK_MONITOR_MEAS_MAX_PATHS];
+    uint8_t used[CLOCK_MONITOR_MEAS_MAX_PATHS][CLOCK_MONITOR_MEAS_UNITS];
+    uint32_t window_count = 0u;
+
+    if (path_count > CLOCK_MONITOR_MEAS_MAX_PATHS)
+    {
+        return 0u;
+    }
+
+    for (uint32_t p = 0u; p < path_count; p++)
+    {
+        uint32_t lo = Clock_Monitor_Meas_Min_Cycles(&paths[p], ref);
+        uint32_t hi = Clock_Monitor_Meas_Max_Cycles(&paths[p], ref);
+        uint8_t unit = paths[p].unit;
+        uint32_t w;
+
+        if ((lo > hi) || (unit >= CLOCK_MONITOR_MEAS_UNITS) || (0u == ref->capacity[unit]))
+        {
+            return 0u;
+        }
+
+        for (w = 0u; w < window_count; w++)
+        {
+            if ((windows[w].path_count < CLOCK_MONITOR_MEAS_MAX_WINDOW_PATHS) &&
+                (used[w][unit] < ref->capacity[unit]) &&
+                (lo <= max_cycles[w]) && (windows[w].ref_cycles <= hi))
+            {
+                break;
+            }
+        }
+        if (w == window_count)
+        {
+            if (window_count == max_windows)
+            {
+                return 0u;
+            }
+            windows[w].ref_cycles = lo;
+            windows[w].path_count = 0u;
+            max_cycles[w] = hi;
+            for (uint32_t u = 0u; u < CLOCK_MONITOR_MEAS_UNITS; u++)
+            {
+                used[w][u] = 0u;
+            }
+            window_count++;
+        }
+
+        windows[w].path[windows[w].path_count] = (uint8_t)p;
+        windows[w].path_count++;
+        used[w][unit]++;
+        if (lo > windows[w].ref_cycles)
+        {
+            windows[w].ref_cycles = lo;
+        }
+        if (hi < max_cycles[w])
+        {
+            max_cycles[w] = hi;
+        }
+    }
+    return window_count;
+}
+
+/*****************************************************************************
+* Function Name: Clock_Monitor_Meas_Check
+******************************************************************************
+* Summary:
+* Compares the cycles of a path counted in a window with the cycles its
+* expected frequency gives.
+*
+* Parameters:
+*  path:          Path
+*  ref:           Reference clock
+*  ref_cycles:    Length of the window
+*  count:         Cycles of the path counted in the window
+*  deviation_ppm: Returns the deviation from the expected frequency
+*
+* Return:
+*  bool: true when the deviation is within the tolerance of the path
+*****************************************************************************/
+bool Clock_Monitor_Meas_Check(const clock_monitor_path_t *path, const clock_monitor_ref_t *ref,
+                              uint32_t ref_cycles, uint32_t count, int32_t *deviation_ppm)
+{
+    uint64_t expected = (uint64_t)path->expected_hz * ref_cycles;
+    int64_t diff;
+    int64_t ppm;
+
+    if ((0u == count) || (0u == expected))
+    {
+        *deviation_ppm = CLOCK_MONITOR_MEAS_STOPPED_PPM;
+        return false;
+    }
+
+    diff = (int64_t)((uint64_t)count * ref->ref_hz) - (int64_t)expected;
+    while (expected >= CLOCK_MONITOR_MEAS_SCALE_LIMIT)
+    {
+        expected >>= 1u;
+        diff /= 2;
+    }
+    if ((diff >= (int64_t)expected) || (diff <= -(int64_t)expected))
+    {
+        /* 100% off or more */
+        ppm = (diff > 0) ? 1000000 : CLOCK_MONITOR_MEAS_STOPPED_PPM;
+    }
+    else
+    {
+        ppm = (diff * 1000000) / (int64_t)expected;
+    }
+    *deviation_ppm = (int32_t)ppm;
+
+    /* A counter at its limit may have wrapped */
+    return (count < path->counter_max) &&
+           (((ppm < 0) ? -ppm : ppm) <= ((int64_t)path->tolerance_permille * 1000));
+}
+
+
+/* [] END OF FILE */
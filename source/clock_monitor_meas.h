@@ -0,0 +1,114 @@
+/******************************************************************************
+* File Name:   clock_monitor_meas.h
+*
+* Description: This file contains the declarations of the measurement core of the
+*              clock tree monitor: window sizing, window sharing and the frequency
+*              check. It does not depend on the PDL and is also built by the host model.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef CLOCK_MONITOR_MEAS_H_
+#define CLOCK_MONITOR_MEAS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Maximum number of paths of a plan and of paths measured in one window */
+#define CLOCK_MONITOR_MEAS_MAX_PATHS        (16u)
+#define CLOCK_MONITOR_MEAS_MAX_WINDOW_PATHS (4u)
+
+/* Counters that measure a path against the reference window */
+#define CLOCK_MONITOR_MEAS_UNIT_CAL         (0u)    /* SRSS clock measurement counter */
+#define CLOCK_MONITOR_MEAS_UNIT_TCPWM       (1u)    /* TCPWM counter on a peripheral divider */
+#define CLOCK_MONITOR_MEAS_UNITS            (2u)
+
+/* The counting error of a measurement is at most 1/n of the tolerance of
+ * the path */
+#define CLOCK_MONITOR_MEAS_RESOLUTION       (4u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* A clock path and the counter that measures it */
+typedef struct
+{
+    uint32_t expected_hz;
+    uint16_t tolerance_permille;    /* Includes the tolerance of the reference */
+    uint8_t unit;                   /* CLOCK_MONITOR_MEAS_UNIT_xx */
+    uint32_t counter_max;           /* Largest count before the counter wraps */
+} clock_monitor_path_t;
+
+/* Reference clock of the windows */
+typedef struct
+{
+    uint32_t ref_hz;
+    uint32_t max_cycles;            /* Longest window */
+    uint8_t capacity[CLOCK_MONITOR_MEAS_UNITS];    /* Counters of each unit per window */
+} clock_monitor_ref_t;
+
+/* One reference window and the paths measured in it */
+typedef struct
+{
+    uint32_t ref_cycles;
+    uint8_t path_count;
+    uint8_t path[CLOCK_MONITOR_MEAS_MAX_WINDOW_PATHS];
+} clock_monitor_window_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t Clock_Monitor_Meas_Min_Cycles(const clock_monitor_path_t *path,
+                                       const clock_monitor_ref_t *ref);
+uint32_t Clock_Monitor_Meas_Max_Cycles(const clock_monitor_path_t *path,
+                                       const clock_monitor_ref_t *ref);
+uint32_t Clock_Monitor_Meas_Plan(const clock_monitor_path_t *paths, uint32_t path_count,
+                                 const clock_monitor_ref_t *ref,
+                                 clock_monitor_window_t *windows, uint32_t max_windows);
+bool Clock_Monitor_Meas_Check(const clock_monitor_path_t *path, const clock_monitor_ref_t *ref,
+                              uint32_t ref_cycles, uint32_t count, int32_t *deviation_ppm);
+
+#endif /* CLOCK_MONITOR_MEAS_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,275 @@
+/******************************************************************************
+* File Name:   diag_log.c
+*
+* Description: Post-mortem diagnostic log. Test results, fault details and reset
+*              reasons are written as CRC-8 protected records to a ring in the
+*              .noinit section, which the start-up code does not clear. The log is
+*              checked at boot, continued after a reset, and dumped in binary on
+*              the debug UART for scripts/diag_decode.py.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include <stddef.h>
+#include <string.h>
+
+#include "diag_log.h"
+
+#if DIAG_LOG_ENABLE
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bytes of a record covered by its CRC */
+#define DIAG_LOG_CRC_BYTES      (offsetof(diag_log_record_t, crc))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* CRC-8, polynomial 0x07, one table lookup per byte */
+static const uint8_t diag_log_crc_table[256] =
+{
+    0x00u, 0x07u, 0x0Eu, 0x09u, 0x1Cu, 0x1Bu, 0x12u, 0x15u,
+    0x38u, 0x3Fu, 0x36u, 0x31u, 0x24u, 0x23u, 0x2Au, 0x2Du,
+    0x70u, 0x77u, 0x7Eu, 0x79u, 0x6Cu, 0x6Bu, 0x62u, 0x65u,
+    0x48u, 0x4Fu, 0x46u, 0x41u, 0x54u, 0x53u, 0x5Au, 0x5Du,
+    0xE0u, 0xE7u, 0xEEu, 0xE9u, 0xFCu, 0xFBu, 0xF2u, 0xF5u,
+    0xD8u, 0xDFu, 0xD6u, 0xD1u, 0xC4u, 0xC3u, 0xCAu, 0xCDu,
+    0x90u, 0x97u, 0x9Eu, 0x99u, 0x8Cu, 0x8Bu, 0x82u, 0x85u,
+    0xA8u, 0xAFu, 0xA6u, 0xA1u, 0xB4u, 0xB3u, 0xBAu, 0xBDu,
+    0xC7u, 0xC0u, 0xC9u, 0xCEu, 0xDBu, 0xDCu, 0xD5u, 0xD2u,
+    0xFFu, 0xF8u, 0xF1u, 0xF6u, 0xE3u, 0xE4u, 0xEDu, 0xEAu,
+    0xB7u, 0xB0u, 0xB9u, 0xBEu, 0xABu, 0xACu, 0xA5u, 0xA2u,
+    0x8Fu, 0x88u, 0x81u, 0x86u, 0x93u, 0x94u, 0x9Du, 0x9Au,
+    0x27u, 0x20u, 0x29u, 0x2Eu, 0x3Bu, 0x3Cu, 0x35u, 0x32u,
+    0x1Fu, 0x18u, 0x11u, 0x16u, 0x03u, 0x04u, 0x0Du, 0x0Au,
+    0x57u, 0x50u, 0x59u, 0x5Eu, 0x4Bu, 0x4Cu, 0x45u, 0x42u,
+    0x6Fu, 0x68u, 0x61u, 0x66u, 0x73u, 0x74u, 0x7Du, 0x7Au,
+    0x89u, 0x8Eu, 0x87u, 0x80u, 0x95u, 0x92u, 0x9Bu, 0x9Cu,
+    0xB1u, 0xB6u, 0xBFu, 0xB8u, 0xADu, 0xAAu, 0xA3u, 0xA4u,
+    0xF9u, 0xFEu, 0xF7u, 0xF0u, 0xE5u, 0xE2u, 0xEBu, 0xECu,
+    0xC1u, 0xC6u, 0xCFu, 0xC8u, 0xDDu, 0xDAu, 0xD3u, 0xD4u,
+    0x69u, 0x6Eu, 0x67u, 0x60u, 0x75u, 0x72u, 0x7Bu, 0x7Cu,
+    0x51u, 0x56u, 0x5Fu, 0x58u, 0x4Du, 0x4Au, 0x43u, 0x44u,
+    0x19u, 0x1Eu, 0x17u, 0x10u, 0x05u, 0x02u, 0x0Bu, 0x0Cu,
+    0x21u, 0x26u, 0x2Fu, 0x28u, 0x3Du, 0x3Au, 0x33u, 0x34u,
+    0x4Eu, 0x49u, 0x40u, 0x47u, 0x52u, 0x55u, 0x5Cu, 0x5Bu,
+    0x76u, 0x71u, 0x78u, 0x7Fu, 0x6Au, 0x6Du, 0x64u, 0x63u,
+    0x3Eu, 0x39u, 0x30u, 0x37u, 0x22u, 0x25u, 0x2Cu, 0x2Bu,
+    0x06u, 0x01u, 0x08u, 0x0Fu, 0x1Au, 0x1Du, 0x14u, 0x13u,
+    0xAEu, 0xA9u, 0xA0u, 0xA7u, 0xB2u, 0xB5u, 0xBCu, 0xBBu,
+    0x96u, 0x91u, 0x98u, 0x9Fu, 0x8Au, 0x8Du, 0x84u, 0x83u,
+    0xDEu, 0xD9u, 0xD0u, 0xD7u, 0xC2u, 0xC5u, 0xCCu, 0xCBu,
+    0xE6u, 0xE1u, 0xE8u, 0xEFu, 0xFAu, 0xFDu, 0xF4u, 0xF3u
+};
+
+/* The log keeps its content over resets */
+CY_NOINIT static diag_log_t diag_log;
+
+/*****************************************************************************
+* Function Name: Diag_Log_Crc
+******************************************************************************
+* Summary:
+* Returns the CRC-8 of a record.
+*
+* Parameters:
+*  record: Record
+*
+* Return:
+*  uint8_t: CRC of the bytes before the crc field
+*****************************************************************************/
+static uint8_t Diag_Log_Crc(const diag_log_record_t *record)
+{
+    const uint8_t *data = (const uint8_t *)record;
+    uint8_t crc = 0u;
+
+    for (uint32_t i = 0u; i < DIAG_LOG_CRC_BYTES; i++)
+    {
+        crc = diag_log_crc_table[crc ^ data[i]];
+    }
+    return crc;
+}
+
+/*****************************************************************************
+* Function Name: Diag_Log_Init
+******************************************************************************
+* Summary:
+* Checks the log left by the previous run. A log without its magic words,
+* after a power-on, is cleared. Otherwise the sequence continues after the
+* newest valid record. Then writes a boot record with the reset reason.
+* Called before any test clears the reset reason.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Diag_Log_Init(void)
+{
+    uint32_t next_seq = 1u;
+
+    if ((DIAG_LOG_MAGIC != diag_log.magic) || ((uint32_t)~DIAG_LOG_MAGIC != diag_log.magic_inv) ||
+        (DIAG_LOG_VERSION != diag_log.version) || (DIAG_LOG_RECORDS != diag_log.records))
+    {
+        memset(&diag_log, 0, sizeof(diag_log));
+        diag_log.magic = DIAG_LOG_MAGIC;
+        diag_log.magic_inv = (uint32_t)~DIAG_LOG_MAGIC;
+        diag_log.version = DIAG_LOG_VERSION;
+        diag_log.records = DIAG_LOG_RECORDS;
+    }
+    else
+    {
+        for (uint32_t i = 0u; i < DIAG_LOG_RECORDS; i++)
+        {
+            const diag_log_record_t *record = &diag_log.record[i];
+
+            if ((0u != record->seq) && (Diag_Log_Crc(record) == record->crc) &&
+                (record->seq >= next_seq))
+            {
+                next_seq = record->seq + 1u;
+            }
+        }
+    }
+    diag_log.next_seq = next_seq;
+
+    Diag_Log_Write(DIAG_LOG_TYPE_BOOT, 0u, 0u, Cy_SysLib_GetResetReason());
+}
+
+/*****************************************************************************
+* Function Name: Diag_Log_Write
+******************************************************************************
+* Summary:
+* Writes a record over the oldest one, with the current cycle counter. A
+* few dozen cycles, most of them for the CRC.
+*
+* Parameters:
+*  type:   DIAG_LOG_TYPE_xx
+*  test:   Table index of the test
+*  status: Test status or fault kind
+*  detail: Reset reason or fault detail
+*
+* Return:
+*  void
+*****************************************************************************/
+void Diag_Log_Write(uint8_t type, uint8_t test, uint8_t status, uint32_t detail)
+{
+    uint32_t interrupt_state = Cy_SysLib_EnterCriticalSection();
+    uint32_t seq = diag_log.next_seq++;
+    diag_log_record_t *record = &diag_log.record[seq & (DIAG_LOG_RECORDS - 1u)];
+
+    record->seq = seq;
+    record->cycles = CYCLE_COUNTER_GET();
+    record->detail = detail;
+    record->type = type;
+    record->test = test;
+    record->status = status;
+    record->crc = Diag_Log_Crc(record);
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+}
+
+/*****************************************************************************
+* Function Name: Diag_Log_Result
+******************************************************************************
+* Summary:
+* Records the final result of a test, called by PRINT_TEST_RESULT.
+*
+* Parameters:
+*  index:  Table index of the test
+*  status: Test status, PASS_STILL_TESTING_STATUS is not recorded
+*
+* Return:
+*  void
+*****************************************************************************/
+void Diag_Log_Result(uint32_t index, uint8_t status)
+{
+    if (PASS_STILL_TESTING_STATUS != status)
+    {
+        Diag_Log_Write(DIAG_LOG_TYPE_RESULT, (uint8_t)index, status, 0u);
+    }
+}
+
+/*****************************************************************************
+* Function Name: Diag_Log_Fault
+******************************************************************************
+* Summary:
+* Records the detail of a test failure.
+*
+* Parameters:
+*  index:  Table index of the test
+*  kind:   DIAG_LOG_FAULT_xx
+*  detail: Port and pin, checksum, stack error, address or signature
+*
+* Return:
+*  void
+*****************************************************************************/
+void Diag_Log_Fault(uint32_t index, uint8_t kind, uint32_t detail)
+{
+    Diag_Log_Write(DIAG_LOG_TYPE_FAULT, (uint8_t)index, kind, detail);
+}
+
+/*****************************************************************************
+* Function Name: Diag_Log_Dump
+******************************************************************************
+* Summary:
+* Sends the whole log on the debug UART in binary, little endian: the
+* header, starting with the magic word "DLOG", then the records in ring
+* order. The decoder finds the log in a capture of the UART output by its
+* magic words.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Diag_Log_Dump(void)
+{
+    const uint8_t *data = (const uint8_t *)&diag_log;
+
+    fflush(stdout);
+    for (uint32_t i = 0u; i < sizeof(diag_log); i++)
+    {
+        (void)cyhal_uart_putc(&cy_retarget_io_uart_obj, data[i]);
+    }
+}
+#endif /* DIAG_LOG_ENABLE */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,116 @@
+/******************************************************************************
+* File Name:   diag_log.h
+*
+* Description: Header of the post-mortem diagnostic log: a ring of CRC protected
+*              records in no-init RAM that survives resets. Decoded on a host by
+*              scripts/diag_decode.py.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef DIAG_LOG_H_
+#define DIAG_LOG_H_
+
+#include "self_test.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of records of the ring, a power of 2. The oldest records are
+ * overwritten */
+#define DIAG_LOG_RECORDS                (64u)
+
+/* Marks a valid log. The version changes with the record layout */
+#define DIAG_LOG_MAGIC                  (0x474F4C44UL)  /* "DLOG" in memory */
+#define DIAG_LOG_VERSION                (1u)
+
+/* Record types */
+#define DIAG_LOG_TYPE_BOOT              (1u)    /* detail: reset reason */
+#define DIAG_LOG_TYPE_RESULT            (2u)    /* test: table index, status: test status */
+#define DIAG_LOG_TYPE_FAULT             (3u)    /* test: table index, status: fault kind */
+
+/* Fault kinds of DIAG_LOG_TYPE_FAULT records */
+#define DIAG_LOG_FAULT_IO               (1u)    /* detail: port << 8 | pin */
+#define DIAG_LOG_FAULT_CHECKSUM         (2u)    /* detail: low 32 bits of the calculated checksum */
+#define DIAG_LOG_FAULT_STACK            (3u)    /* detail: ERROR_STACK_OVERFLOW or ERROR_STACK_UNDERFLOW */
+#define DIAG_LOG_FAULT_ADDRESS          (4u)    /* detail: failing address */
+#define DIAG_LOG_FAULT_SIGNATURE        (5u)    /* detail: program flow signature */
+#define DIAG_LOG_FAULT_CLOCK            (6u)    /* detail: clock << 24 | deviation in ppm, 24 bits */
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One record, 16 bytes. The CRC is written last: a record cut by a reset
+ * is dropped by the decoder */
+typedef struct
+{
+    uint32_t seq;       /* Sequence number from 1, continues over resets */
+    uint32_t cycles;    /* Cycle counter at the record */
+    uint32_t detail;
+    uint8_t type;
+    uint8_t test;
+    uint8_t status;
+    uint8_t crc;        /* CRC-8 of the other 15 bytes */
+} diag_log_record_t;
+
+/* Log in the .noinit section */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t magic_inv; /* ~magic */
+    uint16_t version;
+    uint16_t records;   /* DIAG_LOG_RECORDS */
+    uint32_t next_seq;  /* Rebuilt from the records at boot */
+    diag_log_record_t record[DIAG_LOG_RECORDS];
+} diag_log_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if DIAG_LOG_ENABLE
+void Diag_Log_Init(void);
+void Diag_Log_Write(uint8_t type, uint8_t test, uint8_t status, uint32_t detail);
+void Diag_Log_Dump(void);
+#endif
+
+#endif /* DIAG_LOG_H_ */
+
+
+/* [] END OF FILE */
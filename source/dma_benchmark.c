@@ -0,0 +1,262 @@
+/******************************************************************************
+* File Name:   dma_benchmark.c
+*
+* Description: This file provides a throughput benchmark for the DW and DMAC
+*              channels used by the DMA self tests. Sustained bytes per CPU cycle
+*              are measured across transfer sizes, data widths, descriptor chain
+*              lengths, SRAM/flash sources and with and without CPU bus contention.
+*              The results are printed as CSV on the debug UART.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include <string.h>
+
+#include "dma_benchmark.h"
+
+#if (DMA_BENCHMARK_ENABLE && DMA_TRANSFER_DW_AVAILABLE)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Source memory of a benchmark transfer */
+typedef enum
+{
+    DMA_BENCHMARK_SRC_SRAM  = 0u,
+    DMA_BENCHMARK_SRC_FLASH = 1u,
+} dma_benchmark_src_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint8_t dma_bench_sram_src[DMA_BENCHMARK_BUFFER_SIZE] __attribute__((aligned(4)));
+static uint8_t dma_bench_sram_dst[DMA_BENCHMARK_BUFFER_SIZE] __attribute__((aligned(4)));
+static const uint8_t dma_bench_flash_src[DMA_BENCHMARK_BUFFER_SIZE] __attribute__((aligned(4))) =
+{
+    0x5Au, 0xA5u, 0x3Cu, 0xC3u
+};
+
+/* Buffer the CPU writes to while the DMA runs in the contention runs */
+static volatile uint32_t dma_bench_contention[DMA_BENCHMARK_CONTENTION_WORDS];
+
+static const uint32_t dma_bench_sizes[] = DMA_BENCHMARK_SIZES;
+static const uint8_t dma_bench_widths[] = DMA_BENCHMARK_WIDTHS;
+static const uint8_t dma_bench_chains[] = DMA_BENCHMARK_CHAIN_LENGTHS;
+
+/*****************************************************************************
+* Function Name: Dma_Benchmark_Measure
+******************************************************************************
+* Summary:
+* Runs one benchmark configuration DMA_BENCHMARK_REPEAT times and verifies
+* the destination after every run.
+*
+* Parameters:
+*  engine     - DMA engine
+*  src        - Source buffer
+*  size       - Transfer size in bytes
+*  width      - Data width in bytes
+*  chain      - Number of descriptors the transfer is split into
+*  contention - true to keep the CPU busy on SRAM during the transfer
+*  cycles     - Average number of CPU cycles per transfer (output)
+*  cpu_ops    - Average number of CPU writes done during a transfer (output)
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+static uint8_t Dma_Benchmark_Measure(dma_transfer_engine_t engine, const uint8_t *src,
+                                     uint32_t size, uint8_t width, uint8_t chain,
+                                     bool contention, uint32_t *cycles, uint32_t *cpu_ops)
+{
+    dma_transfer_segment_t segments[DMA_TRANSFER_MAX_SEGMENTS];
+    uint32_t seg_bytes = size / chain;
+    uint32_t total_cycles = 0u;
+    uint32_t total_ops = 0u;
+    uint32_t start;
+    uint32_t ops;
+    uint8_t run;
+    uint8_t i;
+
+    for (i = 0u; i < chain; i++)
+    {
+        segments[i].src = &src[i * seg_bytes];
+        segments[i].dst = &dma_bench_sram_dst[i * seg_bytes];
+        segments[i].count = seg_bytes / width;
+        segments[i].width = width;
+        segments[i].src_fixed = false;
+    }
+
+    for (run = 0u; run < DMA_BENCHMARK_REPEAT; run++)
+    {
+        memset(dma_bench_sram_dst, (int)(~src[0] & 0xFFu), size);
+
+        if (OK_STATUS != Dma_Transfer_Setup(engine, segments, chain))
+        {
+            return ERROR_STATUS;
+        }
+
+        ops = 0u;
+        start = CYCLE_COUNTER_GET();
+        Dma_Transfer_Trigger(engine);
+        while (!Dma_Transfer_Is_Done(engine))
+        {
+            if (contention)
+            {
+                dma_bench_contention[ops % DMA_BENCHMARK_CONTENTION_WORDS]++;
+                ops++;
+            }
+            if ((CYCLE_COUNTER_GET() - start) > DMA_BENCHMARK_TIMEOUT_CYCLES)
+            {
+                Dma_Transfer_Abort(engine);
+                return ERROR_STATUS;
+            }
+        }
+        total_cycles += CYCLE_COUNTER_GET() - start;
+        total_ops += ops;
+
+        if ((OK_STATUS != Dma_Transfer_Wait(engine, DMA_BENCHMARK_TIMEOUT_CYCLES)) ||
+            (0 != memcmp(dma_bench_sram_dst, src, size)))
+        {
+            return ERROR_STATUS;
+        }
+    }
+
+    *cycles = total_cycles / DMA_BENCHMARK_REPEAT;
+    *cpu_ops = total_ops / DMA_BENCHMARK_REPEAT;
+
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Dma_Benchmark_Run
+******************************************************************************
+* Summary:
+* Sweeps all benchmark configurations on every available DMA engine and
+* prints one CSV row per configuration between DMA_BENCHMARK_CSV_BEGIN and
+* DMA_BENCHMARK_CSV_END. Throughput is printed in bytes per CPU cycle.
+* Requires Cycle_Counter_Init() to have been called.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  OK_STATUS if every transfer completed and was verified, else ERROR_STATUS
+*****************************************************************************/
+uint8_t Dma_Benchmark_Run(void)
+{
+    static const dma_transfer_engine_t engines[] =
+    {
+#if DMA_TRANSFER_DW_AVAILABLE
+        DMA_TRANSFER_ENGINE_DW,
+#endif
+#if DMA_TRANSFER_DMAC_AVAILABLE
+        DMA_TRANSFER_ENGINE_DMAC,
+#endif
+    };
+    uint8_t status = OK_STATUS;
+    uint32_t i;
+
+    for (i = 0u; i < DMA_BENCHMARK_BUFFER_SIZE; i++)
+    {
+        dma_bench_sram_src[i] = (uint8_t)(i * 7u + 1u);
+    }
+
+    printf("%s\r\n", DMA_BENCHMARK_CSV_BEGIN);
+    printf("engine,src,dst,size,width,chain,contention,cycles,bytes_per_cycle,cpu_ops,result\r\n");
+
+    for (uint8_t e = 0u; e < (sizeof(engines) / sizeof(engines[0])); e++)
+    {
+        for (uint8_t s = DMA_BENCHMARK_SRC_SRAM; s <= DMA_BENCHMARK_SRC_FLASH; s++)
+        {
+            const uint8_t *src = (DMA_BENCHMARK_SRC_SRAM == s) ? dma_bench_sram_src : dma_bench_flash_src;
+
+            for (uint8_t z = 0u; z < (sizeof(dma_bench_sizes) / sizeof(dma_bench_sizes[0])); z++)
+            {
+                for (uint8_t w = 0u; w < sizeof(dma_bench_widths); w++)
+                {
+                    for (uint8_t c = 0u; c < sizeof(dma_bench_chains); c++)
+                    {
+                        for (uint8_t busy = 0u; busy < 2u; busy++)
+                        {
+                            uint32_t size = dma_bench_sizes[z];
+                            uint8_t width = dma_bench_widths[w];
+                            uint8_t chain = dma_bench_chains[c];
+                            uint32_t cycles = 0u;
+                            uint32_t cpu_ops = 0u;
+                            uint32_t milli_bpc = 0u;
+                            uint8_t result;
+
+                            if ((size > DMA_BENCHMARK_BUFFER_SIZE) || (chain > DMA_TRANSFER_MAX_SEGMENTS) ||
+                                (0u != (size % ((uint32_t)chain * width))))
+                            {
+                                continue;
+                            }
+
+                            result = Dma_Benchmark_Measure(engines[e], src, size, width, chain,
+                                                           (0u != busy), &cycles, &cpu_ops);
+                            if (OK_STATUS != result)
+                            {
+                                status = ERROR_STATUS;
+                            }
+                            if (0u != cycles)
+                            {
+                                milli_bpc = (size * 1000u) / cycles;
+                            }
+
+                            printf("%s,%s,SRAM,%lu,%u,%u,%u,%lu,%lu.%03lu,%lu,%s\r\n",
+                                   (DMA_TRANSFER_ENGINE_DW == engines[e]) ? "DW" : "DMAC",
+                                   (DMA_BENCHMARK_SRC_SRAM == s) ? "SRAM" : "FLASH",
+                                   (unsigned long)size, width, chain, busy,
+                                   (unsigned long)cycles,
+                                   (unsigned long)(milli_bpc / 1000u), (unsigned long)(milli_bpc % 1000u),
+                                   (unsigned long)cpu_ops,
+                                   (OK_STATUS == result) ? "OK" : "ERROR");
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    printf("%s\r\n", DMA_BENCHMARK_CSV_END);
+
+    return status;
+}
+#endif /* (DMA_BENCHMARK_ENABLE && DMA_TRANSFER_DW_AVAILABLE) */
+
+/* [] END OF FILE */
@@ -0,0 +1,85 @@
+/******************************************************************************
+* File Name:   dma_benchmark.h
+*
+* Description: This file is the public interface of dma_benchmark.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef DMA_BENCHMARK_H_
+#define DMA_BENCHMARK_H_
+
+#include "dma_transfer.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Size of the source and destination buffers, i.e. the largest transfer */
+#define DMA_BENCHMARK_BUFFER_SIZE       (4096u)
+
+/* Transfer sizes in bytes, data widths in bytes and descriptor chain lengths
+ * swept by the benchmark. Every transfer size must be divisible by
+ * (chain length x data width). */
+#define DMA_BENCHMARK_SIZES             {64u, 256u, 1024u, 4096u}
+#define DMA_BENCHMARK_WIDTHS            {1u, 2u, 4u}
+#define DMA_BENCHMARK_CHAIN_LENGTHS     {1u, 2u, 4u, 8u}
+
+/* Number of runs averaged for each configuration */
+#define DMA_BENCHMARK_REPEAT            (4u)
+
+/* Timeout for a single transfer, in CPU cycles */
+#define DMA_BENCHMARK_TIMEOUT_CYCLES    (10000000u)
+
+/* Size of the SRAM buffer the CPU hammers on to create bus contention */
+#define DMA_BENCHMARK_CONTENTION_WORDS  (256u)
+
+/* Markers around the CSV block, used by scripts/dma_benchmark_plot.py */
+#define DMA_BENCHMARK_CSV_BEGIN         "#DMA_BENCHMARK_CSV_BEGIN"
+#define DMA_BENCHMARK_CSV_END           "#DMA_BENCHMARK_CSV_END"
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t Dma_Benchmark_Run(void);
+
+#endif /* DMA_BENCHMARK_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,584 @@
+/******************************************************************************
+* File Name:   dma_transfer.c
+*
+* Description: This file provides helper functions to run memory-to-memory DMA
+*              descriptor chains on the DMA_DW and DMAC_0 channels that are
+*              configured for the DMA self tests.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "dma_transfer.h"
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if DMA_TRANSFER_DW_AVAILABLE
+/* Descriptor chain for the DW channel */
+static cy_stc_dma_descriptor_t dw_descriptors[DMA_TRANSFER_MAX_SEGMENTS];
+#endif
+
+#if DMA_TRANSFER_DMAC_AVAILABLE
+/* Descriptor chain for the DMAC channel */
+static cy_stc_dmac_descriptor_t dmac_descriptors[DMA_TRANSFER_MAX_SEGMENTS];
+#endif
+
+#if DMA_TRANSFER_DW_AVAILABLE
+/*****************************************************************************
+* Function Name: Dw_Setup
+******************************************************************************
+* Summary:
+* Builds the DW descriptor chain from the segment list and initializes the
+* DMA_DW channel with it. The descriptors are based on the
+* DMA_DW_Descriptor_0 configuration so that retrigger and trigger output
+* settings match the DMA DW self test.
+*
+* Parameters:
+*  segments     - Segment list
+*  num_segments - Number of segments
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+static uint8_t Dw_Setup(const dma_transfer_segment_t *segments, uint8_t num_segments)
+{
+    cy_stc_dma_descriptor_config_t descr_config;
+    cy_stc_dma_channel_config_t channel_config;
+    uint8_t i;
+
+    for (i = 0u; i < num_segments; i++)
+    {
+        const dma_transfer_segment_t *seg = &segments[i];
+        bool last = ((i + 1u) == num_segments);
+
+        if (0u == seg->count)
+        {
+            return ERROR_STATUS;
+        }
+
+        descr_config = DMA_DW_Descriptor_0_config;
+        descr_config.interruptType = CY_DMA_DESCR_CHAIN;
+        descr_config.triggerOutType = CY_DMA_DESCR_CHAIN;
+        descr_config.triggerInType = CY_DMA_DESCR_CHAIN;
+        descr_config.channelState = last ? CY_DMA_CHANNEL_DISABLED : CY_DMA_CHANNEL_ENABLED;
+        descr_config.srcTransferSize = CY_DMA_TRANSFER_SIZE_DATA;
+        descr_config.dstTransferSize = CY_DMA_TRANSFER_SIZE_DATA;
+        descr_config.srcAddress = (void *)seg->src;
+        descr_config.dstAddress = seg->dst;
+        descr_config.srcXincrement = seg->src_fixed ? 0 : 1;
+        descr_config.dstXincrement = 1;
+        descr_config.nextDescriptor = last ? NULL : &dw_descriptors[i + 1u];
+
+        switch (seg->width)
+        {
+            case 1u:
+                descr_config.dataSize = CY_DMA_BYTE;
+                break;
+            case 2u:
+                descr_config.dataSize = CY_DMA_HALFWORD;
+                break;
+            case 4u:
+                descr_config.dataSize = CY_DMA_WORD;
+                break;
+            default:
+                return ERROR_STATUS;
+        }
+
+        if (seg->count <= DMA_TRANSFER_DW_X_COUNT_MAX)
+        {
+            descr_config.descriptorType = CY_DMA_1D_TRANSFER;
+            descr_config.xCount = seg->count;
+            descr_config.srcYincrement = 0;
+            descr_config.dstYincrement = 0;
+            descr_config.yCount = 1u;
+        }
+        else if ((0u == (seg->count % DMA_TRANSFER_DW_X_COUNT_MAX)) &&
+                 (seg->count <= DMA_TRANSFER_ELEMENTS_MAX))
+        {
+            descr_config.descriptorType = CY_DMA_2D_TRANSFER;
+            descr_config.xCount = DMA_TRANSFER_DW_X_COUNT_MAX;
+            descr_config.srcYincrement = seg->src_fixed ? 0 : (int32_t)DMA_TRANSFER_DW_X_COUNT_MAX;
+            descr_config.dstYincrement = (int32_t)DMA_TRANSFER_DW_X_COUNT_MAX;
+            descr_config.yCount = seg->count / DMA_TRANSFER_DW_X_COUNT_MAX;
+        }
+        else
+        {
+            return ERROR_STATUS;
+        }
+
+        if (CY_DMA_SUCCESS != Cy_DMA_Descriptor_Init(&dw_descriptors[i], &descr_config))
+        {
+            return ERROR_STATUS;
+        }
+    }
+
+    channel_config = DMA_DW_channelConfig;
+    channel_config.descriptor = &dw_descriptors[0];
+
+    Cy_DMA_Channel_Disable(DMA_DW_HW, DMA_DW_CHANNEL);
+    if (CY_DMA_SUCCESS != Cy_DMA_Channel_Init(DMA_DW_HW, DMA_DW_CHANNEL, &channel_config))
+    {
+        return ERROR_STATUS;
+    }
+    Cy_DMA_Channel_ClearInterrupt(DMA_DW_HW, DMA_DW_CHANNEL);
+    Cy_DMA_Enable(DMA_DW_HW);
+    Cy_DMA_Channel_Enable(DMA_DW_HW, DMA_DW_CHANNEL);
+
+    return OK_STATUS;
+}
+#endif
+
+#if DMA_TRANSFER_DMAC_AVAILABLE
+/*****************************************************************************
+* Function Name: Dmac_Setup
+******************************************************************************
+* Summary:
+* Builds the DMAC descriptor chain from the segment list and initializes the
+* DMAC_0 channel with it. The descriptors are based on the
+* DMAC_0_Descriptor_0 configuration.
+*
+* Parameters:
+*  segments     - Segment list
+*  num_segments - Number of segments
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+static uint8_t Dmac_Setup(const dma_transfer_segment_t *segments, uint8_t num_segments)
+{
+    cy_stc_dmac_descriptor_config_t descr_config;
+    cy_stc_dmac_channel_config_t channel_config;
+    uint8_t i;
+
+    for (i = 0u; i < num_segments; i++)
+    {
+        const dma_transfer_segment_t *seg = &segments[i];
+        bool last = ((i + 1u) == num_segments);
+
+        if ((0u == seg->count) || (seg->count > DMA_TRANSFER_ELEMENTS_MAX))
+        {
+            return ERROR_STATUS;
+        }
+
+        descr_config = DMAC_0_Descriptor_0_config;
+        descr_config.interruptType = CY_DMAC_DESCR_CHAIN;
+        descr_config.triggerOutType = CY_DMAC_DESCR_CHAIN;
+        descr_config.triggerInType = CY_DMAC_DESCR_CHAIN;
+        descr_config.channelState = last ? CY_DMAC_CHANNEL_DISABLED : CY_DMAC_CHANNEL_ENABLED;
+        descr_config.dataPrefetch = false;
+        descr_config.srcTransferSize = CY_DMAC_TRANSFER_SIZE_DATA;
+        descr_config.dstTransferSize = CY_DMAC_TRANSFER_SIZE_DATA;
+        descr_config.descriptorType = CY_DMAC_1D_TRANSFER;
+        descr_config.srcAddress = (void *)seg->src;
+        descr_config.dstAddress = seg->dst;
+        descr_config.srcXincrement = seg->src_fixed ? 0 : 1;
+        descr_config.dstXincrement = 1;
+        descr_config.xCount = seg->count;
+        descr_config.srcYincrement = 0;
+        descr_config.dstYincrement = 0;
+        descr_config.yCount = 1u;
+        descr_config.nextDescriptor = last ? NULL : &dmac_descriptors[i + 1u];
+
+        switch (seg->width)
+        {
+            case 1u:
+                descr_config.dataSize = CY_DMAC_BYTE;
+                break;
+            case 2u:
+                descr_config.dataSize = CY_DMAC_HALFWORD;
+                break;
+            case 4u:
+                descr_config.dataSize = CY_DMAC_WORD;
+                break;
+            default:
+                return ERROR_STATUS;
+        }
+
+        if (CY_DMAC_SUCCESS != Cy_DMAC_Descriptor_Init(&dmac_descriptors[i], &descr_config))
+        {
+            return ERROR_STATUS;
+        }
+    }
+
+    channel_config = DMAC_0_channelConfig;
+    channel_config.descriptor = &dmac_descriptors[0];
+
+    Cy_DMAC_Channel_Disable(DMAC_0_HW, DMAC_0_CHANNEL);
+    if (CY_DMAC_SUCCESS != Cy_DMAC_Channel_Init(DMAC_0_HW, DMAC_0_CHANNEL, &channel_config))
+    {
+        return ERROR_STATUS;
+    }
+    Cy_DMAC_Channel_ClearInterrupt(DMAC_0_HW, DMAC_0_CHANNEL, CY_DMAC_INTR_MASK);
+    Cy_DMAC_Enable(DMAC_0_HW);
+    Cy_DMAC_Channel_Enable(DMAC_0_HW, DMAC_0_CHANNEL);
+
+    return OK_STATUS;
+}
+#endif
+
+/*****************************************************************************
+* Function Name: Dma_Transfer_Setup
+******************************************************************************
+* Summary:
+* Builds a descriptor chain, one descriptor per segment, and arms the
+* channel of the selected engine. The transfer starts on
+* Dma_Transfer_Trigger().
+*
+* Parameters:
+*  engine       - DMA engine to use
+*  segments     - Segment list
+*  num_segments - Number of segments, 1 to DMA_TRANSFER_MAX_SEGMENTS
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t Dma_Transfer_Setup(dma_transfer_engine_t engine,
+                           const dma_transfer_segment_t *segments,
+                           uint8_t num_segments)
+{
+    uint8_t status = ERROR_STATUS;
+
+    if ((NULL == segments) || (0u == num_segments) ||
+        (num_segments > DMA_TRANSFER_MAX_SEGMENTS))
+    {
+        return ERROR_STATUS;
+    }
+
+#if DMA_TRANSFER_DW_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DW == engine)
+    {
+        status = Dw_Setup(segments, num_segments);
+    }
+#endif
+#if DMA_TRANSFER_DMAC_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DMAC == engine)
+    {
+        status = Dmac_Setup(segments, num_segments);
+    }
+#endif
+
+    return status;
+}
+
+/*****************************************************************************
+* Function Name: Dma_Transfer_Trigger
+******************************************************************************
+* Summary:
+* Starts the prepared descriptor chain with a software trigger on the same
+* trigger line that the DMA self tests use.
+*
+* Parameters:
+*  engine - DMA engine to trigger
+*
+* Return:
+*  void
+*****************************************************************************/
+void Dma_Transfer_Trigger(dma_transfer_engine_t engine)
+{
+#if DMA_TRANSFER_DW_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DW == engine)
+    {
+        (void)Cy_TrigMux_SwTrigger((uint32_t)DMA_DW_INPUT_TRIG_MUX, CY_TRIGGER_TWO_CYCLES);
+    }
+#endif
+#if DMA_TRANSFER_DMAC_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DMAC == engine)
+    {
+        (void)Cy_TrigMux_SwTrigger((uint32_t)DMAC_INPUT_TRIG_MUX, CY_TRIGGER_TWO_CYCLES);
+    }
+#endif
+}
+
+/*****************************************************************************
+* Function Name: Dma_Transfer_Is_Done
+******************************************************************************
+* Summary:
+* Checks the chain completion interrupt status of the selected engine.
+*
+* Parameters:
+*  engine - DMA engine to check
+*
+* Return:
+*  true when the whole descriptor chain has completed
+*****************************************************************************/
+bool Dma_Transfer_Is_Done(dma_transfer_engine_t engine)
+{
+    bool done = false;
+
+#if DMA_TRANSFER_DW_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DW == engine)
+    {
+        done = (0u != (Cy_DMA_Channel_GetInterruptStatus(DMA_DW_HW, DMA_DW_CHANNEL) & CY_DMA_INTR_MASK));
+    }
+#endif
+#if DMA_TRANSFER_DMAC_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DMAC == engine)
+    {
+        done = (0u != (Cy_DMAC_Channel_GetInterruptStatus(DMAC_0_HW, DMAC_0_CHANNEL) & CY_DMAC_INTR_COMPLETION));
+    }
+#endif
+
+    return done;
+}
+
+/*****************************************************************************
+* Function Name: Dma_Transfer_Abort
+******************************************************************************
+* Summary:
+* Disables the channel of the selected engine, so that a transfer the
+* caller has given up on does not write to its destination later.
+*
+* Parameters:
+*  engine - DMA engine to stop
+*
+* Return:
+*  void
+*****************************************************************************/
+void Dma_Transfer_Abort(dma_transfer_engine_t engine)
+{
+#if DMA_TRANSFER_DW_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DW == engine)
+    {
+        Cy_DMA_Channel_Disable(DMA_DW_HW, DMA_DW_CHANNEL);
+    }
+#endif
+#if DMA_TRANSFER_DMAC_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DMAC == engine)
+    {
+        Cy_DMAC_Channel_Disable(DMAC_0_HW, DMAC_0_CHANNEL);
+    }
+#endif
+}
+
+/*****************************************************************************
+* Function Name: Dma_Transfer_Wait
+******************************************************************************
+* Summary:
+* Busy-waits for the descriptor chain to complete and clears the completion
+* status. On timeout the channel is disabled with Dma_Transfer_Abort().
+* Requires Cycle_Counter_Init() to have been called.
+*
+* Parameters:
+*  engine         - DMA engine to wait for
+*  timeout_cycles - Maximum number of CPU cycles to wait
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS on timeout
+*****************************************************************************/
+uint8_t Dma_Transfer_Wait(dma_transfer_engine_t engine, uint32_t timeout_cycles)
+{
+    uint32_t start = CYCLE_COUNTER_GET();
+
+    while (!Dma_Transfer_Is_Done(engine))
+    {
+        if ((CYCLE_COUNTER_GET() - start) > timeout_cycles)
+        {
+            Dma_Transfer_Abort(engine);
+            return ERROR_STATUS;
+        }
+    }
+
+#if DMA_TRANSFER_DW_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DW == engine)
+    {
+        Cy_DMA_Channel_ClearInterrupt(DMA_DW_HW, DMA_DW_CHANNEL);
+    }
+#endif
+#if DMA_TRANSFER_DMAC_AVAILABLE
+    if (DMA_TRANSFER_ENGINE_DMAC == engine)
+    {
+        Cy_DMAC_Channel_ClearInterrupt(DMAC_0_HW, DMAC_0_CHANNEL, CY_DMAC_INTR_MASK);
+    }
+#endif
+
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Dma_Transfer_Run
+******************************************************************************
+* Summary:
+* Sets up, triggers and waits for a descriptor chain.
+*
+* Parameters:
+*  engine         - DMA engine to use
+*  segments       - Segment list
+*  num_segments   - Number of segments
+*  timeout_cycles - Maximum number of CPU cycles to wait for completion
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t Dma_Transfer_Run(dma_transfer_engine_t engine,
+                         const dma_transfer_segment_t *segments,
+                         uint8_t num_segments, uint32_t timeout_cycles)
+{
+    if (OK_STATUS != Dma_Transfer_Setup(engine, segments, num_segments))
+    {
+        return ERROR_STATUS;
+    }
+
+    Dma_Transfer_Trigger(engine);
+
+    return Dma_Transfer_Wait(engine, timeout_cycles);
+}
+
+/*****************************************************************************
+* Function Name: Dma_Transfer_Overlaps
+******************************************************************************
+* Summary:
+* Checks whether an address range overlaps the descriptor storage of this
+* module. Memory tests that move data with DMA must not touch the
+* descriptors they run on.
+*
+* Parameters:
+*  start - First address of the range
+*  end   - Address after the last byte of the range
+*
+* Return:
+*  true if the range overlaps a descriptor
+*****************************************************************************/
+bool Dma_Transfer_Overlaps(uintptr_t start, uintptr_t end)
+{
+    bool overlaps = false;
+
+#if DMA_TRANSFER_DW_AVAILABLE
+    overlaps = overlaps || ((start < ((uintptr_t)dw_descriptors + sizeof(dw_descriptors))) &&
+                            (end > (uintptr_t)dw_descriptors));
+#endif
+#if DMA_TRANSFER_DMAC_AVAILABLE
+    overlaps = overlaps || ((start < ((uintptr_t)dmac_descriptors + sizeof(dmac_descriptors))) &&
+                            (end > (uintptr_t)dmac_descriptors));
+#endif
+
+    return overlaps;
+}
+
+#if DMA_TRANSFER_CRC_AVAILABLE
+/*****************************************************************************
+* Function Name: Dma_Transfer_Crc
+******************************************************************************
+* Summary:
+* Calculates the CRC-32 of a word buffer with a DW CRC transfer, so the CPU
+* does not read the data. With src_fixed set, the same word is fed count
+* times, which gives the expected CRC of a memory block filled with that
+* word without reading the block.
+*
+* Parameters:
+*  src            - Source words
+*  count          - Number of words, 1 to DMA_TRANSFER_DW_X_COUNT_MAX
+*  src_fixed      - true: source is not incremented
+*  timeout_cycles - Maximum number of CPU cycles to wait for completion
+*  crc            - Calculated CRC (output)
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t Dma_Transfer_Crc(const uint32_t *src, uint32_t count, bool src_fixed,
+                         uint32_t timeout_cycles, uint32_t *crc)
+{
+    cy_stc_dma_descriptor_config_t descr_config;
+    cy_stc_dma_channel_config_t channel_config;
+    const cy_stc_dma_crc_config_t crc_config =
+    {
+        .dataReverse = false,
+        .dataXor = 0UL,
+        .reminderReverse = false,
+        .reminderXor = 0UL,
+        .polynomial = DMA_TRANSFER_CRC_POLYNOMIAL,
+        .lfsr32 = DMA_TRANSFER_CRC_SEED,
+    };
+
+    if ((0u == count) || (count > DMA_TRANSFER_DW_X_COUNT_MAX))
+    {
+        return ERROR_STATUS;
+    }
+
+    descr_config = DMA_DW_Descriptor_0_config;
+    descr_config.interruptType = CY_DMA_DESCR_CHAIN;
+    descr_config.triggerOutType = CY_DMA_DESCR_CHAIN;
+    descr_config.triggerInType = CY_DMA_DESCR_CHAIN;
+    descr_config.channelState = CY_DMA_CHANNEL_DISABLED;
+    descr_config.dataSize = CY_DMA_WORD;
+    descr_config.srcTransferSize = CY_DMA_TRANSFER_SIZE_WORD;
+    descr_config.dstTransferSize = CY_DMA_TRANSFER_SIZE_WORD;
+    descr_config.descriptorType = CY_DMA_CRC_TRANSFER;
+    descr_config.srcAddress = (void *)src;
+    descr_config.dstAddress = (void *)src;
+    descr_config.srcXincrement = src_fixed ? 0 : 1;
+    descr_config.dstXincrement = 0;
+    descr_config.xCount = count;
+    descr_config.srcYincrement = 0;
+    descr_config.dstYincrement = 0;
+    descr_config.yCount = 1u;
+    descr_config.nextDescriptor = NULL;
+
+    if (CY_DMA_SUCCESS != Cy_DMA_Descriptor_Init(&dw_descriptors[0], &descr_config))
+    {
+        return ERROR_STATUS;
+    }
+
+    channel_config = DMA_DW_channelConfig;
+    channel_config.descriptor = &dw_descriptors[0];
+
+    Cy_DMA_Channel_Disable(DMA_DW_HW, DMA_DW_CHANNEL);
+    if ((CY_DMA_SUCCESS != Cy_DMA_Channel_Init(DMA_DW_HW, DMA_DW_CHANNEL, &channel_config)) ||
+        (CY_DMA_SUCCESS != Cy_DMA_Crc_Init(DMA_DW_HW, &crc_config)))
+    {
+        return ERROR_STATUS;
+    }
+    Cy_DMA_Channel_ClearInterrupt(DMA_DW_HW, DMA_DW_CHANNEL);
+    Cy_DMA_Enable(DMA_DW_HW);
+    Cy_DMA_Channel_Enable(DMA_DW_HW, DMA_DW_CHANNEL);
+
+    Dma_Transfer_Trigger(DMA_TRANSFER_ENGINE_DW);
+    if (OK_STATUS != Dma_Transfer_Wait(DMA_TRANSFER_ENGINE_DW, timeout_cycles))
+    {
+        return ERROR_STATUS;
+    }
+
+    *crc = DW_CRC_LFSR_CTL(DMA_DW_HW);
+
+    return OK_STATUS;
+}
+#endif /* DMA_TRANSFER_CRC_AVAILABLE */
+
+/* [] END OF FILE */
@@ -0,0 +1,129 @@
+/******************************************************************************
+* File Name:   dma_transfer.h
+*
+* Description: This file is the public interface of dma_transfer.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef DMA_TRANSFER_H_
+#define DMA_TRANSFER_H_
+
+#include <stdbool.h>
+#include "self_test.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if !defined (CY_DEVICE_SECURE)
+#define DMA_TRANSFER_DW_AVAILABLE   (1u)
+#else
+#define DMA_TRANSFER_DW_AVAILABLE   (0u)
+#endif
+
+#if (!defined(CY_DEVICE_PSOC6ABLE2) && !defined (CY_DEVICE_SECURE))
+#define DMA_TRANSFER_DMAC_AVAILABLE (1u)
+#else
+#define DMA_TRANSFER_DMAC_AVAILABLE (0u)
+#endif
+
+/* The DW CRC transfer is available on DW IP v2 (not on PSoC 6 MCU with 1M flash) */
+#if (DMA_TRANSFER_DW_AVAILABLE && defined(CY_DW_CRC) && (0 != CY_DW_CRC))
+#define DMA_TRANSFER_CRC_AVAILABLE  (1u)
+#else
+#define DMA_TRANSFER_CRC_AVAILABLE  (0u)
+#endif
+
+/* CRC-32 polynomial and seed of the DW CRC transfer */
+#define DMA_TRANSFER_CRC_POLYNOMIAL (0x04C11DB7UL)
+#define DMA_TRANSFER_CRC_SEED       (0xFFFFFFFFUL)
+
+/* Maximum number of descriptors in one transfer chain */
+#define DMA_TRANSFER_MAX_SEGMENTS   (8u)
+
+/* DW X loop limit. Longer DW segments use a 2D descriptor of rows of this size */
+#define DMA_TRANSFER_DW_X_COUNT_MAX (256u)
+
+/* Maximum number of elements in one segment (DW 2D: 256 x 256, DMAC 1D: 65536) */
+#define DMA_TRANSFER_ELEMENTS_MAX   (65536u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* DMA engine used for a transfer */
+typedef enum
+{
+    DMA_TRANSFER_ENGINE_DW   = 0u,  /* DataWire (P-DMA), channel DMA_DW */
+    DMA_TRANSFER_ENGINE_DMAC = 1u,  /* DMAC (M-DMA), channel DMAC_0 */
+} dma_transfer_engine_t;
+
+/* One element of a descriptor chain */
+typedef struct
+{
+    const void *src;    /* Source address */
+    void *dst;          /* Destination address */
+    uint32_t count;     /* Number of data elements */
+    uint8_t width;      /* Data element width in bytes: 1, 2 or 4 */
+    bool src_fixed;     /* true: source is not incremented (pattern fill) */
+} dma_transfer_segment_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t Dma_Transfer_Setup(dma_transfer_engine_t engine,
+                           const dma_transfer_segment_t *segments,
+                           uint8_t num_segments);
+void Dma_Transfer_Trigger(dma_transfer_engine_t engine);
+bool Dma_Transfer_Is_Done(dma_transfer_engine_t engine);
+void Dma_Transfer_Abort(dma_transfer_engine_t engine);
+uint8_t Dma_Transfer_Wait(dma_transfer_engine_t engine, uint32_t timeout_cycles);
+uint8_t Dma_Transfer_Run(dma_transfer_engine_t engine,
+                         const dma_transfer_segment_t *segments,
+                         uint8_t num_segments, uint32_t timeout_cycles);
+bool Dma_Transfer_Overlaps(uintptr_t start, uintptr_t end);
+#if DMA_TRANSFER_CRC_AVAILABLE
+uint8_t Dma_Transfer_Crc(const uint32_t *src, uint32_t count, bool src_fixed,
+                         uint32_t timeout_cycles, uint32_t *crc);
+#endif
+
+#endif /* DMA_TRANSFER_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,273 @@
+/******************************************************************************
+* File Name:   dual_core.c
+*
+* Description: This file contains the dual core test of XMC7200: the core-local tests
+*              run on CM7_0 and CM7_1 concurrently and their results are merged through
+*              a record in shared memory.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "dual_core.h"
+
+#if DUAL_CORE_AVAILABLE
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DUAL_CORE_ALL_TESTS             ((1UL << DUAL_CORE_TEST_COUNT) - 1UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if !DUAL_CORE_SECONDARY
+/* Shared record, one cache line per core */
+CY_SECTION_SHAREDMEM CY_ALIGN(DUAL_CORE_SYNC_LINE_SIZE)
+static dual_core_sync_record_t dual_core_record;
+#endif
+
+static struct
+{
+    dual_core_sync_record_t *record;
+    uint32_t round;
+    bool stack_init;
+    bool secondary_lost;    /* CM7_1 missed a barrier, the record is out of step */
+    uint32_t boot_wait_cycles;  /* Wait for CM7_1 at the first barrier */
+    dual_core_report_t last;
+} dual_core_ctx;
+
+/*****************************************************************************
+* Function Name: Dual_Core_Run_Local
+******************************************************************************
+* Summary:
+* Runs the core-local tests on the calling core: program counter, CPU
+* registers, program flow, FPU registers and stack overflow/underflow
+* pattern. Each core tests its own registers and stack.
+*
+* Parameters:
+*  result: Result of the round, the round number is set by the caller
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Dual_Core_Run_Local(dual_core_sync_result_t *result)
+{
+    uint32_t start = CYCLE_COUNTER_GET();
+    uint32_t failed = 0u;
+
+    if (OK_STATUS != SelfTest_PC())
+    {
+        failed |= 1UL << DUAL_CORE_TEST_PC;
+    }
+    if (OK_STATUS != SelfTest_CPU_Registers())
+    {
+        failed |= 1UL << DUAL_CORE_TEST_CPU_REGS;
+    }
+    if (OK_STATUS != SelfTest_PROGRAM_FLOW())
+    {
+        failed |= 1UL << DUAL_CORE_TEST_PROGRAM_FLOW;
+    }
+    if ((0u == SCB_GetFPUType()) || (OK_STATUS != SelfTest_FPU_Registers()))
+    {
+        failed |= 1UL << DUAL_CORE_TEST_FPU_REGS;
+    }
+
+    /* The pattern is written at the first round and checked at every round */
+    if (!dual_core_ctx.stack_init)
+    {
+        SelfTests_Init_Stack_Test(PATTERN_BLOCK_SIZE);
+        dual_core_ctx.stack_init = true;
+    }
+    if (OK_STATUS != SelfTests_Stack_Check())
+    {
+        failed |= 1UL << DUAL_CORE_TEST_STACK;
+    }
+
+    result->failed = failed;
+    result->cycles = CYCLE_COUNTER_GET() - start;
+}
+
+#if !DUAL_CORE_SECONDARY
+/*****************************************************************************
+* Function Name: Dual_Core_Run
+******************************************************************************
+* Summary:
+* Runs one round of the dual core test on CM7_0: both cores leave a start
+* barrier, run their core-local tests concurrently and exchange the results.
+* The first call clears the shared record and passes its address to CM7_1,
+* and waits at most DUAL_CORE_BOOT_TIMEOUT_US for CM7_1 to boot. When CM7_1
+* does not arrive in time, all its tests are reported failed and the later
+* rounds run on CM7_0 only.
+*
+* Parameters:
+*  report: Merged outcome of the round
+*
+* Return:
+*  uint8_t: OK_STATUS when all tests passed on both cores, else ERROR_STATUS
+*****************************************************************************/
+uint8_t Dual_Core_Run(dual_core_report_t *report)
+{
+    dual_core_sync_result_t own;
+    dual_core_sync_result_t other;
+    uint32_t start = CYCLE_COUNTER_GET();
+
+    if (NULL == dual_core_ctx.record)
+    {
+        dual_core_ctx.record = &dual_core_record;
+        Dual_Core_Sync_Init(dual_core_ctx.record);
+        Cy_IPC_Drv_WriteDataValue(Cy_IPC_Drv_GetIpcBaseAddress(DUAL_CORE_IPC_STRUCT),
+                                  (uint32_t)(uintptr_t)dual_core_ctx.record);
+    }
+
+    own.round = ++dual_core_ctx.round;
+    report->status = DUAL_CORE_SYNC_TIMEOUT;
+    if (1u == own.round)
+    {
+        /* CM7_1 may still be booting */
+        report->status = Dual_Core_Sync_Barrier(dual_core_ctx.record, DUAL_CORE_PRIMARY_INDEX,
+                                                (SystemCoreClock / 1000000u) * DUAL_CORE_BOOT_TIMEOUT_US);
+        dual_core_ctx.boot_wait_cycles = CYCLE_COUNTER_GET() - start;
+    }
+    else if (!dual_core_ctx.secondary_lost)
+    {
+        report->status = Dual_Core_Sync_Barrier(dual_core_ctx.record, DUAL_CORE_PRIMARY_INDEX,
+                                                DUAL_CORE_TIMEOUT_CYCLES);
+    }
+    else
+    {
+        /* CM7_1 lost, CM7_0 only */
+    }
+
+    Dual_Core_Run_Local(&own);
+
+    if (DUAL_CORE_SYNC_OK == report->status)
+    {
+        report->status = Dual_Core_Sync_Exchange(dual_core_ctx.record, DUAL_CORE_PRIMARY_INDEX,
+                                                 &own, &other, DUAL_CORE_TIMEOUT_CYCLES);
+    }
+    if (DUAL_CORE_SYNC_OK != report->status)
+    {
+        dual_core_ctx.secondary_lost = true;
+        other.failed = DUAL_CORE_ALL_TESTS;
+        other.cycles = 0u;
+    }
+
+    report->failed[DUAL_CORE_PRIMARY_INDEX] = own.failed;
+    report->cycles[DUAL_CORE_PRIMARY_INDEX] = own.cycles;
+    report->failed[DUAL_CORE_SECONDARY_INDEX] = other.failed;
+    report->cycles[DUAL_CORE_SECONDARY_INDEX] = other.cycles;
+    report->wall_cycles = CYCLE_COUNTER_GET() - start;
+    dual_core_ctx.last = *report;
+
+    return ((0u == (own.failed | other.failed)) && (DUAL_CORE_SYNC_OK == report->status)) ?
+           OK_STATUS : ERROR_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Dual_Core_Print_Timing
+******************************************************************************
+* Summary:
+* Prints the duration of the local tests of each core and of the last round,
+* and the wait for the boot of CM7_1 at the first round. The round takes
+* about as long as the slower core, not the sum of both.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Dual_Core_Print_Timing(void)
+{
+    printf("Dual core test cycles: CM7_0 %lu CM7_1 %lu wall %lu\r\n",
+           (unsigned long)dual_core_ctx.last.cycles[DUAL_CORE_PRIMARY_INDEX],
+           (unsigned long)dual_core_ctx.last.cycles[DUAL_CORE_SECONDARY_INDEX],
+           (unsigned long)dual_core_ctx.last.wall_cycles);
+    printf("CM7_1 boot wait %lu us (limit %lu us)\r\n",
+           (unsigned long)(dual_core_ctx.boot_wait_cycles / (SystemCoreClock / 1000000u)),
+           (unsigned long)DUAL_CORE_BOOT_TIMEOUT_US);
+}
+
+#else
+/*****************************************************************************
+* Function Name: Dual_Core_Secondary_Main
+******************************************************************************
+* Summary:
+* Test loop of CM7_1, called from main() of the CM7_1 image after the
+* device initialization. Waits for the address of the shared record, then
+* runs the core-local tests at every round started by CM7_0. Does not
+* return.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Dual_Core_Secondary_Main(void)
+{
+    IPC_STRUCT_Type *ipc = Cy_IPC_Drv_GetIpcBaseAddress(DUAL_CORE_IPC_STRUCT);
+    dual_core_sync_result_t own;
+    dual_core_sync_result_t other;
+    uint32_t address;
+
+    Cycle_Counter_Init();
+
+    do
+    {
+        address = Cy_IPC_Drv_ReadDataValue(ipc);
+    } while (0u == address);
+
+    dual_core_ctx.record = (dual_core_sync_record_t *)(uintptr_t)address;
+    DUAL_CORE_SYNC_INVALIDATE(dual_core_ctx.record, sizeof(*dual_core_ctx.record));
+
+    for (;;)
+    {
+        (void)Dual_Core_Sync_Barrier(dual_core_ctx.record, DUAL_CORE_SECONDARY_INDEX,
+                                     DUAL_CORE_SYNC_WAIT_FOREVER);
+        own.round = ++dual_core_ctx.round;
+        Dual_Core_Run_Local(&own);
+        (void)Dual_Core_Sync_Exchange(dual_core_ctx.record, DUAL_CORE_SECONDARY_INDEX,
+                                      &own, &other, DUAL_CORE_SYNC_WAIT_FOREVER);
+    }
+}
+#endif /* !DUAL_CORE_SECONDARY */
+#endif /* DUAL_CORE_AVAILABLE */
+
+/* [] END OF FILE */
@@ -0,0 +1,133 @@
+/******************************************************************************
+* File Name:   dual_core.h
+*
+* Description: This file is the public interface of dual_core.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef DUAL_CORE_H_
+#define DUAL_CORE_H_
+
+#include "self_test.h"
+#include "dual_core_sync.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 (DEFINES+=DUAL_CORE_CM7_1_PRESENT=1u) in an application that
+ * builds and boots the CM7_1 image and splits the memory between the CM7
+ * cores. This example has no CM7_1 image and leaves it at 0. XMC7100 has a
+ * single CM7 core */
+#ifndef DUAL_CORE_CM7_1_PRESENT
+#define DUAL_CORE_CM7_1_PRESENT         (0u)
+#endif
+
+#if (DUAL_CORE_TEST_ENABLE && COMPONENT_CAT1C && DUAL_CORE_CM7_1_PRESENT)
+#define DUAL_CORE_AVAILABLE             (1u)
+#else
+#define DUAL_CORE_AVAILABLE             (0u)
+#endif
+
+#if (DUAL_CORE_TEST_ENABLE && COMPONENT_CAT1C && !DUAL_CORE_CM7_1_PRESENT)
+#error "DUAL_CORE_TEST_ENABLE needs a CM7_1 image (XMC7200), see DUAL_CORE_CM7_1_PRESENT"
+#endif
+
+/* Set to 1 by the build of the CM7_1 image: dual_core.c then provides
+ * Dual_Core_Secondary_Main() instead of Dual_Core_Run() */
+#ifndef DUAL_CORE_SECONDARY
+#define DUAL_CORE_SECONDARY             (0u)
+#endif
+
+/* Core indexes in the shared record */
+#define DUAL_CORE_PRIMARY_INDEX         (0u)    /* CM7_0, owns the debug UART */
+#define DUAL_CORE_SECONDARY_INDEX       (1u)    /* CM7_1 */
+
+/* IPC structure whose data register passes the address of the shared record
+ * to CM7_1. Must differ from the IPC structure used by SelfTest_IPC() */
+#define DUAL_CORE_IPC_STRUCT            (CY_IPC_CHAN_USER + 1u)
+
+/* Time CM7_0 waits for CM7_1 at the first barrier, in microseconds. Bound
+ * on the boot of CM7_1 from the release by CM0+ to Dual_Core_Secondary_Main(),
+ * less the start-up of CM7_0 up to the test. The measured wait is printed by
+ * Dual_Core_Print_Timing() */
+#define DUAL_CORE_BOOT_TIMEOUT_US       (20000u)
+
+/* Time CM7_0 waits for CM7_1 at the later barriers and at the exchange of
+ * the results, in CPU cycles. Covers the core-local tests of CM7_1 */
+#define DUAL_CORE_TIMEOUT_CYCLES        (10000000UL)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Core-local tests, run on both cores. Bit n of a failed mask is test n */
+typedef enum
+{
+    DUAL_CORE_TEST_PC,
+    DUAL_CORE_TEST_CPU_REGS,
+    DUAL_CORE_TEST_PROGRAM_FLOW,
+    DUAL_CORE_TEST_FPU_REGS,
+    DUAL_CORE_TEST_STACK,
+    DUAL_CORE_TEST_COUNT
+} dual_core_test_t;
+
+/* Merged outcome of one round */
+typedef struct
+{
+    uint32_t failed[DUAL_CORE_SYNC_CORES];  /* Failed test mask per core */
+    uint32_t cycles[DUAL_CORE_SYNC_CORES];  /* Duration of the local tests per core */
+    uint32_t wall_cycles;                   /* Duration of the round on CM7_0 */
+    dual_core_sync_status_t status;         /* Synchronization with CM7_1 */
+} dual_core_report_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if (DUAL_CORE_AVAILABLE && !DUAL_CORE_SECONDARY)
+uint8_t Dual_Core_Run(dual_core_report_t *report);
+void Dual_Core_Print_Timing(void);
+#elif DUAL_CORE_AVAILABLE
+void Dual_Core_Secondary_Main(void);
+#endif
+
+#endif /* DUAL_CORE_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,184 @@
+/******************************************************************************
+* File Name:   dual_core_sync.c
+*
+* Description: This file contains the synchronization protocol of the dual core test:
+*              a barrier and a results record in memory shared by two cores. The file
+*              does not depend on the PDL so that it can be verified on the host.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "dual_core_sync.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DUAL_CORE_SYNC_CHECK(round, failed, cycles)     (~((round) ^ (failed) ^ (cycles)))
+
+/*****************************************************************************
+* Function Name: Dual_Core_Sync_Init
+******************************************************************************
+* Summary:
+* Clears the record. Called by one core before the other core is started.
+*
+* Parameters:
+*  record: Shared record
+*
+* Return:
+*  void
+*****************************************************************************/
+void Dual_Core_Sync_Init(dual_core_sync_record_t *record)
+{
+    for (uint32_t core = 0u; core < DUAL_CORE_SYNC_CORES; core++)
+    {
+        record->slot[core].arrival = 0u;
+        record->slot[core].round = 0u;
+        record->slot[core].failed = 0u;
+        record->slot[core].cycles = 0u;
+        /* Invalid check: no result is published before the first round */
+        record->slot[core].check = 0u;
+    }
+    DUAL_CORE_SYNC_CLEAN(record, sizeof(*record));
+    DUAL_CORE_SYNC_FENCE();
+}
+
+/*****************************************************************************
+* Function Name: Dual_Core_Sync_Barrier
+******************************************************************************
+* Summary:
+* Waits until both cores reached the same barrier. Everything written to the
+* slot of this core before the call is visible to the other core when it
+* leaves the barrier. A core is at most one barrier ahead of the other.
+*
+* Parameters:
+*  record:  Shared record
+*  core:    Index of this core, 0 or 1
+*  timeout: Timeout in DUAL_CORE_SYNC_TIME() units, or
+*           DUAL_CORE_SYNC_WAIT_FOREVER
+*
+* Return:
+*  dual_core_sync_status_t: DUAL_CORE_SYNC_OK or DUAL_CORE_SYNC_TIMEOUT
+*****************************************************************************/
+dual_core_sync_status_t Dual_Core_Sync_Barrier(dual_core_sync_record_t *record, uint32_t core,
+                                               uint32_t timeout)
+{
+    dual_core_sync_slot_t *own = &record->slot[core];
+    dual_core_sync_slot_t *other = &record->slot[core ^ 1u];
+    uint32_t arrival = own->arrival + 1u;
+    uint32_t start = DUAL_CORE_SYNC_TIME();
+
+    /* Commit the published data before the arrival */
+    DUAL_CORE_SYNC_CLEAN(own, sizeof(*own));
+    DUAL_CORE_SYNC_FENCE();
+    own->arrival = arrival;
+    DUAL_CORE_SYNC_CLEAN(own, sizeof(*own));
+
+    for (;;)
+    {
+        DUAL_CORE_SYNC_INVALIDATE(other, sizeof(*other));
+        if ((int32_t)(other->arrival - arrival) >= 0)
+        {
+            /* Order the reads of the published data after the arrival */
+            DUAL_CORE_SYNC_FENCE();
+            return DUAL_CORE_SYNC_OK;
+        }
+        if ((DUAL_CORE_SYNC_WAIT_FOREVER != timeout) &&
+            ((uint32_t)(DUAL_CORE_SYNC_TIME() - start) > timeout))
+        {
+            return DUAL_CORE_SYNC_TIMEOUT;
+        }
+        DUAL_CORE_SYNC_RELAX();
+    }
+}
+
+/*****************************************************************************
+* Function Name: Dual_Core_Sync_Exchange
+******************************************************************************
+* Summary:
+* Publishes the result of this core, waits for the other core and reads its
+* result. A round is a barrier followed by an exchange: the barrier keeps a
+* core from publishing the next result while the other core still reads the
+* current one.
+*
+* Parameters:
+*  record:  Shared record
+*  core:    Index of this core, 0 or 1
+*  own:     Result of this core
+*  other:   Result of the other core, valid with DUAL_CORE_SYNC_OK
+*  timeout: Timeout in DUAL_CORE_SYNC_TIME() units, or
+*           DUAL_CORE_SYNC_WAIT_FOREVER
+*
+* Return:
+*  dual_core_sync_status_t: DUAL_CORE_SYNC_OK, DUAL_CORE_SYNC_TIMEOUT, or
+*  DUAL_CORE_SYNC_CORRUPT when the other core did not publish a valid
+*  result of the same round
+*****************************************************************************/
+dual_core_sync_status_t Dual_Core_Sync_Exchange(dual_core_sync_record_t *record, uint32_t core,
+                                                const dual_core_sync_result_t *own,
+                                                dual_core_sync_result_t *other,
+                                                uint32_t timeout)
+{
+    dual_core_sync_slot_t *own_slot = &record->slot[core];
+    dual_core_sync_slot_t *other_slot = &record->slot[core ^ 1u];
+    dual_core_sync_status_t status;
+    uint32_t check;
+
+    own_slot->round = own->round;
+    own_slot->failed = own->failed;
+    own_slot->cycles = own->cycles;
+    own_slot->check = DUAL_CORE_SYNC_CHECK(own->round, own->failed, own->cycles);
+
+    status = Dual_Core_Sync_Barrier(record, core, timeout);
+    if (DUAL_CORE_SYNC_OK == status)
+    {
+        DUAL_CORE_SYNC_INVALIDATE(other_slot, sizeof(*other_slot));
+        other->round = other_slot->round;
+        other->failed = other_slot->failed;
+        other->cycles = other_slot->cycles;
+        check = other_slot->check;
+
+        if ((other->round != own->round) ||
+            (check != DUAL_CORE_SYNC_CHECK(other->round, other->failed, other->cycles)))
+        {
+            status = DUAL_CORE_SYNC_CORRUPT;
+        }
+    }
+
+    return status;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,144 @@
+/******************************************************************************
+* File Name:   dual_core_sync.h
+*
+* Description: This file is the public interface of dual_core_sync.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef DUAL_CORE_SYNC_H_
+#define DUAL_CORE_SYNC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if defined(DUAL_CORE_SYNC_HOST)
+/* Host model of the protocol (host/model/dual_core_model.c) */
+#include "dual_core_sync_host.h"
+#else
+#include "cy_pdl.h"
+
+/* Orders the record accesses of this core */
+#define DUAL_CORE_SYNC_FENCE()                  __DMB()
+
+/* Time base of the timeouts, in CPU cycles */
+#define DUAL_CORE_SYNC_TIME()                   (DWT->CYCCNT)
+
+/* Busy-wait step */
+#define DUAL_CORE_SYNC_RELAX()                  __NOP()
+
+/* The record is in cacheable SRAM: each core cleans the cache line of its
+ * own slot after writing it and invalidates the line of the other slot
+ * before reading it */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+#define DUAL_CORE_SYNC_CLEAN(addr, size) \
+    SCB_CleanDCache_by_Addr((volatile void *)(addr), (int32_t)(size))
+#define DUAL_CORE_SYNC_INVALIDATE(addr, size) \
+    SCB_InvalidateDCache_by_Addr((volatile void *)(addr), (int32_t)(size))
+#else
+#define DUAL_CORE_SYNC_CLEAN(addr, size)
+#define DUAL_CORE_SYNC_INVALIDATE(addr, size)
+#endif
+#endif
+
+/* Number of cores sharing a record */
+#define DUAL_CORE_SYNC_CORES                    (2u)
+
+/* Data cache line size. Each slot fills a line so that the cache
+ * maintenance of one core never touches the slot of the other core */
+#define DUAL_CORE_SYNC_LINE_SIZE                (32u)
+
+/* Timeout value of a wait that never times out */
+#define DUAL_CORE_SYNC_WAIT_FOREVER             (0u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Slot of one core. Only the owning core writes it */
+typedef struct
+{
+    volatile uint32_t arrival;  /* Number of barriers reached */
+    volatile uint32_t round;    /* Round of the published result */
+    volatile uint32_t failed;   /* Failed test mask of the result */
+    volatile uint32_t cycles;   /* Duration of the local tests */
+    volatile uint32_t check;    /* ~(round ^ failed ^ cycles) */
+    uint32_t reserved[(DUAL_CORE_SYNC_LINE_SIZE / sizeof(uint32_t)) - 5u];
+} dual_core_sync_slot_t;
+
+/* Shared results record, aligned to DUAL_CORE_SYNC_LINE_SIZE */
+typedef struct
+{
+    dual_core_sync_slot_t slot[DUAL_CORE_SYNC_CORES];
+} dual_core_sync_record_t;
+
+/* Result of the local tests of one core in one round */
+typedef struct
+{
+    uint32_t round;
+    uint32_t failed;
+    uint32_t cycles;
+} dual_core_sync_result_t;
+
+/* Synchronization status */
+typedef enum
+{
+    DUAL_CORE_SYNC_OK,          /* The other core arrived */
+    DUAL_CORE_SYNC_TIMEOUT,     /* The other core did not arrive in time */
+    DUAL_CORE_SYNC_CORRUPT      /* The other core arrived without a valid result */
+} dual_core_sync_status_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void Dual_Core_Sync_Init(dual_core_sync_record_t *record);
+dual_core_sync_status_t Dual_Core_Sync_Barrier(dual_core_sync_record_t *record, uint32_t core,
+                                               uint32_t timeout);
+dual_core_sync_status_t Dual_Core_Sync_Exchange(dual_core_sync_record_t *record, uint32_t core,
+                                                const dual_core_sync_result_t *own,
+                                                dual_core_sync_result_t *other,
+                                                uint32_t timeout);
+
+#endif /* DUAL_CORE_SYNC_H_ */
+
+
+/* [] END OF FILE */
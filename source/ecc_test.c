@@ -0,0 +1,371 @@
+/******************************************************************************
+* File Name:   ecc_test.c
+*
+* Description: ECC memory integrity test for XMC7000. A correctable error is
+*              injected into an SRAM word and a flash word to prove the detection
+*              path from the memory controllers to the fault structure. The
+*              background scrub reads the SRAM block by block: single bit errors
+*              are corrected by the hardware and written back, double bit errors
+*              fail the test. Replaces the March tests on parts with ECC.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "ecc_test.h"
+
+#if ECC_TEST_AVAILABLE
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Size of a D-cache line: the SRAM probe owns a whole line */
+#define ECC_CACHE_LINE_BYTES    (32u)
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+#define ECC_CACHE_CLEAN(addr, size) \
+    SCB_CleanDCache_by_Addr((volatile void *)(addr), (int32_t)(size))
+#define ECC_CACHE_INVALIDATE(addr, size) \
+    SCB_InvalidateDCache_by_Addr((volatile void *)(addr), (int32_t)(size))
+#else
+#define ECC_CACHE_CLEAN(addr, size)
+#define ECC_CACHE_INVALIDATE(addr, size)
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* SRAM word written with an injected parity. Zero, so that the check bits of
+ * the data are zero */
+CY_ALIGN(ECC_CACHE_LINE_BYTES) static volatile uint32_t
+    ecc_sram_probe[ECC_CACHE_LINE_BYTES / sizeof(uint32_t)];
+
+/* Flash word read with an injected parity. The flash ECC word is 64 bits */
+CY_ALIGN(sizeof(uint64_t)) static const volatile uint64_t ecc_flash_probe = 0u;
+
+/* State of the scrub */
+static struct
+{
+    uintptr_t next;
+    uintptr_t error_address;
+    uint32_t corrected;
+} ecc_ctx;
+
+/*****************************************************************************
+* Function Name: Ecc_Fault_Get
+******************************************************************************
+* Summary:
+* Returns the ECC error latched by the fault structure, if any, and clears it
+* so that the next pending error is latched.
+*
+* Parameters:
+*  address: returns the address of the error
+*
+* Return:
+*  cy_en_SysFault_source_t: source of the error, CY_SYSFAULT_NO_FAULT if none
+*****************************************************************************/
+static cy_en_SysFault_source_t Ecc_Fault_Get(uint32_t *address)
+{
+    cy_en_SysFault_source_t source = Cy_SysFault_GetErrorSource(ECC_FAULT_STRUCT);
+
+    if (CY_SYSFAULT_NO_FAULT != source)
+    {
+        *address = Cy_SysFault_GetFaultData(ECC_FAULT_STRUCT, CY_SYSFAULT_DATA0);
+        Cy_SysFault_ClearStatus(ECC_FAULT_STRUCT);
+    }
+    return source;
+}
+
+/*****************************************************************************
+* Function Name: Ecc_Fault_Wait
+******************************************************************************
+* Summary:
+* Waits for an injected error to be reported by the fault structure.
+*
+* Parameters:
+*  expected: source of the injected error
+*  address: address of the injected error
+*
+* Return:
+*  uint8_t: OK_STATUS if the error was reported at this address,
+*           ERROR_STATUS otherwise
+*****************************************************************************/
+static uint8_t Ecc_Fault_Wait(cy_en_SysFault_source_t expected, uint32_t address)
+{
+    uint32_t start = CYCLE_COUNTER_GET();
+    uint32_t fault_address = 0u;
+    cy_en_SysFault_source_t source;
+
+    do
+    {
+        source = Ecc_Fault_Get(&fault_address);
+    } while ((CY_SYSFAULT_NO_FAULT == source) &&
+             ((CYCLE_COUNTER_GET() - start) < ECC_FAULT_TIMEOUT_CYCLES));
+
+    if ((expected != source) || (address != fault_address))
+    {
+        ecc_ctx.error_address = (uintptr_t)address;
+        return ERROR_STATUS;
+    }
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Ecc_Test_Init
+******************************************************************************
+* Summary:
+* Routes the correctable and non-correctable errors of SRAM0 and of the main
+* flash to the fault structure and starts the scrub at the first word.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: OK_STATUS, ERROR_STATUS if the fault structure cannot be set up
+*****************************************************************************/
+uint8_t Ecc_Test_Init(void)
+{
+    uint32_t address;
+    cy_stc_SysFault_t config =
+    {
+        .ResetEnable   = false,
+        .OutputEnable  = false,
+        .TriggerEnable = false,
+    };
+
+    if (CY_SYSFAULT_SUCCESS != Cy_SysFault_Init(ECC_FAULT_STRUCT, &config))
+    {
+        return ERROR_STATUS;
+    }
+    Cy_SysFault_SetMaskByIdx(ECC_FAULT_STRUCT, CPUSS_RAMC0_C_ECC);
+    Cy_SysFault_SetMaskByIdx(ECC_FAULT_STRUCT, CPUSS_RAMC0_NC_ECC);
+    Cy_SysFault_SetMaskByIdx(ECC_FAULT_STRUCT, CPUSS_FLASHC_MAIN_C_ECC);
+    Cy_SysFault_SetMaskByIdx(ECC_FAULT_STRUCT, CPUSS_FLASHC_MAIN_NC_ECC);
+
+    /* Drop errors latched before the mask was set */
+    while (CY_SYSFAULT_NO_FAULT != Ecc_Fault_Get(&address))
+    {
+    }
+
+    ecc_ctx.next = ECC_SCRUB_START;
+    ecc_ctx.error_address = 0u;
+    ecc_ctx.corrected = 0u;
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Ecc_Test_Inject
+******************************************************************************
+* Summary:
+* Proves the ECC detection path. A single bit error is injected into the SRAM
+* probe on its write and into the flash probe on its read. Each must be
+* corrected and reported with its address. Non-correctable errors are not
+* injected: they raise a bus fault on the read.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: OK_STATUS, ERROR_STATUS if an error is not reported
+*****************************************************************************/
+uint8_t Ecc_Test_Inject(void)
+{
+    uint32_t interrupt_state;
+    uint32_t value;
+    uint8_t status;
+
+    /* SRAM: the parity is stored with the next write of the word */
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    CPUSS->ECC_CTL = _VAL2FLD(CPUSS_ECC_CTL_WORD_ADDR,
+                              ((uintptr_t)&ecc_sram_probe[0] - CY_SRAM_BASE) / sizeof(uint32_t)) |
+                     _VAL2FLD(CPUSS_ECC_CTL_PARITY, ECC_SRAM_INJECT_PARITY);
+    CPUSS->RAM0_CTL0 |= CPUSS_RAM0_CTL0_ECC_INJ_EN_Msk;
+    ecc_sram_probe[0] = 0u;
+    ECC_CACHE_CLEAN(ecc_sram_probe, sizeof(ecc_sram_probe));
+    __DSB();
+    CPUSS->RAM0_CTL0 &= ~CPUSS_RAM0_CTL0_ECC_INJ_EN_Msk;
+    ECC_CACHE_INVALIDATE(ecc_sram_probe, sizeof(ecc_sram_probe));
+    value = ecc_sram_probe[0];
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    status = Ecc_Fault_Wait(CPUSS_RAMC0_C_ECC, (uint32_t)(uintptr_t)&ecc_sram_probe[0]);
+
+    /* The corrected data is not written back: restore valid check bits */
+    ecc_sram_probe[0] = 0u;
+    ECC_CACHE_CLEAN(ecc_sram_probe, sizeof(ecc_sram_probe));
+    if ((OK_STATUS != status) || (0u != value))
+    {
+        ecc_ctx.error_address = (uintptr_t)&ecc_sram_probe[0];
+        return ERROR_STATUS;
+    }
+
+    /* Flash: the parity replaces the stored one on the next read of the word,
+     * which must come from the flash and not from the buffers or caches */
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    FLASHC->ECC_CTL = _VAL2FLD(FLASHC_ECC_CTL_WORD_ADDR,
+                               ((uintptr_t)&ecc_flash_probe - CY_FLASH_BASE) / sizeof(uint64_t)) |
+                      _VAL2FLD(FLASHC_ECC_CTL_PARITY, ECC_FLASH_INJECT_PARITY);
+    FLASHC->FLASH_CTL |= FLASHC_FLASH_CTL_MAIN_ECC_INJ_EN_Msk;
+    FLASHC->FLASH_CMD = FLASHC_FLASH_CMD_INV_Msk;
+    while (0u != (FLASHC->FLASH_CMD & FLASHC_FLASH_CMD_INV_Msk))
+    {
+    }
+    ECC_CACHE_INVALIDATE(&ecc_flash_probe, sizeof(ecc_flash_probe));
+    value = (uint32_t)ecc_flash_probe;
+    FLASHC->FLASH_CTL &= ~FLASHC_FLASH_CTL_MAIN_ECC_INJ_EN_Msk;
+    FLASHC->FLASH_CMD = FLASHC_FLASH_CMD_INV_Msk;
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    status = Ecc_Fault_Wait(CPUSS_FLASHC_MAIN_C_ECC, (uint32_t)(uintptr_t)&ecc_flash_probe);
+    if ((OK_STATUS != status) || (0u != value))
+    {
+        ecc_ctx.error_address = (uintptr_t)&ecc_flash_probe;
+        return ERROR_STATUS;
+    }
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Ecc_Test_Scrub_Step
+******************************************************************************
+* Summary:
+* Reads the next ECC_SCRUB_WORDS_PER_STEP words of the scrubbed region, then
+* handles the errors reported since the previous step. A correctable SRAM
+* error is written back with the corrected data. Correctable flash errors,
+* reported by any flash read, are counted. A non-correctable error fails the
+* test.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS at the end of the
+*           region (the next step starts over), ERROR_STATUS
+*****************************************************************************/
+uint8_t Ecc_Test_Scrub_Step(void)
+{
+    volatile const uint32_t *word = (volatile const uint32_t *)ecc_ctx.next;
+    uintptr_t end = ecc_ctx.next + (ECC_SCRUB_WORDS_PER_STEP * sizeof(uint32_t));
+    uint32_t interrupt_state;
+    uint32_t address = 0u;
+    cy_en_SysFault_source_t source;
+
+    if (end > ECC_SCRUB_END)
+    {
+        end = ECC_SCRUB_END;
+    }
+
+    /* The ECC logic checks the words as they are read */
+    while ((uintptr_t)word < end)
+    {
+        (void)*word;
+        word++;
+    }
+    ecc_ctx.next = end;
+
+    for (source = Ecc_Fault_Get(&address); CY_SYSFAULT_NO_FAULT != source;
+         source = Ecc_Fault_Get(&address))
+    {
+        if (CPUSS_RAMC0_C_ECC == source)
+        {
+            /* Write back the corrected word with valid check bits */
+            volatile uint32_t *corrected = (volatile uint32_t *)(address & ~(sizeof(uint32_t) - 1u));
+
+            interrupt_state = Cy_SysLib_EnterCriticalSection();
+            *corrected = *corrected;
+            ECC_CACHE_CLEAN(corrected, sizeof(uint32_t));
+            Cy_SysLib_ExitCriticalSection(interrupt_state);
+            ecc_ctx.corrected++;
+        }
+        else if (CPUSS_FLASHC_MAIN_C_ECC == source)
+        {
+            ecc_ctx.corrected++;
+        }
+        else
+        {
+            ecc_ctx.error_address = (uintptr_t)address;
+            return ERROR_STATUS;
+        }
+    }
+
+    if (ecc_ctx.next >= ECC_SCRUB_END)
+    {
+        ecc_ctx.next = ECC_SCRUB_START;
+        return PASS_COMPLETE_STATUS;
+    }
+    return PASS_STILL_TESTING_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Ecc_Test_Get_Error_Address
+******************************************************************************
+* Summary:
+* Returns the address of the last failure.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uintptr_t: address of the probe or of the non-correctable error
+*****************************************************************************/
+uintptr_t Ecc_Test_Get_Error_Address(void)
+{
+    return ecc_ctx.error_address;
+}
+
+/*****************************************************************************
+* Function Name: Ecc_Test_Get_Corrected_Count
+******************************************************************************
+* Summary:
+* Returns the number of correctable errors found since Ecc_Test_Init(),
+* injected errors excluded.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: number of correctable errors
+*****************************************************************************/
+uint32_t Ecc_Test_Get_Corrected_Count(void)
+{
+    return ecc_ctx.corrected;
+}
+#endif /* ECC_TEST_AVAILABLE */
+
+
+/* [] END OF FILE */
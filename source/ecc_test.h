@@ -0,0 +1,106 @@
+/******************************************************************************
+* File Name:   ecc_test.h
+*
+* Description: Header of the ECC memory integrity test for XMC7000: error
+*              injection through the SRAM and flash controllers and read-through
+*              scrub of the SRAM, reported by a fault structure.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef ECC_TEST_H_
+#define ECC_TEST_H_
+
+#include "self_test.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if (ECC_TEST_ENABLE && COMPONENT_CAT1C)
+#define ECC_TEST_AVAILABLE              (1u)
+#else
+#define ECC_TEST_AVAILABLE              (0u)
+#endif
+
+/* Fault structure that collects the ECC errors. Must not be used by the CM0+
+ * image or another core */
+#define ECC_FAULT_STRUCT                (FAULT_STRUCT1)
+
+/* Scrubbed SRAM region: data and bss sections, which the startup code
+ * writes. Every word must have been written since power-on, otherwise its
+ * check bits are undefined, so the heap, whose free blocks are never
+ * written, is not scrubbed. The stack is checked by the ECC logic on every
+ * access */
+#define ECC_SCRUB_START                 ((uintptr_t)__data_start__)
+#define ECC_SCRUB_END                   ((uintptr_t)__bss_end__)
+
+/* Number of words read per call of Ecc_Test_Scrub_Step() */
+#define ECC_SCRUB_WORDS_PER_STEP        (1024u)
+
+/* Time an injected error takes to reach the fault structure, in CPU cycles */
+#define ECC_FAULT_TIMEOUT_CYCLES        (10000u)
+
+/* Parity injected into the probe words. The check bits of a zero word are
+ * zero, so one set bit is a correctable single bit error */
+#define ECC_SRAM_INJECT_PARITY          (0x01u)
+#define ECC_FLASH_INJECT_PARITY         (0x01u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Linker script symbols */
+extern uint32_t __data_start__[];
+extern uint32_t __bss_end__[];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if ECC_TEST_AVAILABLE
+uint8_t Ecc_Test_Init(void);
+uint8_t Ecc_Test_Inject(void);
+uint8_t Ecc_Test_Scrub_Step(void);
+uintptr_t Ecc_Test_Get_Error_Address(void);
+uint32_t Ecc_Test_Get_Corrected_Count(void);
+#endif
+
+#endif /* ECC_TEST_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,837 @@
+/******************************************************************************
+* File Name:   fast_boot.c
+*
+* Description: This file implements the fast boot profile: the mandatory
+*              tests run before the application, the other tests run in
+*              slices between its control cycles with a completion deadline.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "fast_boot.h"
+#include "flow_monitor.h"
+#include "mpu_guard.h"
+#include "fpu_datapath_test.h"
+#include "ecc_test.h"
+
+#if FAST_BOOT_ENABLE
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* All background tests are complete */
+#define FAST_BOOT_NO_TEST               (0xFFu)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* One test of the profile. The step function is called with first = true at
+ * the start of the test and returns PASS_STILL_TESTING_STATUS until the test
+ * is complete */
+typedef struct
+{
+    const char *name;
+    uint8_t (*step)(bool first);
+    bool background;
+} fast_boot_test_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint8_t Fast_Boot_Start_Up_Step(bool first);
+static uint8_t Fast_Boot_Pc_Step(bool first);
+static uint8_t Fast_Boot_Cpu_Step(bool first);
+static uint8_t Fast_Boot_Stack_Step(bool first);
+static uint8_t Fast_Boot_Flow_Step(bool first);
+static uint8_t Fast_Boot_Io_Step(bool first);
+static uint8_t Fast_Boot_Fpu_Step(bool first);
+#if (!defined(CY_DEVICE_PSOC6ABLE2)&& !defined (CY_DEVICE_SECURE))
+static uint8_t Fast_Boot_Dmac_Step(bool first);
+#endif
+#if !defined (CY_DEVICE_SECURE)
+static uint8_t Fast_Boot_Dma_Dw_Step(bool first);
+#endif
+static uint8_t Fast_Boot_Ipc_Step(bool first);
+static uint8_t Fast_Boot_Interrupt_Step(bool first);
+static uint8_t Fast_Boot_Clock_Step(bool first);
+#if ECC_TEST_AVAILABLE
+static uint8_t Fast_Boot_Ecc_Inject_Step(bool first);
+static uint8_t Fast_Boot_Ecc_Scrub_Step(bool first);
+#endif
+static uint8_t Fast_Boot_Flash_Step(bool first);
+static uint8_t Fast_Boot_Wdt_Step(bool first);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Tests in execution order: the mandatory tests first, the watchdog test
+ * last as it resets the device */
+static const fast_boot_test_t fast_boot_tests[] =
+{
+    {"Start-Up Register Test",  Fast_Boot_Start_Up_Step,    false},
+    {"Program Counter Test",    Fast_Boot_Pc_Step,          false},
+    {"CPU Register Test",       Fast_Boot_Cpu_Step,         false},
+#if MPU_STACK_GUARD_ENABLE
+    {"Stack Guard (MPU) Test",  Fast_Boot_Stack_Step,       false},
+#else
+    {"Stack Memory Test",       Fast_Boot_Stack_Step,       false},
+#endif
+    {"Program Flow Test",       Fast_Boot_Flow_Step,        true},
+    {"GPIO Test",               Fast_Boot_Io_Step,          true},
+    {"FPU Register Test",       Fast_Boot_Fpu_Step,         true},
+#if (!defined(CY_DEVICE_PSOC6ABLE2)&& !defined (CY_DEVICE_SECURE))
+    {"DMAC Test",               Fast_Boot_Dmac_Step,        true},
+#endif
+#if !defined (CY_DEVICE_SECURE)
+    {"DMA DW Test",             Fast_Boot_Dma_Dw_Step,      true},
+#endif
+    {"IPC Test",                Fast_Boot_Ipc_Step,         true},
+    {"Interrupt Test",          Fast_Boot_Interrupt_Step,   true},
+    {"Clock Test",              Fast_Boot_Clock_Step,       true},
+#if ECC_TEST_AVAILABLE
+    {"ECC Injection Test",      Fast_Boot_Ecc_Inject_Step,  true},
+    {"SRAM ECC Scrub",          Fast_Boot_Ecc_Scrub_Step,   true},
+#else
+    {"SRAM March Test",         Sram_March_Step,            true},
+    {"Stack March Test",        Stack_March_Step,           true},
+#endif
+    {"Flash Test",              Fast_Boot_Flash_Step,       true},
+#if COMPONENT_CAT1C && WWDT_SELF_TEST_ENABLE
+    {"Windowed Watchdog Test",  Fast_Boot_Wdt_Step,         true},
+#else
+    {"Watchdog Test",           Fast_Boot_Wdt_Step,         true},
+#endif
+};
+
+#define FAST_BOOT_TEST_COUNT    (sizeof(fast_boot_tests) / sizeof(fast_boot_tests[0]))
+
+/* True for the step of the test that overwrites the stack overflow pattern */
+#if ECC_TEST_AVAILABLE
+#define FAST_BOOT_OVERWRITES_STACK(step)    (false)
+#else
+#define FAST_BOOT_OVERWRITES_STACK(step)    (Stack_March_Step == (step))
+#endif
+#define FAST_BOOT_WDT_INDEX     (FAST_BOOT_TEST_COUNT - 1u)
+
+static struct
+{
+    fast_boot_failure_cb_t failure_cb;
+    fast_boot_reset_allowed_cb_t reset_allowed_cb;
+    uint8_t status[FAST_BOOT_TEST_COUNT];   /* Result of each test */
+    uint8_t current;                        /* Background test in progress */
+    uint8_t stack_index;                    /* Index of the stack test */
+    bool first;                             /* The next step starts the current test */
+    bool waiting;                           /* The watchdog test waits for the permission */
+    bool started;                           /* The first control cycle was reached */
+    bool deadline_missed;
+    bool check_failed;                      /* Run_Time_Check() failed and was reported */
+    uint32_t boot_cycles;                   /* Duration of the mandatory tests */
+    uint32_t app_cycles;                    /* Cycle counter at the first control cycle */
+    uint32_t last_cycles;                   /* Cycle counter at the previous update */
+    uint64_t elapsed_cycles;                /* Cycles since the first control cycle */
+    uint64_t complete_cycles;               /* Cycles from the first control cycle to completion */
+    uint64_t deadline_cycles;
+} fast_boot;
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Done
+******************************************************************************
+* Summary:
+* Returns true when a test status is a final result.
+*
+* Parameters:
+*  status: Test status
+*
+* Return:
+*  bool: false for PASS_STILL_TESTING_STATUS
+*****************************************************************************/
+static bool Fast_Boot_Done(uint8_t status)
+{
+    return (PASS_STILL_TESTING_STATUS != status);
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Passed
+******************************************************************************
+* Summary:
+* Returns true when a test status is a pass.
+*
+* Parameters:
+*  status: Test status
+*
+* Return:
+*  bool: true for OK_STATUS or PASS_COMPLETE_STATUS
+*****************************************************************************/
+static bool Fast_Boot_Passed(uint8_t status)
+{
+    return (OK_STATUS == status) || (PASS_COMPLETE_STATUS == status);
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Start_Up_Step
+******************************************************************************
+* Summary:
+* Start-up configuration registers test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Start_Up_Step(bool first)
+{
+    return Start_Up_Check();
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Pc_Step
+******************************************************************************
+* Summary:
+* Program counter test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Pc_Step(bool first)
+{
+    return SelfTest_PC();
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Cpu_Step
+******************************************************************************
+* Summary:
+* CPU registers test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Cpu_Step(bool first)
+{
+    return SelfTest_CPU_Registers();
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Stack_Step
+******************************************************************************
+* Summary:
+* Stack overflow test: arms the MPU stack guard, or writes the stack
+* overflow pattern, which Fast_Boot_Poll() then checks at every call.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Stack_Step(bool first)
+{
+    uint8_t status;
+
+#if MPU_STACK_GUARD_ENABLE
+    status = Mpu_Guard_Init();
+    if (OK_STATUS == status)
+    {
+        status = Mpu_Guard_Probe();
+    }
+#else
+    SelfTests_Init_Stack_Test(PATTERN_BLOCK_SIZE);
+    status = SelfTests_Stack_Check();
+#endif
+    return status;
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Flow_Step
+******************************************************************************
+* Summary:
+* Program flow test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Flow_Step(bool first)
+{
+    return SelfTest_PROGRAM_FLOW();
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Io_Step
+******************************************************************************
+* Summary:
+* GPIO test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Io_Step(bool first)
+{
+    return SelfTest_IO();
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Fpu_Step
+******************************************************************************
+* Summary:
+* FPU registers test, followed by the FPU datapath test when enabled.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Fpu_Step(bool first)
+{
+    uint32_t fpu_type;
+    uint8_t status;
+
+#if COMPONENT_CAT1A
+    Cy_SystemInitFpuEnable();
+#endif
+    fpu_type = SCB_GetFPUType();
+    if (0u == fpu_type)
+    {
+        /* No FPU present */
+        return ERROR_STATUS;
+    }
+
+    status = SelfTest_FPU_Registers();
+#if FPU_DATAPATH_TEST_ENABLE
+    if (OK_STATUS == status)
+    {
+        status = FPU_Datapath_Test(fpu_type);
+    }
+#endif
+    return status;
+}
+
+#if (!defined(CY_DEVICE_PSOC6ABLE2)&& !defined (CY_DEVICE_SECURE))
+/*****************************************************************************
+* Function Name: Fast_Boot_Dmac_Step
+******************************************************************************
+* Summary:
+* DMAC test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Dmac_Step(bool first)
+{
+    return SelfTest_DMAC(DMAC_0_HW, DMAC_0_CHANNEL, &DMAC_0_Descriptor_0, &DMAC_0_Descriptor_1,
+            &DMAC_0_Descriptor_0_config,  &DMAC_0_Descriptor_1_config,
+            &DMAC_0_channelConfig, DMAC_INPUT_TRIG_MUX);
+}
+#endif
+
+#if !defined (CY_DEVICE_SECURE)
+/*****************************************************************************
+* Function Name: Fast_Boot_Dma_Dw_Step
+******************************************************************************
+* Summary:
+* DMA DW test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Dma_Dw_Step(bool first)
+{
+    return SelfTest_DMA_DW(DMA_DW_HW, DMA_DW_CHANNEL, &DMA_DW_Descriptor_0, &DMA_DW_Descriptor_1,
+            &DMA_DW_Descriptor_0_config,  &DMA_DW_Descriptor_1_config,
+            &DMA_DW_channelConfig, DMA_DW_INPUT_TRIG_MUX);
+}
+#endif
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Ipc_Step
+******************************************************************************
+* Summary:
+* IPC test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Ipc_Step(bool first)
+{
+    return SelfTest_IPC();
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Interrupt_Step
+******************************************************************************
+* Summary:
+* Interrupt test.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Interrupt_Step(bool first)
+{
+    Interrupt_Test_Init();
+    return SelfTest_Interrupt(CYBSP_TIMER_HW, CYBSP_TIMER_NUM);
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Clock_Step
+******************************************************************************
+* Summary:
+* One measurement of the clock test. Disables the WDT, used as reference
+* clock, when the test is complete.
+*
+* Parameters:
+*  first: Initialize the test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Clock_Step(bool first)
+{
+    uint8_t status;
+
+    if (first)
+    {
+        Clock_Test_Init();
+    }
+    status = SelfTest_Clock(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM);
+    if (Fast_Boot_Done(status))
+    {
+        Cy_SysLib_ClearResetReason();
+        Cy_WDT_ClearInterrupt();
+        Cy_WDT_Unlock();
+        Cy_WDT_Disable();
+    }
+    return status;
+}
+
+#if ECC_TEST_AVAILABLE
+/*****************************************************************************
+* Function Name: Fast_Boot_Ecc_Inject_Step
+******************************************************************************
+* Summary:
+* ECC injection test: proves the SRAM and flash ECC detection path.
+*
+* Parameters:
+*  first: Unused, single step test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Ecc_Inject_Step(bool first)
+{
+    uint8_t status = Ecc_Test_Init();
+
+    if (OK_STATUS == status)
+    {
+        status = Ecc_Test_Inject();
+    }
+    return status;
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Ecc_Scrub_Step
+******************************************************************************
+* Summary:
+* ECC_SCRUB_WORDS_PER_STEP words of the SRAM ECC scrub, one pass of the
+* scrubbed region.
+*
+* Parameters:
+*  first: Unused, the scrub was started by the ECC injection test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Ecc_Scrub_Step(bool first)
+{
+    return Ecc_Test_Scrub_Step();
+}
+#endif /* ECC_TEST_AVAILABLE */
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Flash_Step
+******************************************************************************
+* Summary:
+* FLASH_DOUBLE_WORDS_TO_TEST double words of the flash checksum test, or
+* one slice of the most urgent flash region, with the time since the first
+* control cycle.
+*
+* Parameters:
+*  first: Initialize the test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Fast_Boot_Flash_Step(bool first)
+{
+    return Flash_Step(first, (uint32_t)(fast_boot.elapsed_cycles / (SystemCoreClock / 1000u)));
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Wdt_Step
+******************************************************************************
+* Summary:
+* Watchdog test. Waits until the application allows the reset, then starts
+* the WDT and waits for the reset. Fast_Boot_Start() completes the test
+* after the reset.
+*
+* Parameters:
+*  first: Unused
+*
+* Return:
+*  uint8_t: PASS_STILL_TESTING_STATUS while the reset is not allowed,
+*           OK_STATUS after a WDT reset, ERROR_STATUS if the reset does
+*           not come
+*****************************************************************************/
+static uint8_t Fast_Boot_Wdt_Step(bool first)
+{
+    if ((0u == (Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HWWDT)) &&
+        (NULL != fast_boot.reset_allowed_cb) && !fast_boot.reset_allowed_cb())
+    {
+        fast_boot.waiting = true;
+        return PASS_STILL_TESTING_STATUS;
+    }
+
+#if COMPONENT_CAT1C && WWDT_SELF_TEST_ENABLE
+    return SelfTest_Windowed_WDT();
+#else
+    return SelfTest_WDT();
+#endif
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Fail
+******************************************************************************
+* Summary:
+* Reports a failure to the application.
+*
+* Parameters:
+*  index:   Test index
+*  failure: Failure type
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Fast_Boot_Fail(uint32_t index, fast_boot_failure_t failure)
+{
+    if (NULL != fast_boot.failure_cb)
+    {
+        fast_boot.failure_cb(fast_boot_tests[index].name, failure);
+    }
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Update_Time
+******************************************************************************
+* Summary:
+* Adds the cycles since the previous update to the time since the first
+* control cycle. Called at least once per control cycle, so the 32-bit
+* cycle counter does not wrap between two updates.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Fast_Boot_Update_Time(void)
+{
+    uint32_t now = CYCLE_COUNTER_GET();
+
+    fast_boot.elapsed_cycles += (uint32_t)(now - fast_boot.last_cycles);
+    fast_boot.last_cycles = now;
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Start
+******************************************************************************
+* Summary:
+* Runs the mandatory tests: start-up registers, program counter, CPU
+* registers and stack. After a WDT reset, also completes the watchdog test
+* before the clock test clears the reset reason. The application starts its
+* control loop when this function returns OK_STATUS and calls
+* Fast_Boot_Poll() in every control cycle.
+*
+* Parameters:
+*  failure_cb:       Called when a background test fails or misses the
+*                    deadline, can be NULL
+*  reset_allowed_cb: Asked before the watchdog test resets the device,
+*                    NULL to allow the reset at any time
+*
+* Return:
+*  uint8_t: OK_STATUS, or ERROR_STATUS if a mandatory test failed
+*****************************************************************************/
+uint8_t Fast_Boot_Start(fast_boot_failure_cb_t failure_cb,
+                        fast_boot_reset_allowed_cb_t reset_allowed_cb)
+{
+    uint32_t start = CYCLE_COUNTER_GET();
+    uint8_t result = OK_STATUS;
+    uint32_t i;
+
+    /* Entry of the program flow monitor, checked by every poll */
+    FLOW_MONITOR_INIT(FAST_BOOT_START);
+
+    fast_boot.failure_cb = failure_cb;
+    fast_boot.reset_allowed_cb = reset_allowed_cb;
+    fast_boot.deadline_cycles = (uint64_t)(SystemCoreClock / 1000u) * FAST_BOOT_DEADLINE_MS;
+    for (i = 0u; i < FAST_BOOT_TEST_COUNT; i++)
+    {
+        fast_boot.status[i] = PASS_STILL_TESTING_STATUS;
+        if (Fast_Boot_Stack_Step == fast_boot_tests[i].step)
+        {
+            fast_boot.stack_index = (uint8_t)i;
+        }
+    }
+
+    for (i = 0u; !fast_boot_tests[i].background; i++)
+    {
+        fast_boot.status[i] = fast_boot_tests[i].step(true);
+        if (!Fast_Boot_Passed(fast_boot.status[i]))
+        {
+            result = ERROR_STATUS;
+        }
+    }
+    fast_boot.current = (uint8_t)i;
+    fast_boot.first = true;
+
+    if ((OK_STATUS == result) &&
+        (0u != (Cy_SysLib_GetResetReason() & CY_SYSLIB_RESET_HWWDT)))
+    {
+        fast_boot.status[FAST_BOOT_WDT_INDEX] = Fast_Boot_Wdt_Step(true);
+    }
+
+    fast_boot.boot_cycles = CYCLE_COUNTER_GET() - start;
+    return result;
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Poll
+******************************************************************************
+* Summary:
+* Runs the background tests for FAST_BOOT_SLICE_US, at least one step. The
+* first call marks the first control cycle. Every call also checks the
+* stack overflow pattern, the deadline of the background tests and, with
+* Run_Time_Check(), the signature of the program flow monitor.
+* Failures are reported through the failure callback.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: PASS_STILL_TESTING_STATUS while background tests are pending,
+*           PASS_COMPLETE_STATUS when all tests are complete
+*****************************************************************************/
+uint8_t Fast_Boot_Poll(void)
+{
+    uint32_t slice = (SystemCoreClock / 1000000u) * FAST_BOOT_SLICE_US;
+    uint32_t start = CYCLE_COUNTER_GET();
+    uint8_t status;
+
+    if (!fast_boot.started)
+    {
+        /* First control cycle, the cycle counter runs from main() */
+        fast_boot.started = true;
+        fast_boot.app_cycles = start;
+        fast_boot.last_cycles = start;
+        SELF_TEST_APP_START();
+    }
+    if ((ERROR_STATUS == Run_Time_Check()) && !fast_boot.check_failed)
+    {
+        fast_boot.check_failed = true;
+        if (NULL != fast_boot.failure_cb)
+        {
+            fast_boot.failure_cb("Program Flow Monitor", FAST_BOOT_TEST_ERROR);
+        }
+    }
+    if (FAST_BOOT_NO_TEST == fast_boot.current)
+    {
+        return PASS_COMPLETE_STATUS;
+    }
+
+    fast_boot.waiting = false;
+    do
+    {
+        status = fast_boot.status[fast_boot.current];
+        if (!Fast_Boot_Done(status))
+        {
+            status = fast_boot_tests[fast_boot.current].step(fast_boot.first);
+            fast_boot.first = false;
+        }
+        if (Fast_Boot_Done(status))
+        {
+            fast_boot.status[fast_boot.current] = status;
+            if (!Fast_Boot_Passed(status))
+            {
+                Fast_Boot_Fail(fast_boot.current, FAST_BOOT_TEST_ERROR);
+            }
+            fast_boot.current++;
+            fast_boot.first = true;
+            if (fast_boot.current >= FAST_BOOT_TEST_COUNT)
+            {
+                fast_boot.current = FAST_BOOT_NO_TEST;
+            }
+        }
+    } while ((FAST_BOOT_NO_TEST != fast_boot.current) && !fast_boot.waiting &&
+             ((uint32_t)(CYCLE_COUNTER_GET() - start) < slice));
+
+#if !MPU_STACK_GUARD_ENABLE
+    /* The stack March test overwrites the pattern while it runs */
+    if (((FAST_BOOT_NO_TEST == fast_boot.current) ||
+         !FAST_BOOT_OVERWRITES_STACK(fast_boot_tests[fast_boot.current].step) ||
+         fast_boot.first) &&
+        Fast_Boot_Passed(fast_boot.status[fast_boot.stack_index]))
+    {
+        status = SelfTests_Stack_Check();
+        if (OK_STATUS != status)
+        {
+            fast_boot.status[fast_boot.stack_index] = status;
+            Fast_Boot_Fail(fast_boot.stack_index, FAST_BOOT_TEST_ERROR);
+        }
+    }
+#endif
+
+    Fast_Boot_Update_Time();
+    if (FAST_BOOT_NO_TEST == fast_boot.current)
+    {
+        fast_boot.complete_cycles = fast_boot.elapsed_cycles;
+        return PASS_COMPLETE_STATUS;
+    }
+    if ((fast_boot.elapsed_cycles > fast_boot.deadline_cycles) && !fast_boot.deadline_missed)
+    {
+        fast_boot.deadline_missed = true;
+        Fast_Boot_Fail(fast_boot.current, FAST_BOOT_DEADLINE_MISSED);
+    }
+    return PASS_STILL_TESTING_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Print_Report
+******************************************************************************
+* Summary:
+* Prints the result of every test that has run in the format of the test
+* table.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Fast_Boot_Print_Report(void)
+{
+    uint8_t ret = OK_STATUS;
+    uint32_t i;
+
+    for (i = 0u; i < FAST_BOOT_TEST_COUNT; i++)
+    {
+        if(ERROR_STATUS == ret)
+        {
+            printf("\r\n");
+        }
+        ret = fast_boot.status[i];
+        if (PASS_STILL_TESTING_STATUS == ret)
+        {
+            /* Not run */
+            continue;
+        }
+        PRINT_TEST_RESULT(ip_index++, fast_boot_tests[i].name, ret);
+    }
+    if(ERROR_STATUS == ret)
+    {
+        printf("\r\n");
+    }
+}
+
+/*****************************************************************************
+* Function Name: Fast_Boot_Print_Timing
+******************************************************************************
+* Summary:
+* Prints the duration of the mandatory tests, the time from the start of
+* the cycle counter to the first control cycle and the time from the first
+* control cycle to the completion of the background tests.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Fast_Boot_Print_Timing(void)
+{
+    uint32_t cycles_per_us = SystemCoreClock / 1000000u;
+
+    printf("Fast boot: mandatory tests %lu us, first control cycle at %lu us\r\n",
+           (unsigned long)(fast_boot.boot_cycles / cycles_per_us),
+           (unsigned long)(fast_boot.app_cycles / cycles_per_us));
+    if (FAST_BOOT_NO_TEST == fast_boot.current)
+    {
+        printf("Fast boot: background tests %lu ms after the first control cycle "
+               "(deadline %lu ms)\r\n",
+               (unsigned long)(fast_boot.complete_cycles / (cycles_per_us * 1000u)),
+               (unsigned long)FAST_BOOT_DEADLINE_MS);
+    }
+}
+
+#endif /* FAST_BOOT_ENABLE */
+
+/* [] END OF FILE */
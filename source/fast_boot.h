@@ -0,0 +1,96 @@
+/******************************************************************************
+* File Name:   fast_boot.h
+*
+* Description: This file is the public interface of fast_boot.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef FAST_BOOT_H_
+#define FAST_BOOT_H_
+
+#include "self_test.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Minimum CPU time given to the background tests per call of
+ * Fast_Boot_Poll(). A test step is not interrupted, so a call can take
+ * longer by the duration of one step (one flash or March block, one clock
+ * measurement). */
+#define FAST_BOOT_SLICE_US              (500u)
+
+/* All background tests must be complete this long after the first control
+ * cycle, otherwise the failure callback reports FAST_BOOT_DEADLINE_MISSED.
+ * With one call of Fast_Boot_Poll() per control period T, the background
+ * tests take about (total test time / FAST_BOOT_SLICE_US) * T. */
+#define FAST_BOOT_DEADLINE_MS           (2000u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Failures reported to the application */
+typedef enum
+{
+    FAST_BOOT_TEST_ERROR,       /* A background test failed */
+    FAST_BOOT_DEADLINE_MISSED   /* The background tests are not complete in time */
+} fast_boot_failure_t;
+
+/* Called from Fast_Boot_Poll() on a failure, with the name of the failed or
+ * pending test */
+typedef void (*fast_boot_failure_cb_t)(const char *test_name, fast_boot_failure_t failure);
+
+/* Called from Fast_Boot_Poll() before the watchdog test resets the device.
+ * Returns true when the application can be reset now */
+typedef bool (*fast_boot_reset_allowed_cb_t)(void);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t Fast_Boot_Start(fast_boot_failure_cb_t failure_cb,
+                        fast_boot_reset_allowed_cb_t reset_allowed_cb);
+uint8_t Fast_Boot_Poll(void);
+void Fast_Boot_Print_Report(void);
+void Fast_Boot_Print_Timing(void);
+
+#endif /* FAST_BOOT_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,463 @@
+/******************************************************************************
+* File Name:   flash_regions.c
+*
+* Description: This file contains the multi-region flash test. Each region of
+*              flash_regions.h is checked in slices against its reference checksum,
+*              once per deadline period, earliest deadline first.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "self_test.h"
+#include <string.h>
+
+#include "flash_regions.h"
+
+#if FLASH_REGIONS_ENABLE
+/* Reference checksums, generated by scripts/flash_regions.py. The host
+ * model uses the checksums of its own image */
+#ifndef FLASH_REGIONS_SUMS_FILE
+#define FLASH_REGIONS_SUMS_FILE         "flash_regions_sums.h"
+#endif
+#include FLASH_REGIONS_SUMS_FILE
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Modulus of the Fletcher-64 sums */
+#define FLASH_REGIONS_FLETCHER_MOD      (0xFFFFFFFFUL)
+
+/* Wrap safe comparison of two times in ms */
+#define FLASH_REGIONS_BEFORE(a, b)      ((int32_t)((uint32_t)(a) - (uint32_t)(b)) < 0)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Schedule and running checksum of a region */
+typedef struct
+{
+    uint32_t offset;            /* Next word of the current pass */
+    uint32_t release_ms;        /* Start of the current or of the next pass */
+    uint32_t deadline_ms;       /* End of the current pass at the latest */
+    uint64_t sum;               /* Running checksum, then the last checksum */
+    uint32_t passes;
+    uint32_t misses;            /* Passes completed after their deadline */
+    bool active;
+} flash_region_state_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Region descriptions */
+static const flash_region_t flash_region_list[FLASH_REGION_COUNT] =
+{
+#define FLASH_REGION_DESC(name, base, size, algorithm, words, deadline) \
+    { #name, (base), (size), (algorithm), (words), (deadline) },
+    FLASH_REGION_LIST(FLASH_REGION_DESC)
+#undef FLASH_REGION_DESC
+};
+
+/* Reference checksums, in their own section outside of every region */
+static volatile const uint64_t flash_region_sums[FLASH_REGION_COUNT]
+    __attribute__((used, section(".flash_region_sums"))) =
+{
+#define FLASH_REGION_REF(name, base, size, algorithm, words, deadline) FLASH_REGION_SUM(name),
+    FLASH_REGION_LIST(FLASH_REGION_REF)
+#undef FLASH_REGION_REF
+};
+
+/* CRC-32 (IEEE 802.3, reflected), one table lookup per byte */
+static const uint32_t flash_regions_crc_table[256] =
+{
+    0x00000000UL, 0x77073096UL, 0xEE0E612CUL, 0x990951BAUL,
+    0x076DC419UL, 0x706AF48FUL, 0xE963A535UL, 0x9E6495A3UL,
+    0x0EDB8832UL, 0x79DCB8A4UL, 0xE0D5E91EUL, 0x97D2D988UL,
+    0x09B64C2BUL, 0x7EB17CBDUL, 0xE7B82D07UL, 0x90BF1D91UL,
+    0x1DB71064UL, 0x6AB020F2UL, 0xF3B97148UL, 0x84BE41DEUL,
+    0x1ADAD47DUL, 0x6DDDE4EBUL, 0xF4D4B551UL, 0x83D385C7UL,
+    0x136C9856UL, 0x646BA8C0UL, 0xFD62F97AUL, 0x8A65C9ECUL,
+    0x14015C4FUL, 0x63066CD9UL, 0xFA0F3D63UL, 0x8D080DF5UL,
+    0x3B6E20C8UL, 0x4C69105EUL, 0xD56041E4UL, 0xA2677172UL,
+    0x3C03E4D1UL, 0x4B04D447UL, 0xD20D85FDUL, 0xA50AB56BUL,
+    0x35B5A8FAUL, 0x42B2986CUL, 0xDBBBC9D6UL, 0xACBCF940UL,
+    0x32D86CE3UL, 0x45DF5C75UL, 0xDCD60DCFUL, 0xABD13D59UL,
+    0x26D930ACUL, 0x51DE003AUL, 0xC8D75180UL, 0xBFD06116UL,
+    0x21B4F4B5UL, 0x56B3C423UL, 0xCFBA9599UL, 0xB8BDA50FUL,
+    0x2802B89EUL, 0x5F058808UL, 0xC60CD9B2UL, 0xB10BE924UL,
+    0x2F6F7C87UL, 0x58684C11UL, 0xC1611DABUL, 0xB6662D3DUL,
+    0x76DC4190UL, 0x01DB7106UL, 0x98D220BCUL, 0xEFD5102AUL,
+    0x71B18589UL, 0x06B6B51FUL, 0x9FBFE4A5UL, 0xE8B8D433UL,
+    0x7807C9A2UL, 0x0F00F934UL, 0x9609A88EUL, 0xE10E9818UL,
+    0x7F6A0DBBUL, 0x086D3D2DUL, 0x91646C97UL, 0xE6635C01UL,
+    0x6B6B51F4UL, 0x1C6C6162UL, 0x856530D8UL, 0xF262004EUL,
+    0x6C0695EDUL, 0x1B01A57BUL, 0x8208F4C1UL, 0xF50FC457UL,
+    0x65B0D9C6UL, 0x12B7E950UL, 0x8BBEB8EAUL, 0xFCB9887CUL,
+    0x62DD1DDFUL, 0x15DA2D49UL, 0x8CD37CF3UL, 0xFBD44C65UL,
+    0x4DB26158UL, 0x3AB551CEUL, 0xA3BC0074UL, 0xD4BB30E2UL,
+    0x4ADFA541UL, 0x3DD895D7UL, 0xA4D1C46DUL, 0xD3D6F4FBUL,
+    0x4369E96AUL, 0x346ED9FCUL, 0xAD678846UL, 0xDA60B8D0UL,
+    0x44042D73UL, 0x33031DE5UL, 0xAA0A4C5FUL, 0xDD0D7CC9UL,
+    0x5005713CUL, 0x270241AAUL, 0xBE0B1010UL, 0xC90C2086UL,
+    0x5768B525UL, 0x206F85B3UL, 0xB966D409UL, 0xCE61E49FUL,
+    0x5EDEF90EUL, 0x29D9C998UL, 0xB0D09822UL, 0xC7D7A8B4UL,
+    0x59B33D17UL, 0x2EB40D81UL, 0xB7BD5C3BUL, 0xC0BA6CADUL,
+    0xEDB88320UL, 0x9ABFB3B6UL, 0x03B6E20CUL, 0x74B1D29AUL,
+    0xEAD54739UL, 0x9DD277AFUL, 0x04DB2615UL, 0x73DC1683UL,
+    0xE3630B12UL, 0x94643B84UL, 0x0D6D6A3EUL, 0x7A6A5AA8UL,
+    0xE40ECF0BUL, 0x9309FF9DUL, 0x0A00AE27UL, 0x7D079EB1UL,
+    0xF00F9344UL, 0x8708A3D2UL, 0x1E01F268UL, 0x6906C2FEUL,
+    0xF762575DUL, 0x806567CBUL, 0x196C3671UL, 0x6E6B06E7UL,
+    0xFED41B76UL, 0x89D32BE0UL, 0x10DA7A5AUL, 0x67DD4ACCUL,
+    0xF9B9DF6FUL, 0x8EBEEFF9UL, 0x17B7BE43UL, 0x60B08ED5UL,
+    0xD6D6A3E8UL, 0xA1D1937EUL, 0x38D8C2C4UL, 0x4FDFF252UL,
+    0xD1BB67F1UL, 0xA6BC5767UL, 0x3FB506DDUL, 0x48B2364BUL,
+    0xD80D2BDAUL, 0xAF0A1B4CUL, 0x36034AF6UL, 0x41047A60UL,
+    0xDF60EFC3UL, 0xA867DF55UL, 0x316E8EEFUL, 0x4669BE79UL,
+    0xCB61B38CUL, 0xBC66831AUL, 0x256FD2A0UL, 0x5268E236UL,
+    0xCC0C7795UL, 0xBB0B4703UL, 0x220216B9UL, 0x5505262FUL,
+    0xC5BA3BBEUL, 0xB2BD0B28UL, 0x2BB45A92UL, 0x5CB36A04UL,
+    0xC2D7FFA7UL, 0xB5D0CF31UL, 0x2CD99E8BUL, 0x5BDEAE1DUL,
+    0x9B64C2B0UL, 0xEC63F226UL, 0x756AA39CUL, 0x026D930AUL,
+    0x9C0906A9UL, 0xEB0E363FUL, 0x72076785UL, 0x05005713UL,
+    0x95BF4A82UL, 0xE2B87A14UL, 0x7BB12BAEUL, 0x0CB61B38UL,
+    0x92D28E9BUL, 0xE5D5BE0DUL, 0x7CDCEFB7UL, 0x0BDBDF21UL,
+    0x86D3D2D4UL, 0xF1D4E242UL, 0x68DDB3F8UL, 0x1FDA836EUL,
+    0x81BE16CDUL, 0xF6B9265BUL, 0x6FB077E1UL, 0x18B74777UL,
+    0x88085AE6UL, 0xFF0F6A70UL, 0x66063BCAUL, 0x11010B5CUL,
+    0x8F659EFFUL, 0xF862AE69UL, 0x616BFFD3UL, 0x166CCF45UL,
+    0xA00AE278UL, 0xD70DD2EEUL, 0x4E048354UL, 0x3903B3C2UL,
+    0xA7672661UL, 0xD06016F7UL, 0x4969474DUL, 0x3E6E77DBUL,
+    0xAED16A4AUL, 0xD9D65ADCUL, 0x40DF0B66UL, 0x37D83BF0UL,
+    0xA9BCAE53UL, 0xDEBB9EC5UL, 0x47B2CF7FUL, 0x30B5FFE9UL,
+    0xBDBDF21CUL, 0xCABAC28AUL, 0x53B39330UL, 0x24B4A3A6UL,
+    0xBAD03605UL, 0xCDD70693UL, 0x54DE5729UL, 0x23D967BFUL,
+    0xB3667A2EUL, 0xC4614AB8UL, 0x5D681B02UL, 0x2A6F2B94UL,
+    0xB40BBE37UL, 0xC30C8EA1UL, 0x5A05DF1BUL, 0x2D02EF8DUL
+};
+
+static struct
+{
+    flash_region_state_t region[FLASH_REGION_COUNT];
+    bool started;               /* The passes are released by the first step */
+    uint32_t error_region;
+} flash_regions;
+
+/*****************************************************************************
+* Function Name: Flash_Regions_Init
+******************************************************************************
+* Summary:
+* Resets the schedule. The first step starts a pass of every region.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Flash_Regions_Init(void)
+{
+    CY_ASSERT(sizeof(flash_region_sums) <= FLASH_REGIONS_SUMS_SIZE);
+
+    memset(&flash_regions, 0, sizeof(flash_regions));
+    flash_regions.error_region = FLASH_REGION_COUNT;
+}
+
+/*****************************************************************************
+* Function Name: Flash_Regions_Slice
+******************************************************************************
+* Summary:
+* Adds words of a region to its running checksum.
+*
+* Parameters:
+*  region: Region
+*  state:  State of the region
+*  words:  Number of words
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Flash_Regions_Slice(const flash_region_t *region, flash_region_state_t *state,
+                                uint32_t words)
+{
+    const uint32_t *data = FLASH_REGIONS_ADDRESS(region->base) + state->offset;
+
+    if (FLASH_REGION_CRC32 == region->algorithm)
+    {
+        uint32_t crc = (uint32_t)state->sum;
+
+        for (uint32_t i = 0u; i < words; i++)
+        {
+            uint32_t word = data[i];
+
+            for (uint32_t byte = 0u; byte < 4u; byte++)
+            {
+                crc = flash_regions_crc_table[(crc ^ word) & 0xFFu] ^ (crc >> 8u);
+                word >>= 8u;
+            }
+        }
+        state->sum = crc;
+    }
+    else
+    {
+        /* The sums stay below the modulus, one subtraction per addition */
+        uint64_t sum1 = state->sum & FLASH_REGIONS_FLETCHER_MOD;
+        uint64_t sum2 = state->sum >> 32u;
+
+        for (uint32_t i = 0u; i < words; i++)
+        {
+            sum1 += data[i];
+            if (sum1 >= FLASH_REGIONS_FLETCHER_MOD)
+            {
+                sum1 -= FLASH_REGIONS_FLETCHER_MOD;
+            }
+            sum2 += sum1;
+            if (sum2 >= FLASH_REGIONS_FLETCHER_MOD)
+            {
+                sum2 -= FLASH_REGIONS_FLETCHER_MOD;
+            }
+        }
+        state->sum = (sum2 << 32u) | sum1;
+    }
+    state->offset += words;
+}
+
+/*****************************************************************************
+* Function Name: Flash_Regions_Step
+******************************************************************************
+* Summary:
+* Checks one slice of the region with the earliest deadline. A region
+* starts a pass once per deadline period: the next pass is released one
+* deadline after the start of the previous one. A pass completed after its
+* deadline is counted as a miss.
+*
+* Parameters:
+*  now_ms: Current time, wraps after 2^32 ms
+*
+* Return:
+*  uint8_t: ERROR_STATUS when a pass completes with a wrong checksum,
+*           PASS_STILL_TESTING_STATUS while a pass is in progress,
+*           PASS_COMPLETE_STATUS when no pass is due
+*****************************************************************************/
+uint8_t Flash_Regions_Step(uint32_t now_ms)
+{
+    uint32_t next = FLASH_REGION_COUNT;
+    uint8_t status = PASS_COMPLETE_STATUS;
+
+    for (uint32_t i = 0u; i < FLASH_REGION_COUNT; i++)
+    {
+        flash_region_state_t *state = &flash_regions.region[i];
+
+        if (!flash_regions.started)
+        {
+            state->release_ms = now_ms;
+        }
+        if (!state->active && !FLASH_REGIONS_BEFORE(now_ms, state->release_ms))
+        {
+            state->active = true;
+            state->offset = 0u;
+            state->sum = (FLASH_REGION_CRC32 == flash_region_list[i].algorithm) ? 0xFFFFFFFFUL : 0u;
+            state->deadline_ms = state->release_ms + flash_region_list[i].deadline_ms;
+        }
+        if (state->active && ((FLASH_REGION_COUNT == next) ||
+            FLASH_REGIONS_BEFORE(state->deadline_ms, flash_regions.region[next].deadline_ms)))
+        {
+            next = i;
+        }
+    }
+    flash_regions.started = true;
+
+    if (FLASH_REGION_COUNT != next)
+    {
+        const flash_region_t *region = &flash_region_list[next];
+        flash_region_state_t *state = &flash_regions.region[next];
+        uint32_t words = (region->size / 4u) - state->offset;
+
+        Flash_Regions_Slice(region, state, (words < region->words_per_slice) ?
+                                           words : region->words_per_slice);
+        if (state->offset == (region->size / 4u))
+        {
+            state->active = false;
+            if (FLASH_REGION_CRC32 == region->algorithm)
+            {
+                state->sum = (uint32_t)~state->sum;
+            }
+            state->passes++;
+            if (FLASH_REGIONS_BEFORE(state->deadline_ms, now_ms))
+            {
+                state->misses++;
+            }
+            state->release_ms += region->deadline_ms;
+            if (FLASH_REGIONS_BEFORE(state->release_ms, now_ms))
+            {
+                state->release_ms = now_ms;
+            }
+            if (state->sum != flash_region_sums[next])
+            {
+                flash_regions.error_region = next;
+                return ERROR_STATUS;
+            }
+        }
+
+        for (uint32_t i = 0u; i < FLASH_REGION_COUNT; i++)
+        {
+            if (flash_regions.region[i].active)
+            {
+                status = PASS_STILL_TESTING_STATUS;
+            }
+        }
+    }
+    return status;
+}
+
+/*****************************************************************************
+* Function Name: Flash_Regions_Get
+******************************************************************************
+* Summary:
+* Returns the description of a region.
+*
+* Parameters:
+*  index: Region index
+*
+* Return:
+*  const flash_region_t *: Region, NULL for an invalid index
+*****************************************************************************/
+const flash_region_t *Flash_Regions_Get(uint32_t index)
+{
+    return (index < FLASH_REGION_COUNT) ? &flash_region_list[index] : NULL;
+}
+
+/*****************************************************************************
+* Function Name: Flash_Regions_Get_Error_Region
+******************************************************************************
+* Summary:
+* Returns the region of the last checksum error.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Region index, FLASH_REGION_COUNT without error
+*****************************************************************************/
+uint32_t Flash_Regions_Get_Error_Region(void)
+{
+    return flash_regions.error_region;
+}
+
+/*****************************************************************************
+* Function Name: Flash_Regions_Get_Sum
+******************************************************************************
+* Summary:
+* Returns the checksum of the last completed pass of a region.
+*
+* Parameters:
+*  index: Region index
+*
+* Return:
+*  uint64_t: Checksum, the CRC-32 in the low word
+*****************************************************************************/
+uint64_t Flash_Regions_Get_Sum(uint32_t index)
+{
+    return (index < FLASH_REGION_COUNT) ? flash_regions.region[index].sum : 0u;
+}
+
+/*****************************************************************************
+* Function Name: Flash_Regions_Get_Passes
+******************************************************************************
+* Summary:
+* Returns the number of completed passes of a region.
+*
+* Parameters:
+*  index: Region index
+*
+* Return:
+*  uint32_t: Passes
+*****************************************************************************/
+uint32_t Flash_Regions_Get_Passes(uint32_t index)
+{
+    return (index < FLASH_REGION_COUNT) ? flash_regions.region[index].passes : 0u;
+}
+
+/*****************************************************************************
+* Function Name: Flash_Regions_Get_Misses
+******************************************************************************
+* Summary:
+* Returns the number of passes of a region completed after their deadline.
+*
+* Parameters:
+*  index: Region index
+*
+* Return:
+*  uint32_t: Missed deadlines
+*****************************************************************************/
+uint32_t Flash_Regions_Get_Misses(uint32_t index)
+{
+    return (index < FLASH_REGION_COUNT) ? flash_regions.region[index].misses : 0u;
+}
+
+/*****************************************************************************
+* Function Name: Flash_Regions_Load_Permille
+******************************************************************************
+* Summary:
+* Returns the share of the steps needed by the regions when a step runs
+* every step_period_ms: the sum over the regions of their slices per pass
+* divided by the steps in their deadline. The deadlines can be met with the
+* earliest deadline first order when the load is at most 1000 permille.
+*
+* Parameters:
+*  step_period_ms: Time between two steps
+*
+* Return:
+*  uint32_t: Load in permille
+*****************************************************************************/
+uint32_t Flash_Regions_Load_Permille(uint32_t step_period_ms)
+{
+    uint64_t load = 0u;
+
+    for (uint32_t i = 0u; i < FLASH_REGION_COUNT; i++)
+    {
+        const flash_region_t *region = &flash_region_list[i];
+        uint64_t slices = ((region->size / 4u) + region->words_per_slice - 1u) /
+                          region->words_per_slice;
+
+        load += (slices * step_period_ms * 1000u) / region->deadline_ms;
+    }
+    return (uint32_t)load;
+}
+#endif /* FLASH_REGIONS_ENABLE */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,171 @@
+/******************************************************************************
+* File Name:   flash_regions.h
+*
+* Description: Header of the multi-region flash test. One list of flash regions, each
+*              with its reference checksum, algorithm, slice budget and deadline, drives
+*              the run time checks and the checksum generator (scripts/flash_regions.py).
+*              Platform independent: also built by the host model
+*              (host/model/flash_regions_model.c).
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef FLASH_REGIONS_H_
+#define FLASH_REGIONS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Checksum algorithms of a region */
+#define FLASH_REGION_CRC32              (1u)    /* CRC-32 (IEEE 802.3), as zlib */
+#define FLASH_REGION_FLETCHER64         (2u)    /* Fletcher-64 on 32-bit words */
+
+/* Size of the .flash_region_sums section of the linker scripts, below the
+ * .flash_checksum section at the end of the application flash. It holds
+ * the reference checksums and is not part of any region */
+#define FLASH_REGIONS_SUMS_SIZE         (0x40u)
+
+/* End of the application code region: the reference checksums and the
+ * checksum of the single region test are excluded */
+#ifndef FLASH_REGIONS_CODE_END
+#define FLASH_REGIONS_CODE_END          (FLASH_END_ADDR - FLASH_REGIONS_SUMS_SIZE)
+#endif
+
+/* 1: the linker script of the kit has the .flash_region_sums section. Set
+ * by the Makefile for the kits whose template in templates/ has it; the
+ * other kits use the linker script of their BSP */
+#ifndef FLASH_REGIONS_SUMS_SECTION
+#define FLASH_REGIONS_SUMS_SECTION      (0u)
+#endif
+
+/* Regions of PSoC 6 (CM4 application). Base addresses and sizes are those
+ * of the linker scripts; sizes are multiples of 4 bytes.
+ * X(name, base, size, algorithm, words per slice, deadline in ms) */
+#define FLASH_REGION_LIST_CAT1A(X) \
+    X(CM0P_IMAGE,   0x10000000UL, 0x00002000UL, FLASH_REGION_CRC32,       256u,  10000u) \
+    X(CM4_CODE,     0x10002000UL, (FLASH_REGIONS_CODE_END - 0x10002000UL), \
+                                                FLASH_REGION_FLETCHER64, 1024u,  60000u) \
+    X(SFLASH_USER,  0x16000800UL, 0x00000800UL, FLASH_REGION_CRC32,       256u,  10000u) \
+    X(SFLASH_TOC2,  0x16007C00UL, 0x00000200UL, FLASH_REGION_CRC32,       128u,   1000u)
+
+/* Regions of XMC7200 (CM7_0 application). The work flash is checked only
+ * when it holds constant data, remove it when it emulates an EEPROM */
+#define FLASH_REGION_LIST_CAT1C(X) \
+    X(CM0P_IMAGE,   0x10000000UL, 0x00080000UL, FLASH_REGION_CRC32,      1024u,  10000u) \
+    X(CM7_CODE,     0x10080000UL, (FLASH_REGIONS_CODE_END - 0x10080000UL), \
+                                                FLASH_REGION_FLETCHER64, 4096u,  60000u) \
+    X(WORK_FLASH,   0x14000000UL, 0x00040000UL, FLASH_REGION_CRC32,      1024u,  60000u) \
+    X(SFLASH_USER,  0x17000800UL, 0x00000800UL, FLASH_REGION_CRC32,       256u,  10000u) \
+    X(SFLASH_TOC2,  0x17007C00UL, 0x00000200UL, FLASH_REGION_CRC32,       128u,   1000u)
+
+#if defined(FLASH_REGIONS_HOST)
+/* Host model of the test (host/model/flash_regions_model.c) */
+#include "flash_regions_host.h"
+#else
+/* Region list of the device */
+#if defined(COMPONENT_CAT1C)
+#define FLASH_REGIONS_DEVICE            CAT1C
+#else
+#define FLASH_REGIONS_DEVICE            CAT1A
+#endif
+
+/* Maps a flash address to a pointer */
+#define FLASH_REGIONS_ADDRESS(addr)     ((const uint32_t *)(uintptr_t)(addr))
+
+#if FLASH_REGIONS_ENABLE
+#if defined(CY_DEVICE_SECURE)
+#error "FLASH_REGIONS_ENABLE: the flash of the secure devices is laid out by their secure boot policy, the region list does not apply"
+#elif !FLASH_REGIONS_SUMS_SECTION
+#error "FLASH_REGIONS_ENABLE: the linker script of this kit has no .flash_region_sums section, add it as in templates/"
+#endif
+#endif
+#endif
+
+#define FLASH_REGIONS_CAT(a, b)         a##b
+#define FLASH_REGIONS_XCAT(a, b)        FLASH_REGIONS_CAT(a, b)
+#define FLASH_REGION_LIST               FLASH_REGIONS_XCAT(FLASH_REGION_LIST_, FLASH_REGIONS_DEVICE)
+
+/* Reference checksum of a region, from flash_regions_sums.h */
+#define FLASH_REGION_SUM(name) \
+    FLASH_REGIONS_XCAT(FLASH_REGIONS_XCAT(FLASH_REGION_SUM_, FLASH_REGIONS_DEVICE), \
+                       FLASH_REGIONS_CAT(_, name))
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Region indexes */
+typedef enum
+{
+#define FLASH_REGION_ENUM(name, base, size, algorithm, words, deadline) FLASH_REGION_##name,
+    FLASH_REGION_LIST(FLASH_REGION_ENUM)
+#undef FLASH_REGION_ENUM
+    FLASH_REGION_COUNT
+} flash_region_index_t;
+
+/* Region description */
+typedef struct
+{
+    const char *name;
+    uint32_t base;
+    uint32_t size;              /* Bytes, a multiple of 4 */
+    uint8_t algorithm;          /* FLASH_REGION_xx */
+    uint32_t words_per_slice;   /* Words checked per step */
+    uint32_t deadline_ms;       /* A pass completes within this time of its start */
+} flash_region_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void Flash_Regions_Init(void);
+uint8_t Flash_Regions_Step(uint32_t now_ms);
+const flash_region_t *Flash_Regions_Get(uint32_t index);
+uint32_t Flash_Regions_Get_Error_Region(void);
+uint64_t Flash_Regions_Get_Sum(uint32_t index);
+uint32_t Flash_Regions_Get_Passes(uint32_t index);
+uint32_t Flash_Regions_Get_Misses(uint32_t index);
+uint32_t Flash_Regions_Load_Permille(uint32_t step_period_ms);
+
+#endif /* FLASH_REGIONS_H_ */
+
+
+/* [] END OF FILE */
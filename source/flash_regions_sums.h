@@ -0,0 +1,20 @@
+/* Generated by scripts/flash_regions.py - do not edit. */
+/* FLASH_REGION_SUM_<device>_<region>: reference checksum of a region of
+ * flash_regions.h, the CRC-32 in the low word */
+#ifndef FLASH_REGIONS_SUMS_H_
+#define FLASH_REGIONS_SUMS_H_
+
+/* CAT1A: no image */
+#define FLASH_REGION_SUM_CAT1A_CM0P_IMAGE    (0x0000000000000000ULL)
+#define FLASH_REGION_SUM_CAT1A_CM4_CODE      (0x0000000000000000ULL)
+#define FLASH_REGION_SUM_CAT1A_SFLASH_USER   (0x0000000000000000ULL)
+#define FLASH_REGION_SUM_CAT1A_SFLASH_TOC2   (0x0000000000000000ULL)
+
+/* CAT1C: no image */
+#define FLASH_REGION_SUM_CAT1C_CM0P_IMAGE    (0x0000000000000000ULL)
+#define FLASH_REGION_SUM_CAT1C_CM7_CODE      (0x0000000000000000ULL)
+#define FLASH_REGION_SUM_CAT1C_WORK_FLASH    (0x0000000000000000ULL)
+#define FLASH_REGION_SUM_CAT1C_SFLASH_USER   (0x0000000000000000ULL)
+#define FLASH_REGION_SUM_CAT1C_SFLASH_TOC2   (0x0000000000000000ULL)
+
+#endif /* FLASH_REGIONS_SUMS_H_ */
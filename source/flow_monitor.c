@@ -0,0 +1,174 @@
+/******************************************************************************
+* File Name:   flow_monitor.c
+*
+* Description: This file contains the signature based program flow monitor: every
+*              checkpoint updates a running signature with a constant generated from
+*              the expected flow graph, and the signature is verified at verification
+*              checkpoints or periodically.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "flow_monitor.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+volatile uint32_t flow_monitor_signature;
+
+#if FLOW_MONITOR_ENABLE
+/* Running signatures of all checkpoints, sorted */
+static const uint32_t flow_monitor_signatures[FLOW_MONITOR_SIGNATURE_COUNT] =
+    FLOW_MONITOR_SIGNATURES;
+#endif
+
+/* Running signature at the first failed check */
+static uint32_t flow_monitor_error_signature;
+static bool flow_monitor_failed;
+
+/*****************************************************************************
+* Function Name: Flow_Monitor_Latch_Error
+******************************************************************************
+* Summary:
+* Records the running signature of the first failed check.
+*
+* Parameters:
+*  signature: Running signature
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Flow_Monitor_Latch_Error(uint32_t signature)
+{
+    if (!flow_monitor_failed)
+    {
+        flow_monitor_error_signature = signature;
+        flow_monitor_failed = true;
+    }
+}
+
+/*****************************************************************************
+* Function Name: Flow_Monitor_Check
+******************************************************************************
+* Summary:
+* Compares the running signature with the signature of the checkpoint just
+* passed. A mismatch means that a checkpoint was reached from a checkpoint
+* that is not its predecessor, here or earlier.
+*
+* Parameters:
+*  expected: FLOW_S_xx of the checkpoint
+*
+* Return:
+*  uint8_t: OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t Flow_Monitor_Check(uint32_t expected)
+{
+    uint32_t signature = flow_monitor_signature;
+
+    if (signature != expected)
+    {
+        Flow_Monitor_Latch_Error(signature);
+        return ERROR_STATUS;
+    }
+
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Flow_Monitor_Verify
+******************************************************************************
+* Summary:
+* Periodic check, independent of the current checkpoint: the running
+* signature must be the signature of one of the checkpoints. An illegal
+* transition leaves a constant error in the signature, so the check also
+* detects it after later checkpoints. Can be called from a timer interrupt.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t Flow_Monitor_Verify(void)
+{
+#if FLOW_MONITOR_ENABLE
+    uint32_t signature = flow_monitor_signature;
+    uint32_t low = 0u;
+    uint32_t high = FLOW_MONITOR_SIGNATURE_COUNT;
+    uint32_t mid;
+
+    while (low < high)
+    {
+        mid = (low + high) / 2u;
+        if (flow_monitor_signatures[mid] < signature)
+        {
+            low = mid + 1u;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    if ((low < FLOW_MONITOR_SIGNATURE_COUNT) && (flow_monitor_signatures[low] == signature))
+    {
+        return OK_STATUS;
+    }
+    Flow_Monitor_Latch_Error(signature);
+    return ERROR_STATUS;
+#else
+    return OK_STATUS;
+#endif
+}
+
+/*****************************************************************************
+* Function Name: Flow_Monitor_Get_Error_Signature
+******************************************************************************
+* Summary:
+* Returns the running signature at the first failed check.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Signature, 0 if no check failed
+*****************************************************************************/
+uint32_t Flow_Monitor_Get_Error_Signature(void)
+{
+    return flow_monitor_error_signature;
+}
+
+/* [] END OF FILE */
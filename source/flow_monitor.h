@@ -0,0 +1,96 @@
+/******************************************************************************
+* File Name:   flow_monitor.h
+*
+* Description: This file is the public interface of flow_monitor.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef FLOW_MONITOR_H_
+#define FLOW_MONITOR_H_
+
+#include "self_test.h"
+#include "flow_monitor_sigs.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Checkpoint macros. The checkpoint names and predecessor lists are read by
+ * scripts/flow_graph.py, which generates the signatures of flow_monitor_sigs.h.
+ * Run it after adding, removing or changing a checkpoint.
+ *
+ * FLOW_MONITOR_INIT(node)         Entry checkpoint, sets the running signature.
+ * FLOW_CHECKPOINT(node, pred...)  Checkpoint reached from one of the listed
+ *                                 checkpoints: one XOR with a constant.
+ * FLOW_VERIFY(node, pred...)      Checkpoint followed by a check of the running
+ *                                 signature, evaluates to OK_STATUS or
+ *                                 ERROR_STATUS.
+ *
+ * The running signature belongs to one execution context: do not place
+ * checkpoints in interrupt handlers.
+ */
+#if FLOW_MONITOR_ENABLE
+#define FLOW_MONITOR_INIT(node)         (flow_monitor_signature = FLOW_S_##node)
+#define FLOW_CHECKPOINT(node, ...)      (flow_monitor_signature ^= FLOW_D_##node)
+#define FLOW_VERIFY(node, ...) \
+    (FLOW_CHECKPOINT(node, __VA_ARGS__), Flow_Monitor_Check(FLOW_S_##node))
+#else
+#define FLOW_MONITOR_INIT(node)         ((void)0)
+#define FLOW_CHECKPOINT(node, ...)      ((void)0)
+#define FLOW_VERIFY(node, ...)          (OK_STATUS)
+#endif
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Running signature, updated by every checkpoint */
+extern volatile uint32_t flow_monitor_signature;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t Flow_Monitor_Check(uint32_t expected);
+uint8_t Flow_Monitor_Verify(void);
+uint32_t Flow_Monitor_Get_Error_Signature(void);
+
+#endif /* FLOW_MONITOR_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,28 @@
+/* Generated by scripts/flow_graph.py - do not edit. */
+/* FLOW_S_x: running signature after checkpoint x
+ * FLOW_D_x: update constant of checkpoint x, FLOW_S_x ^ FLOW_S_<predecessor> */
+#ifndef FLOW_MONITOR_SIGS_H_
+#define FLOW_MONITOR_SIGS_H_
+
+/* fast_boot.c, entry */
+#define FLOW_S_FAST_BOOT_START        (0xCBA41FC6UL)
+#define FLOW_D_FAST_BOOT_START        (0x00000000UL)
+/* main.c, from MAIN_START */
+#define FLOW_S_MAIN_CPU_TESTS         (0xA394453CUL)
+#define FLOW_D_MAIN_CPU_TESTS         (0xC5E4645CUL)
+/* main.c, from MAIN_PERIPHERAL_TESTS */
+#define FLOW_S_MAIN_END               (0x2E4533E2UL)
+#define FLOW_D_MAIN_END               (0xEA3AF9B3UL)
+/* main.c, from MAIN_CPU_TESTS */
+#define FLOW_S_MAIN_PERIPHERAL_TESTS  (0xC47FCA51UL)
+#define FLOW_D_MAIN_PERIPHERAL_TESTS  (0x67EB8F6DUL)
+/* main.c, entry */
+#define FLOW_S_MAIN_START             (0x66702160UL)
+#define FLOW_D_MAIN_START             (0x00000000UL)
+
+/* Running signatures of all checkpoints, sorted */
+#define FLOW_MONITOR_SIGNATURE_COUNT (5u)
+#define FLOW_MONITOR_SIGNATURES \
+    {0x2E4533E2UL, 0x66702160UL, 0xA394453CUL, 0xC47FCA51UL, 0xCBA41FC6UL}
+
+#endif /* FLOW_MONITOR_SIGS_H_ */
@@ -0,0 +1,321 @@
+/******************************************************************************
+* File Name:   fpu_datapath_test.c
+*
+* Description: This file contains the FPU datapath test: known-answer vectors for
+*              add, multiply, fused multiply-add, divide, square root and conversions in
+*              all rounding modes, with and without flush-to-zero.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include <string.h>
+
+#include "fpu_datapath_test.h"
+
+#if FPU_DATAPATH_TEST_ENABLE
+
+#if !defined(__GNUC__)
+#error "The FPU datapath test needs GCC compatible inline assembly (GCC or Arm Compiler 6)"
+#endif
+
+#include "fpu_test_vectors.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Number of the first failing vector, double precision vectors follow the
+ * single precision ones */
+static uint32_t fpu_failed_vector = FPU_DATAPATH_NO_VECTOR;
+
+/* Cycles taken by the last run */
+static uint32_t fpu_cycles;
+
+/*****************************************************************************
+* Function Name: Fpu_Set_Mode
+******************************************************************************
+* Summary:
+* Sets the rounding mode and the flush-to-zero mode of a vector, keeping the
+* other FPSCR fields of the caller.
+*
+* Parameters:
+*  fpscr: FPSCR value to restore after the test
+*  rmode: FPU_KAT_RN ... FPU_KAT_RZ
+*  fz:    Flush-to-zero mode
+*
+* Return:
+*  void
+*****************************************************************************/
+static inline void Fpu_Set_Mode(uint32_t fpscr, uint8_t rmode, bool fz)
+{
+    fpscr &= ~(FPU_FPSCR_RMODE_Msk | FPU_FPSCR_FZ_Msk);
+    fpscr |= ((uint32_t)rmode << FPU_FPSCR_RMODE_Pos) & FPU_FPSCR_RMODE_Msk;
+    if (fz)
+    {
+        fpscr |= FPU_FPSCR_FZ_Msk;
+    }
+    __set_FPSCR(fpscr);
+}
+
+/*****************************************************************************
+* Function Name: Fpu_Execute_Sp
+******************************************************************************
+* Summary:
+* Executes one single precision vector. The operations are written as single
+* instructions so that the compiler can neither fold nor replace them.
+*
+* Parameters:
+*  vector: Vector to execute
+*
+* Return:
+*  uint32_t: Result bit pattern
+*****************************************************************************/
+static uint32_t Fpu_Execute_Sp(const fpu_kat_sp_t *vector)
+{
+    float a;
+    float b;
+    float r;
+    uint32_t result;
+
+    memcpy(&a, &vector->a, sizeof(a));
+    memcpy(&b, &vector->b, sizeof(b));
+
+    switch (vector->op)
+    {
+        case FPU_KAT_OP_ADD:
+            __asm volatile ("vadd.f32 %0, %1, %2" : "=t" (r) : "t" (a), "t" (b));
+            break;
+        case FPU_KAT_OP_SUB:
+            __asm volatile ("vsub.f32 %0, %1, %2" : "=t" (r) : "t" (a), "t" (b));
+            break;
+        case FPU_KAT_OP_MUL:
+            __asm volatile ("vmul.f32 %0, %1, %2" : "=t" (r) : "t" (a), "t" (b));
+            break;
+        case FPU_KAT_OP_FMA:
+            memcpy(&r, &vector->c, sizeof(r));
+            __asm volatile ("vfma.f32 %0, %1, %2" : "+t" (r) : "t" (a), "t" (b));
+            break;
+        case FPU_KAT_OP_DIV:
+            __asm volatile ("vdiv.f32 %0, %1, %2" : "=t" (r) : "t" (a), "t" (b));
+            break;
+        case FPU_KAT_OP_SQRT:
+            __asm volatile ("vsqrt.f32 %0, %1" : "=t" (r) : "t" (a));
+            break;
+        case FPU_KAT_OP_F2S:
+            __asm volatile ("vcvtr.s32.f32 %0, %1" : "=t" (r) : "t" (a));
+            break;
+        case FPU_KAT_OP_S2F:
+            __asm volatile ("vcvt.f32.s32 %0, %1" : "=t" (r) : "t" (a));
+            break;
+        default:
+            r = a;
+            break;
+    }
+
+    memcpy(&result, &r, sizeof(result));
+    return result;
+}
+
+#if FPU_DATAPATH_DP_SUPPORTED
+/*****************************************************************************
+* Function Name: Fpu_Execute_Dp
+******************************************************************************
+* Summary:
+* Executes one double precision vector.
+*
+* Parameters:
+*  vector: Vector to execute
+*
+* Return:
+*  uint64_t: Result bit pattern, the int32 result of FPU_KAT_OP_F2S in the
+*            low word
+*****************************************************************************/
+static uint64_t Fpu_Execute_Dp(const fpu_kat_dp_t *vector)
+{
+    double a;
+    double b;
+    double r;
+    float s;
+    uint32_t word;
+    uint64_t result;
+
+    memcpy(&a, &vector->a, sizeof(a));
+    memcpy(&b, &vector->b, sizeof(b));
+
+    switch (vector->op)
+    {
+        case FPU_KAT_OP_ADD:
+            __asm volatile ("vadd.f64 %P0, %P1, %P2" : "=w" (r) : "w" (a), "w" (b));
+            break;
+        case FPU_KAT_OP_SUB:
+            __asm volatile ("vsub.f64 %P0, %P1, %P2" : "=w" (r) : "w" (a), "w" (b));
+            break;
+        case FPU_KAT_OP_MUL:
+            __asm volatile ("vmul.f64 %P0, %P1, %P2" : "=w" (r) : "w" (a), "w" (b));
+            break;
+        case FPU_KAT_OP_FMA:
+            memcpy(&r, &vector->c, sizeof(r));
+            __asm volatile ("vfma.f64 %P0, %P1, %P2" : "+w" (r) : "w" (a), "w" (b));
+            break;
+        case FPU_KAT_OP_DIV:
+            __asm volatile ("vdiv.f64 %P0, %P1, %P2" : "=w" (r) : "w" (a), "w" (b));
+            break;
+        case FPU_KAT_OP_SQRT:
+            __asm volatile ("vsqrt.f64 %P0, %P1" : "=w" (r) : "w" (a));
+            break;
+        case FPU_KAT_OP_F2S:
+            __asm volatile ("vcvtr.s32.f64 %0, %P1" : "=t" (s) : "w" (a));
+            memcpy(&word, &s, sizeof(word));
+            return (uint64_t)word;
+        case FPU_KAT_OP_S2F:
+            word = (uint32_t)vector->a;
+            memcpy(&s, &word, sizeof(s));
+            __asm volatile ("vcvt.f64.s32 %P0, %1" : "=w" (r) : "t" (s));
+            break;
+        default:
+            r = a;
+            break;
+    }
+
+    memcpy(&result, &r, sizeof(result));
+    return result;
+}
+#endif /* FPU_DATAPATH_DP_SUPPORTED */
+
+/*****************************************************************************
+* Function Name: FPU_Datapath_Test
+******************************************************************************
+* Summary:
+* Runs the single precision known-answer vectors and, on a double precision
+* FPU, the double precision vectors. Each vector sets its own rounding and
+* flush-to-zero mode; the FPSCR of the caller is restored afterwards. The
+* run is timed with the cycle counter and fails if it exceeds
+* FPU_DATAPATH_CYCLE_BUDGET. The vectors are generated and checked on the
+* host by scripts/gen_fpu_vectors.py.
+*
+* Parameters:
+*  fpu_type: SCB_GetFPUType() of the core
+*
+* Return:
+*  uint8_t: OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t FPU_Datapath_Test(uint32_t fpu_type)
+{
+    uint8_t status = OK_STATUS;
+    uint32_t fpscr = __get_FPSCR();
+    uint32_t start = CYCLE_COUNTER_GET();
+    uint32_t index;
+
+    fpu_failed_vector = FPU_DATAPATH_NO_VECTOR;
+
+    for (index = 0u; index < (sizeof(fpu_kat_sp) / sizeof(fpu_kat_sp[0])); index++)
+    {
+        Fpu_Set_Mode(fpscr, fpu_kat_sp[index].rmode, fpu_kat_sp[index].fz);
+        if (Fpu_Execute_Sp(&fpu_kat_sp[index]) != fpu_kat_sp[index].expected)
+        {
+            fpu_failed_vector = index;
+            status = ERROR_STATUS;
+            break;
+        }
+    }
+
+#if FPU_DATAPATH_DP_SUPPORTED
+    if ((OK_STATUS == status) && (FPU_TYPE_DOUBLE_PRECISION == fpu_type))
+    {
+        for (index = 0u; index < (sizeof(fpu_kat_dp) / sizeof(fpu_kat_dp[0])); index++)
+        {
+            Fpu_Set_Mode(fpscr, fpu_kat_dp[index].rmode, fpu_kat_dp[index].fz);
+            if (Fpu_Execute_Dp(&fpu_kat_dp[index]) != fpu_kat_dp[index].expected)
+            {
+                fpu_failed_vector = index + (sizeof(fpu_kat_sp) / sizeof(fpu_kat_sp[0]));
+                status = ERROR_STATUS;
+                break;
+            }
+        }
+    }
+#else
+    (void)fpu_type;
+#endif
+
+    __set_FPSCR(fpscr);
+    fpu_cycles = CYCLE_COUNTER_GET() - start;
+
+    if ((0u != FPU_DATAPATH_CYCLE_BUDGET) && (fpu_cycles > FPU_DATAPATH_CYCLE_BUDGET))
+    {
+        status = ERROR_STATUS;
+    }
+    return status;
+}
+
+/*****************************************************************************
+* Function Name: FPU_Datapath_Get_Failed_Vector
+******************************************************************************
+* Summary:
+* Returns the number of the vector that failed in the last run.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Vector number, FPU_DATAPATH_NO_VECTOR if all vectors passed
+*****************************************************************************/
+uint32_t FPU_Datapath_Get_Failed_Vector(void)
+{
+    return fpu_failed_vector;
+}
+
+/*****************************************************************************
+* Function Name: FPU_Datapath_Get_Cycles
+******************************************************************************
+* Summary:
+* Returns the CPU cycles taken by the last run.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Cycles
+*****************************************************************************/
+uint32_t FPU_Datapath_Get_Cycles(void)
+{
+    return fpu_cycles;
+}
+
+#endif /* FPU_DATAPATH_TEST_ENABLE */
+
+/* [] END OF FILE */
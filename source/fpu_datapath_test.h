@@ -0,0 +1,133 @@
+/******************************************************************************
+* File Name:   fpu_datapath_test.h
+*
+* Description: This file is the public interface of fpu_datapath_test.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef FPU_DATAPATH_TEST_H_
+#define FPU_DATAPATH_TEST_H_
+
+#include "self_test.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Maximum number of CPU cycles for one run of all vectors. A run that takes
+ * longer is reported as an error. 0 disables the check. */
+#define FPU_DATAPATH_CYCLE_BUDGET       (30000u)
+
+/* FPU_Datapath_Get_Failed_Vector() value when no vector failed */
+#define FPU_DATAPATH_NO_VECTOR          (0xFFFFFFFFUL)
+
+/* Rounding modes of the vectors, encoded as FPSCR.RMode */
+#define FPU_KAT_RN                      (0u)    /* Round to nearest even */
+#define FPU_KAT_RP                      (1u)    /* Round towards +infinity */
+#define FPU_KAT_RM                      (2u)    /* Round towards -infinity */
+#define FPU_KAT_RZ                      (3u)    /* Round towards zero */
+
+/* FPSCR fields set per vector */
+#define FPU_FPSCR_RMODE_Pos             (22u)
+#define FPU_FPSCR_RMODE_Msk             (3UL << FPU_FPSCR_RMODE_Pos)
+#define FPU_FPSCR_FZ_Msk                (1UL << 24u)
+
+/* SCB_GetFPUType() value of a double precision FPU (CM7) */
+#define FPU_TYPE_DOUBLE_PRECISION       (2u)
+
+/* Double precision vectors are built when the code is compiled for a double
+ * precision FPU */
+#if defined(__ARM_FP) && ((__ARM_FP & 0x8) != 0)
+#define FPU_DATAPATH_DP_SUPPORTED       (1u)
+#else
+#define FPU_DATAPATH_DP_SUPPORTED       (0u)
+#endif
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Operations of the known-answer vectors, see scripts/gen_fpu_vectors.py */
+typedef enum
+{
+    FPU_KAT_OP_ADD,     /* a + b */
+    FPU_KAT_OP_SUB,     /* a - b */
+    FPU_KAT_OP_MUL,     /* a * b */
+    FPU_KAT_OP_FMA,     /* a * b + c, fused */
+    FPU_KAT_OP_DIV,     /* a / b */
+    FPU_KAT_OP_SQRT,    /* sqrt(a) */
+    FPU_KAT_OP_F2S,     /* a to int32, rounded with the FPSCR rounding mode */
+    FPU_KAT_OP_S2F      /* int32 a to floating point */
+} fpu_kat_op_t;
+
+/* Single precision vector, operands and result as IEEE 754 bit patterns */
+typedef struct
+{
+    uint8_t op;         /* fpu_kat_op_t */
+    uint8_t rmode;      /* FPU_KAT_RN ... FPU_KAT_RZ */
+    bool fz;            /* Flush-to-zero mode */
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+    uint32_t expected;
+} fpu_kat_sp_t;
+
+/* Double precision vector */
+typedef struct
+{
+    uint8_t op;
+    uint8_t rmode;
+    bool fz;
+    uint64_t a;
+    uint64_t b;
+    uint64_t c;
+    uint64_t expected;
+} fpu_kat_dp_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t FPU_Datapath_Test(uint32_t fpu_type);
+uint32_t FPU_Datapath_Get_Failed_Vector(void);
+uint32_t FPU_Datapath_Get_Cycles(void);
+
+#endif /* FPU_DATAPATH_TEST_H_ */
+
+
+/* [] END OF FILE */
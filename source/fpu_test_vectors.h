@@ -0,0 +1,168 @@
+/* Generated by scripts/gen_fpu_vectors.py - do not edit. */
+/* Fields: operation, rounding mode, flush-to-zero, a, b, c, expected result */
+#ifndef FPU_TEST_VECTORS_H_
+#define FPU_TEST_VECTORS_H_
+
+static const fpu_kat_sp_t fpu_kat_sp[] =
+{
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x3F800000U, 0x33800000U, 0x00000000U, 0x3F800000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RP, false, 0x3F800000U, 0x33800000U, 0x00000000U, 0x3F800001U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x3F800000U, 0x33800000U, 0x00000000U, 0x3F800000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RZ, false, 0x3F800000U, 0x33800000U, 0x00000000U, 0x3F800000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x3F800000U, 0x33C00000U, 0x00000000U, 0x3F800001U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RP, false, 0x3F800000U, 0x33C00000U, 0x00000000U, 0x3F800001U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x3F800000U, 0x33C00000U, 0x00000000U, 0x3F800000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RZ, false, 0x3F800000U, 0x33C00000U, 0x00000000U, 0x3F800000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x3F8CCCCDU, 0x400CCCCDU, 0x00000000U, 0x40533334U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RP, false, 0x3F8CCCCDU, 0x400CCCCDU, 0x00000000U, 0x40533334U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x3F8CCCCDU, 0x400CCCCDU, 0x00000000U, 0x40533333U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RZ, false, 0x3F8CCCCDU, 0x400CCCCDU, 0x00000000U, 0x40533333U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x3FC00000U, 0xBFC00000U, 0x00000000U, 0x00000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x3FC00000U, 0xBFC00000U, 0x00000000U, 0x80000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x7F7FFFFFU, 0x7F7FFFFFU, 0x00000000U, 0x7F800000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RP, false, 0x7F7FFFFFU, 0x7F7FFFFFU, 0x00000000U, 0x7F800000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x7F7FFFFFU, 0x7F7FFFFFU, 0x00000000U, 0x7F7FFFFFU},
+    {FPU_KAT_OP_ADD , FPU_KAT_RZ, false, 0x7F7FFFFFU, 0x7F7FFFFFU, 0x00000000U, 0x7F7FFFFFU},
+    {FPU_KAT_OP_SUB , FPU_KAT_RN, false, 0x3F800000U, 0x32800000U, 0x00000000U, 0x3F800000U},
+    {FPU_KAT_OP_SUB , FPU_KAT_RP, false, 0x3F800000U, 0x32800000U, 0x00000000U, 0x3F800000U},
+    {FPU_KAT_OP_SUB , FPU_KAT_RM, false, 0x3F800000U, 0x32800000U, 0x00000000U, 0x3F7FFFFFU},
+    {FPU_KAT_OP_SUB , FPU_KAT_RZ, false, 0x3F800000U, 0x32800000U, 0x00000000U, 0x3F7FFFFFU},
+    {FPU_KAT_OP_SUB , FPU_KAT_RN, false, 0x3E99999AU, 0x3DCCCCCDU, 0x00000000U, 0x3E4CCCCEU},
+    {FPU_KAT_OP_MUL , FPU_KAT_RN, false, 0x3F8CCCCDU, 0x3F8CCCCDU, 0x00000000U, 0x3F9AE148U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RP, false, 0x3F8CCCCDU, 0x3F8CCCCDU, 0x00000000U, 0x3F9AE149U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RM, false, 0x3F8CCCCDU, 0x3F8CCCCDU, 0x00000000U, 0x3F9AE148U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RZ, false, 0x3F8CCCCDU, 0x3F8CCCCDU, 0x00000000U, 0x3F9AE148U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RN, false, 0x40400000U, 0x3EAAAAABU, 0x00000000U, 0x3F800000U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RZ, false, 0x40400000U, 0x3EAAAAABU, 0x00000000U, 0x3F800000U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RP, false, 0xBFD9999AU, 0x40133333U, 0x00000000U, 0xC07A3D70U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RM, false, 0xBFD9999AU, 0x40133333U, 0x00000000U, 0xC07A3D71U},
+    {FPU_KAT_OP_FMA , FPU_KAT_RN, false, 0x3F800001U, 0x3F7FFFFFU, 0xBF800000U, 0x337FFFFEU},
+    {FPU_KAT_OP_FMA , FPU_KAT_RM, false, 0x3F800001U, 0x3F7FFFFFU, 0xBF800000U, 0x337FFFFEU},
+    {FPU_KAT_OP_FMA , FPU_KAT_RN, false, 0x3F8CCCCDU, 0x3F8CCCCDU, 0xBF9AE148U, 0x3275C290U},
+    {FPU_KAT_OP_FMA , FPU_KAT_RZ, false, 0x3F8CCCCDU, 0x3F8CCCCDU, 0xBF9AE148U, 0x3275C290U},
+    {FPU_KAT_OP_FMA , FPU_KAT_RN, false, 0x40000000U, 0x40400000U, 0x3F000000U, 0x40D00000U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RN, false, 0x3F800000U, 0x40400000U, 0x00000000U, 0x3EAAAAABU},
+    {FPU_KAT_OP_DIV , FPU_KAT_RP, false, 0x3F800000U, 0x40400000U, 0x00000000U, 0x3EAAAAABU},
+    {FPU_KAT_OP_DIV , FPU_KAT_RM, false, 0x3F800000U, 0x40400000U, 0x00000000U, 0x3EAAAAAAU},
+    {FPU_KAT_OP_DIV , FPU_KAT_RZ, false, 0x3F800000U, 0x40400000U, 0x00000000U, 0x3EAAAAAAU},
+    {FPU_KAT_OP_DIV , FPU_KAT_RN, false, 0xC0000000U, 0x40400000U, 0x00000000U, 0xBF2AAAABU},
+    {FPU_KAT_OP_DIV , FPU_KAT_RP, false, 0xC0000000U, 0x40400000U, 0x00000000U, 0xBF2AAAAAU},
+    {FPU_KAT_OP_DIV , FPU_KAT_RM, false, 0xC0000000U, 0x40400000U, 0x00000000U, 0xBF2AAAABU},
+    {FPU_KAT_OP_DIV , FPU_KAT_RZ, false, 0xC0000000U, 0x40400000U, 0x00000000U, 0xBF2AAAAAU},
+    {FPU_KAT_OP_DIV , FPU_KAT_RN, false, 0x3F800000U, 0x40E00000U, 0x00000000U, 0x3E124925U},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RN, false, 0x40000000U, 0x00000000U, 0x00000000U, 0x3FB504F3U},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RP, false, 0x40000000U, 0x00000000U, 0x00000000U, 0x3FB504F4U},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RM, false, 0x40000000U, 0x00000000U, 0x00000000U, 0x3FB504F3U},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RZ, false, 0x40000000U, 0x00000000U, 0x00000000U, 0x3FB504F3U},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RN, false, 0x40400000U, 0x00000000U, 0x00000000U, 0x3FDDB3D7U},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RN, false, 0x3E800000U, 0x00000000U, 0x00000000U, 0x3F000000U},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RN, false, 0x00000800U, 0x00000000U, 0x00000000U, 0x1D000000U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0x40200000U, 0x00000000U, 0x00000000U, 0x00000002U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RP, false, 0x40200000U, 0x00000000U, 0x00000000U, 0x00000003U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RM, false, 0x40200000U, 0x00000000U, 0x00000000U, 0x00000002U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RZ, false, 0x40200000U, 0x00000000U, 0x00000000U, 0x00000002U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0xC0200000U, 0x00000000U, 0x00000000U, 0xFFFFFFFEU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RP, false, 0xC0200000U, 0x00000000U, 0x00000000U, 0xFFFFFFFEU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RM, false, 0xC0200000U, 0x00000000U, 0x00000000U, 0xFFFFFFFDU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RZ, false, 0xC0200000U, 0x00000000U, 0x00000000U, 0xFFFFFFFEU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0x40600000U, 0x00000000U, 0x00000000U, 0x00000004U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0x501502F9U, 0x00000000U, 0x00000000U, 0x7FFFFFFFU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0xD01502F9U, 0x00000000U, 0x00000000U, 0x80000000U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RN, false, 0x01000001U, 0x00000000U, 0x00000000U, 0x4B800000U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RP, false, 0x01000001U, 0x00000000U, 0x00000000U, 0x4B800001U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RM, false, 0x01000001U, 0x00000000U, 0x00000000U, 0x4B800000U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RZ, false, 0x01000001U, 0x00000000U, 0x00000000U, 0x4B800000U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RN, false, 0xFEFFFFFDU, 0x00000000U, 0x00000000U, 0xCB800002U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RP, false, 0xFEFFFFFDU, 0x00000000U, 0x00000000U, 0xCB800001U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RM, false, 0xFEFFFFFDU, 0x00000000U, 0x00000000U, 0xCB800002U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RZ, false, 0xFEFFFFFDU, 0x00000000U, 0x00000000U, 0xCB800001U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RN, false, 0x7FFFFFFFU, 0x00000000U, 0x00000000U, 0x4F000000U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RZ, false, 0x7FFFFFFFU, 0x00000000U, 0x00000000U, 0x4EFFFFFFU},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x00002000U, 0x00002000U, 0x00000000U, 0x00004000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, true, 0x00002000U, 0x00002000U, 0x00000000U, 0x00000000U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RN, false, 0x1D800000U, 0x1B000000U, 0x00000000U, 0x00000100U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RZ, false, 0x1D800000U, 0x1B000000U, 0x00000000U, 0x00000100U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RN, true, 0x1D800000U, 0x1B000000U, 0x00000000U, 0x00000000U},
+    {FPU_KAT_OP_SUB , FPU_KAT_RN, false, 0x00800000U, 0x00800001U, 0x00000000U, 0x80000001U},
+};
+
+#if FPU_DATAPATH_DP_SUPPORTED
+static const fpu_kat_dp_t fpu_kat_dp[] =
+{
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x3FF0000000000000U, 0x3CA0000000000000U, 0x0000000000000000U, 0x3FF0000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RP, false, 0x3FF0000000000000U, 0x3CA0000000000000U, 0x0000000000000000U, 0x3FF0000000000001U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x3FF0000000000000U, 0x3CA0000000000000U, 0x0000000000000000U, 0x3FF0000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RZ, false, 0x3FF0000000000000U, 0x3CA0000000000000U, 0x0000000000000000U, 0x3FF0000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x3FF0000000000000U, 0x3CA8000000000000U, 0x0000000000000000U, 0x3FF0000000000001U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RP, false, 0x3FF0000000000000U, 0x3CA8000000000000U, 0x0000000000000000U, 0x3FF0000000000001U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x3FF0000000000000U, 0x3CA8000000000000U, 0x0000000000000000U, 0x3FF0000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RZ, false, 0x3FF0000000000000U, 0x3CA8000000000000U, 0x0000000000000000U, 0x3FF0000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x3FF199999999999AU, 0x400199999999999AU, 0x0000000000000000U, 0x400A666666666667U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RP, false, 0x3FF199999999999AU, 0x400199999999999AU, 0x0000000000000000U, 0x400A666666666667U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x3FF199999999999AU, 0x400199999999999AU, 0x0000000000000000U, 0x400A666666666667U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RZ, false, 0x3FF199999999999AU, 0x400199999999999AU, 0x0000000000000000U, 0x400A666666666667U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x3FF8000000000000U, 0xBFF8000000000000U, 0x0000000000000000U, 0x0000000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x3FF8000000000000U, 0xBFF8000000000000U, 0x0000000000000000U, 0x8000000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x7FEFFFFFFFFFFFFFU, 0x7FEFFFFFFFFFFFFFU, 0x0000000000000000U, 0x7FF0000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RP, false, 0x7FEFFFFFFFFFFFFFU, 0x7FEFFFFFFFFFFFFFU, 0x0000000000000000U, 0x7FF0000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RM, false, 0x7FEFFFFFFFFFFFFFU, 0x7FEFFFFFFFFFFFFFU, 0x0000000000000000U, 0x7FEFFFFFFFFFFFFFU},
+    {FPU_KAT_OP_ADD , FPU_KAT_RZ, false, 0x7FEFFFFFFFFFFFFFU, 0x7FEFFFFFFFFFFFFFU, 0x0000000000000000U, 0x7FEFFFFFFFFFFFFFU},
+    {FPU_KAT_OP_SUB , FPU_KAT_RN, false, 0x3FF0000000000000U, 0x3C80000000000000U, 0x0000000000000000U, 0x3FF0000000000000U},
+    {FPU_KAT_OP_SUB , FPU_KAT_RP, false, 0x3FF0000000000000U, 0x3C80000000000000U, 0x0000000000000000U, 0x3FF0000000000000U},
+    {FPU_KAT_OP_SUB , FPU_KAT_RM, false, 0x3FF0000000000000U, 0x3C80000000000000U, 0x0000000000000000U, 0x3FEFFFFFFFFFFFFFU},
+    {FPU_KAT_OP_SUB , FPU_KAT_RZ, false, 0x3FF0000000000000U, 0x3C80000000000000U, 0x0000000000000000U, 0x3FEFFFFFFFFFFFFFU},
+    {FPU_KAT_OP_SUB , FPU_KAT_RN, false, 0x3FD3333333333333U, 0x3FB999999999999AU, 0x0000000000000000U, 0x3FC9999999999999U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RN, false, 0x3FF199999999999AU, 0x3FF199999999999AU, 0x0000000000000000U, 0x3FF35C28F5C28F5DU},
+    {FPU_KAT_OP_MUL , FPU_KAT_RP, false, 0x3FF199999999999AU, 0x3FF199999999999AU, 0x0000000000000000U, 0x3FF35C28F5C28F5EU},
+    {FPU_KAT_OP_MUL , FPU_KAT_RM, false, 0x3FF199999999999AU, 0x3FF199999999999AU, 0x0000000000000000U, 0x3FF35C28F5C28F5DU},
+    {FPU_KAT_OP_MUL , FPU_KAT_RZ, false, 0x3FF199999999999AU, 0x3FF199999999999AU, 0x0000000000000000U, 0x3FF35C28F5C28F5DU},
+    {FPU_KAT_OP_MUL , FPU_KAT_RN, false, 0x4008000000000000U, 0x3FD5555555555555U, 0x0000000000000000U, 0x3FF0000000000000U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RZ, false, 0x4008000000000000U, 0x3FD5555555555555U, 0x0000000000000000U, 0x3FEFFFFFFFFFFFFFU},
+    {FPU_KAT_OP_MUL , FPU_KAT_RP, false, 0xBFFB333333333333U, 0x4002666666666666U, 0x0000000000000000U, 0xC00F47AE147AE146U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RM, false, 0xBFFB333333333333U, 0x4002666666666666U, 0x0000000000000000U, 0xC00F47AE147AE147U},
+    {FPU_KAT_OP_FMA , FPU_KAT_RN, false, 0x3FF0000000000001U, 0x3FEFFFFFFFFFFFFFU, 0xBFF0000000000000U, 0x3C9FFFFFFFFFFFFEU},
+    {FPU_KAT_OP_FMA , FPU_KAT_RM, false, 0x3FF0000000000001U, 0x3FEFFFFFFFFFFFFFU, 0xBFF0000000000000U, 0x3C9FFFFFFFFFFFFEU},
+    {FPU_KAT_OP_FMA , FPU_KAT_RN, false, 0x3FF199999999999AU, 0x3FF199999999999AU, 0xBFF35C28F5C28F5CU, 0x3CB0A3D70A3D70A4U},
+    {FPU_KAT_OP_FMA , FPU_KAT_RZ, false, 0x3FF199999999999AU, 0x3FF199999999999AU, 0xBFF35C28F5C28F5CU, 0x3CB0A3D70A3D70A4U},
+    {FPU_KAT_OP_FMA , FPU_KAT_RN, false, 0x4000000000000000U, 0x4008000000000000U, 0x3FE0000000000000U, 0x401A000000000000U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RN, false, 0x3FF0000000000000U, 0x4008000000000000U, 0x0000000000000000U, 0x3FD5555555555555U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RP, false, 0x3FF0000000000000U, 0x4008000000000000U, 0x0000000000000000U, 0x3FD5555555555556U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RM, false, 0x3FF0000000000000U, 0x4008000000000000U, 0x0000000000000000U, 0x3FD5555555555555U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RZ, false, 0x3FF0000000000000U, 0x4008000000000000U, 0x0000000000000000U, 0x3FD5555555555555U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RN, false, 0xC000000000000000U, 0x4008000000000000U, 0x0000000000000000U, 0xBFE5555555555555U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RP, false, 0xC000000000000000U, 0x4008000000000000U, 0x0000000000000000U, 0xBFE5555555555555U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RM, false, 0xC000000000000000U, 0x4008000000000000U, 0x0000000000000000U, 0xBFE5555555555556U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RZ, false, 0xC000000000000000U, 0x4008000000000000U, 0x0000000000000000U, 0xBFE5555555555555U},
+    {FPU_KAT_OP_DIV , FPU_KAT_RN, false, 0x3FF0000000000000U, 0x401C000000000000U, 0x0000000000000000U, 0x3FC2492492492492U},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RN, false, 0x4000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x3FF6A09E667F3BCDU},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RP, false, 0x4000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x3FF6A09E667F3BCDU},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RM, false, 0x4000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x3FF6A09E667F3BCCU},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RZ, false, 0x4000000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x3FF6A09E667F3BCCU},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RN, false, 0x4008000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x3FFBB67AE8584CAAU},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RN, false, 0x3FD0000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x3FE0000000000000U},
+    {FPU_KAT_OP_SQRT, FPU_KAT_RN, false, 0x0000010000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x1FA0000000000000U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0x4004000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x00000002U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RP, false, 0x4004000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x00000003U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RM, false, 0x4004000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x00000002U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RZ, false, 0x4004000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x00000002U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0xC004000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0xFFFFFFFEU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RP, false, 0xC004000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0xFFFFFFFEU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RM, false, 0xC004000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0xFFFFFFFDU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RZ, false, 0xC004000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0xFFFFFFFEU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0x400C000000000000U, 0x0000000000000000U, 0x0000000000000000U, 0x00000004U},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0x4202A05F20000000U, 0x0000000000000000U, 0x0000000000000000U, 0x7FFFFFFFU},
+    {FPU_KAT_OP_F2S , FPU_KAT_RN, false, 0xC202A05F20000000U, 0x0000000000000000U, 0x0000000000000000U, 0x80000000U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RN, false, 0x000000007FFFFFFFU, 0x0000000000000000U, 0x0000000000000000U, 0x41DFFFFFFFC00000U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RN, false, 0x0000000080000000U, 0x0000000000000000U, 0x0000000000000000U, 0xC1E0000000000000U},
+    {FPU_KAT_OP_S2F , FPU_KAT_RZ, false, 0x00000000FFFFFFF9U, 0x0000000000000000U, 0x0000000000000000U, 0xC01C000000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, false, 0x0000040000000000U, 0x0000040000000000U, 0x0000000000000000U, 0x0000080000000000U},
+    {FPU_KAT_OP_ADD , FPU_KAT_RN, true, 0x0000040000000000U, 0x0000040000000000U, 0x0000000000000000U, 0x0000000000000000U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RN, false, 0x1FB0000000000000U, 0x1F60000000000000U, 0x0000000000000000U, 0x0000002000000000U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RZ, false, 0x1FB0000000000000U, 0x1F60000000000000U, 0x0000000000000000U, 0x0000002000000000U},
+    {FPU_KAT_OP_MUL , FPU_KAT_RN, true, 0x1FB0000000000000U, 0x1F60000000000000U, 0x0000000000000000U, 0x0000000000000000U},
+    {FPU_KAT_OP_SUB , FPU_KAT_RN, false, 0x0010000000000000U, 0x0010000000000001U, 0x0000000000000000U, 0x8000000000000001U},
+};
+
+#endif /* FPU_DATAPATH_DP_SUPPORTED */
+
+#endif /* FPU_TEST_VECTORS_H_ */
@@ -0,0 +1,603 @@
+/******************************************************************************
+* File Name:   low_power.c
+*
+* Description: Low power mode of the run time tests. The device sleeps in Deep Sleep
+*              until the low power timer ends, runs the test steps selected by the
+*              wake window planner and goes back to Deep Sleep. The active time of
+*              the windows is measured and reported per day.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+
+#include "low_power.h"
+#include "ecc_test.h"
+#include "clock_monitor.h"
+#include "test_rate.h"
+
+#if LOW_POWER_TEST_ENABLE
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Job indexes */
+#define LOW_POWER_JOB_FLASH             (0u)
+#define LOW_POWER_JOB_SRAM              (1u)
+#define LOW_POWER_JOB_CLOCK             (2u)
+#define LOW_POWER_JOB_CLOCK_TREE        (3u)
+#if CLOCK_MONITOR_ENABLE
+#define LOW_POWER_JOB_COUNT             (4u)
+#else
+#define LOW_POWER_JOB_COUNT             (3u)
+#endif
+
+/* Priority of the low power timer interrupt */
+#define LOW_POWER_LPTIMER_PRIORITY      (7u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Test run by a job. The step function is called with first = true at the
+ * start of the test and returns PASS_STILL_TESTING_STATUS until the test is
+ * complete, then the test starts over */
+typedef struct
+{
+    const char *name;
+    uint8_t (*step)(bool first);
+} low_power_test_t;
+
+/* Setup shared by the jobs of a group, run once per window */
+typedef struct
+{
+    void (*setup)(void);
+    void (*teardown)(void);
+} low_power_group_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint8_t Low_Power_Flash_Step(bool first);
+static uint8_t Low_Power_Sram_Step(bool first);
+static uint8_t Low_Power_Clock_Step(bool first);
+#if CLOCK_MONITOR_ENABLE
+static uint8_t Low_Power_Clock_Tree_Step(bool first);
+#endif
+static uint32_t Low_Power_Now_Ms(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const low_power_job_t low_power_jobs[LOW_POWER_JOB_COUNT] =
+{
+    [LOW_POWER_JOB_FLASH] = {LOW_POWER_FLASH_PERIOD_MS, LOW_POWER_FLASH_SLACK_MS,
+                             LOW_POWER_FLASH_COST_US, LOW_POWER_PLAN_NO_GROUP},
+    [LOW_POWER_JOB_SRAM]  = {LOW_POWER_SRAM_PERIOD_MS, LOW_POWER_SRAM_SLACK_MS,
+                             LOW_POWER_SRAM_COST_US, LOW_POWER_PLAN_NO_GROUP},
+    [LOW_POWER_JOB_CLOCK] = {LOW_POWER_CLOCK_PERIOD_MS, LOW_POWER_CLOCK_SLACK_MS,
+                             LOW_POWER_CLOCK_COST_US, LOW_POWER_PLAN_NO_GROUP},
+#if CLOCK_MONITOR_ENABLE
+    [LOW_POWER_JOB_CLOCK_TREE] = {LOW_POWER_CLOCK_TREE_PERIOD_MS, LOW_POWER_CLOCK_TREE_SLACK_MS,
+                                  LOW_POWER_CLOCK_TREE_COST_US, LOW_POWER_PLAN_NO_GROUP},
+#endif
+};
+
+static const low_power_test_t low_power_tests[LOW_POWER_JOB_COUNT] =
+{
+    [LOW_POWER_JOB_FLASH] = {"Flash Test",      Low_Power_Flash_Step},
+#if ECC_TEST_AVAILABLE
+    [LOW_POWER_JOB_SRAM]  = {"SRAM ECC Scrub",  Low_Power_Sram_Step},
+#else
+    [LOW_POWER_JOB_SRAM]  = {"SRAM March Test", Low_Power_Sram_Step},
+#endif
+    [LOW_POWER_JOB_CLOCK] = {"Clock Test",      Low_Power_Clock_Step},
+#if CLOCK_MONITOR_ENABLE
+    [LOW_POWER_JOB_CLOCK_TREE] = {"Clock Tree Test", Low_Power_Clock_Tree_Step},
+#endif
+};
+
+/* No job needs a setup of its own */
+static const low_power_group_t low_power_groups[LOW_POWER_PLAN_MAX_GROUPS] = {{NULL, NULL}};
+
+static const low_power_plan_config_t low_power_config =
+{
+    .jobs       = low_power_jobs,
+    .job_count  = LOW_POWER_JOB_COUNT,
+    .setup_us   = {0u},
+    .window_us  = LOW_POWER_WINDOW_US,
+    .pull_in_ms = LOW_POWER_PULL_IN_MS,
+};
+
+#if TEST_RATE_ENABLE
+/* Period bounds of the jobs and the signals they follow. Every job follows
+ * the retries */
+static const test_rate_test_t low_power_rate_tests[LOW_POWER_JOB_COUNT] =
+{
+    [LOW_POWER_JOB_FLASH] = {LOW_POWER_FLASH_PERIOD_MS,
+                             LOW_POWER_FLASH_PERIOD_MS * LOW_POWER_RATE_MAX_FACTOR,
+                             TEST_RATE_SIGNAL_RETRY},
+    [LOW_POWER_JOB_SRAM]  = {LOW_POWER_SRAM_PERIOD_MS,
+                             LOW_POWER_SRAM_PERIOD_MS * LOW_POWER_RATE_MAX_FACTOR,
+                             TEST_RATE_SIGNAL_ECC | TEST_RATE_SIGNAL_RETRY},
+    [LOW_POWER_JOB_CLOCK] = {LOW_POWER_CLOCK_PERIOD_MS,
+                             LOW_POWER_CLOCK_PERIOD_MS * LOW_POWER_RATE_MAX_FACTOR,
+                             TEST_RATE_SIGNAL_CLOCK | TEST_RATE_SIGNAL_IRQ | TEST_RATE_SIGNAL_RETRY},
+#if CLOCK_MONITOR_ENABLE
+    [LOW_POWER_JOB_CLOCK_TREE] = {LOW_POWER_CLOCK_TREE_PERIOD_MS,
+                                  LOW_POWER_CLOCK_TREE_PERIOD_MS * LOW_POWER_RATE_MAX_FACTOR,
+                                  TEST_RATE_SIGNAL_CLOCK | TEST_RATE_SIGNAL_RETRY},
+#endif
+};
+
+static const test_rate_config_t low_power_rate_config =
+{
+    .tests              = low_power_rate_tests,
+    .test_count         = LOW_POWER_JOB_COUNT,
+    .hold_updates       = LOW_POWER_RATE_HOLD_UPDATES,
+    .ecc_alarm          = LOW_POWER_RATE_ECC_ALARM,
+    .clock_enter_ppm    = LOW_POWER_RATE_CLOCK_ENTER_PPM,
+    .clock_exit_ppm     = LOW_POWER_RATE_CLOCK_EXIT_PPM,
+    .clock_trend_ppm    = LOW_POWER_RATE_CLOCK_TREND_PPM,
+    .clock_alarm_ppm    = LOW_POWER_RATE_CLOCK_ALARM_PPM,
+    .irq_enter_permille = LOW_POWER_RATE_IRQ_ENTER_PERMILLE,
+    .irq_exit_permille  = LOW_POWER_RATE_IRQ_EXIT_PERMILLE,
+    .irq_alarm_permille = LOW_POWER_RATE_IRQ_ALARM_PERMILLE,
+};
+#endif /* TEST_RATE_ENABLE */
+
+static struct
+{
+    low_power_plan_t plan;
+    cyhal_lptimer_t lptimer;
+    uint64_t ticks;             /* Low power timer ticks since the start */
+    uint32_t last_ticks;
+    uint32_t report_ms;         /* Time of the next report */
+    bool first[LOW_POWER_JOB_COUNT];
+    uint8_t retried[LOW_POWER_JOB_COUNT];  /* Retries of the current run of a test */
+    uint32_t retries;           /* Retries since the start */
+#if TEST_RATE_ENABLE
+    test_rate_t rate;
+    uint32_t rate_ms;           /* Time of the next update of the controller */
+    volatile uint16_t irq_margin_permille;
+    volatile bool irq_margin_valid;
+#endif
+} low_power;
+
+/*****************************************************************************
+* Function Name: Low_Power_Flash_Step
+******************************************************************************
+* Summary:
+* FLASH_DOUBLE_WORDS_TO_TEST double words of the flash checksum test, or
+* one slice of the most urgent flash region.
+*
+* Parameters:
+*  first: Initialize the test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Low_Power_Flash_Step(bool first)
+{
+    return Flash_Step(first, Low_Power_Now_Ms());
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Sram_Step
+******************************************************************************
+* Summary:
+* One block of the SRAM March test, or of the SRAM ECC scrub.
+*
+* Parameters:
+*  first: Initialize the test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Low_Power_Sram_Step(bool first)
+{
+#if ECC_TEST_AVAILABLE
+    return Ecc_Test_Scrub_Step();
+#else
+    return Sram_March_Step(first);
+#endif
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Clock_Step
+******************************************************************************
+* Summary:
+* Measures the IMO against the reference of the clock tree monitor for
+* LOW_POWER_CLOCK_REF_CYCLES and checks it within
+* CLOCK_MONITOR_TOLERANCE_PERMILLE. SelfTest_Clock() runs for one period of
+* its counter, longer than a window, and its limits are set for that period.
+*
+* Parameters:
+*  first: Unused, every measurement is a complete test
+*
+* Return:
+*  uint8_t: PASS_COMPLETE_STATUS, ERROR_STATUS if the IMO is out of tolerance
+*****************************************************************************/
+static uint8_t Low_Power_Clock_Step(bool first)
+{
+    uint32_t interrupt_state;
+    cy_en_sysclk_status_t start;
+    uint32_t hz;
+    uint32_t error_hz;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+    start = Cy_SysClk_StartClkMeasurementCounters(CLOCK_MONITOR_REF_CLK, LOW_POWER_CLOCK_REF_CYCLES,
+                                                  CY_SYSCLK_MEAS_CLK_IMO);
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+    if (CY_SYSCLK_SUCCESS != start)
+    {
+        return ERROR_STATUS;
+    }
+    while (!Cy_SysClk_ClkMeasurementCountersDone())
+    {
+    }
+
+    hz = Cy_SysClk_ClkMeasurementCountersGetFreq(true, CLOCK_MONITOR_REF_HZ);
+    error_hz = (hz > CY_SYSCLK_IMO_FREQ) ? (hz - CY_SYSCLK_IMO_FREQ) : (CY_SYSCLK_IMO_FREQ - hz);
+    return ((error_hz * 1000ULL) <= ((uint64_t)CY_SYSCLK_IMO_FREQ * CLOCK_MONITOR_TOLERANCE_PERMILLE)) ?
+           PASS_COMPLETE_STATUS : ERROR_STATUS;
+}
+
+#if CLOCK_MONITOR_ENABLE
+/*****************************************************************************
+* Function Name: Low_Power_Clock_Tree_Step
+******************************************************************************
+* Summary:
+* One reference window of the clock tree monitor.
+*
+* Parameters:
+*  first: Read the clock configuration and plan the windows again
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+static uint8_t Low_Power_Clock_Tree_Step(bool first)
+{
+    if (first && (OK_STATUS != Clock_Monitor_Init()))
+    {
+        return ERROR_STATUS;
+    }
+    return Clock_Monitor_Step();
+}
+#endif /* CLOCK_MONITOR_ENABLE */
+
+/*****************************************************************************
+* Function Name: Low_Power_Now_Ms
+******************************************************************************
+* Summary:
+* Returns the time since the start of the low power mode, counted by the low
+* power timer, which runs in Deep Sleep. Called at least once per wrap of
+* the timer counter.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t: Time in ms
+*****************************************************************************/
+static uint32_t Low_Power_Now_Ms(void)
+{
+    uint32_t ticks = cyhal_lptimer_read(&low_power.lptimer);
+
+    low_power.ticks += (uint32_t)(ticks - low_power.last_ticks);
+    low_power.last_ticks = ticks;
+    return (uint32_t)((low_power.ticks * 1000u) / LOW_POWER_LPTIMER_HZ);
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Window
+******************************************************************************
+* Summary:
+* Runs the jobs selected by the planner for the window starting now, with
+* the setup of each group before its first job and the teardown after its
+* last job, then the checks of Run_Time_Check().
+*
+* Parameters:
+*  now_ms: Start time of the window
+*
+* Return:
+*  uint8_t: OK_STATUS, ERROR_STATUS if a test failed
+*****************************************************************************/
+static uint8_t Low_Power_Window(uint32_t now_ms)
+{
+    uint32_t cycles_per_us = SystemCoreClock / 1000000u;
+    uint8_t order[LOW_POWER_PLAN_MAX_JOBS];
+    uint8_t group = LOW_POWER_PLAN_NO_GROUP;
+    uint8_t result = OK_STATUS;
+    uint32_t count = Low_Power_Plan_Window(&low_power.plan, now_ms, order);
+
+    for (uint32_t i = 0u; (i < count) && (OK_STATUS == result); i++)
+    {
+        uint32_t job = order[i];
+        uint32_t start;
+        uint8_t status;
+
+        if (low_power_jobs[job].group != group)
+        {
+            if (NULL != low_power_groups[group].teardown)
+            {
+                low_power_groups[group].teardown();
+            }
+            group = low_power_jobs[job].group;
+            if (NULL != low_power_groups[group].setup)
+            {
+                low_power_groups[group].setup();
+            }
+        }
+
+        start = CYCLE_COUNTER_GET();
+        status = low_power_tests[job].step(low_power.first[job]);
+        Low_Power_Plan_Record(&low_power.plan, job, (CYCLE_COUNTER_GET() - start) / cycles_per_us);
+
+        low_power.first[job] = (PASS_STILL_TESTING_STATUS != status);
+        if ((OK_STATUS == status) || (PASS_COMPLETE_STATUS == status))
+        {
+            low_power.retried[job] = 0u;
+        }
+        else if (PASS_STILL_TESTING_STATUS != status)
+        {
+#if (LOW_POWER_RETRIES > 0u)
+            if (low_power.retried[job] < LOW_POWER_RETRIES)
+            {
+                /* The test starts over at its next run */
+                low_power.retried[job]++;
+                low_power.retries++;
+                printf("Low power: %s failed, retry %u\r\n", low_power_tests[job].name,
+                       (unsigned int)low_power.retried[job]);
+                continue;
+            }
+#endif
+            printf("Low power: %s ERROR\r\n", low_power_tests[job].name);
+            result = ERROR_STATUS;
+        }
+    }
+
+    if (NULL != low_power_groups[group].teardown)
+    {
+        low_power_groups[group].teardown();
+    }
+
+    /* Program flow monitor signature, in every window */
+    if (ERROR_STATUS == Run_Time_Check())
+    {
+        printf("Low power: Program Flow Monitor ERROR\r\n");
+        result = ERROR_STATUS;
+    }
+    return result;
+}
+
+#if TEST_RATE_ENABLE
+/*****************************************************************************
+* Function Name: Low_Power_Rate_Signals
+******************************************************************************
+* Summary:
+* Reads the signals of the rate controller: the corrected errors of the SRAM
+* ECC scrub (XMC7000), the largest deviation measured by the clock tree
+* monitor, the interrupt margin given by the application, and the retries.
+*
+* Parameters:
+*  signals: Returns the signals
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Low_Power_Rate_Signals(test_rate_signals_t *signals)
+{
+    signals->valid = TEST_RATE_SIGNAL_RETRY;
+    signals->ecc_corrected = 0u;
+    signals->clock_deviation_ppm = 0;
+    signals->irq_margin_permille = low_power.irq_margin_permille;
+    signals->retries = low_power.retries;
+
+#if ECC_TEST_AVAILABLE
+    signals->valid |= TEST_RATE_SIGNAL_ECC;
+    signals->ecc_corrected = Ecc_Test_Get_Corrected_Count();
+#endif
+#if CLOCK_MONITOR_ENABLE
+    signals->valid |= TEST_RATE_SIGNAL_CLOCK;
+    for (uint32_t path = 0u; path < Clock_Monitor_Get_Path_Count(); path++)
+    {
+        int32_t deviation = Clock_Monitor_Get_Deviation(path);
+
+        if (((deviation < 0) ? -deviation : deviation) >
+            ((signals->clock_deviation_ppm < 0) ? -signals->clock_deviation_ppm :
+                                                  signals->clock_deviation_ppm))
+        {
+            signals->clock_deviation_ppm = deviation;
+        }
+    }
+#endif
+    if (low_power.irq_margin_valid)
+    {
+        signals->valid |= TEST_RATE_SIGNAL_IRQ;
+    }
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Rate_Update
+******************************************************************************
+* Summary:
+* Updates the rate controller every LOW_POWER_RATE_UPDATE_MS and moves the
+* periods of the jobs to the periods of the controller.
+*
+* Parameters:
+*  now_ms: Current time
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Low_Power_Rate_Update(uint32_t now_ms)
+{
+    test_rate_signals_t signals;
+
+    if ((int32_t)(now_ms - low_power.rate_ms) < 0)
+    {
+        return;
+    }
+    low_power.rate_ms += LOW_POWER_RATE_UPDATE_MS;
+
+    Low_Power_Rate_Signals(&signals);
+    (void)Test_Rate_Update(&low_power.rate, &signals);
+    for (uint32_t job = 0u; job < LOW_POWER_JOB_COUNT; job++)
+    {
+        Low_Power_Plan_Set_Period(&low_power.plan, job, Test_Rate_Get_Period(&low_power.rate, job));
+    }
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Set_Irq_Margin
+******************************************************************************
+* Summary:
+* Gives the margin of an interrupt count of the application to its bounds,
+* for example the control loop interrupts counted in a period of the low
+* power timer: 1000 permille at the nominal count, 0 at a bound. The
+* interrupt signal of the rate controller is used from the first call on.
+*
+* Parameters:
+*  margin_permille: Remaining margin
+*
+* Return:
+*  void
+*****************************************************************************/
+void Low_Power_Set_Irq_Margin(uint16_t margin_permille)
+{
+    low_power.irq_margin_permille = margin_permille;
+    low_power.irq_margin_valid = true;
+}
+#endif /* TEST_RATE_ENABLE */
+
+/*****************************************************************************
+* Function Name: Low_Power_Run
+******************************************************************************
+* Summary:
+* Runs the tests in wake windows, with the device in Deep Sleep in between,
+* and reports the active time per day every LOW_POWER_REPORT_PERIOD_MS.
+* With TEST_RATE_ENABLE, the periods of the jobs follow the rate controller.
+* Called after the boot tests instead of the idle loop.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: ERROR_STATUS when a test failed or the low power timer cannot be
+*           set up, does not return otherwise
+*****************************************************************************/
+uint8_t Low_Power_Run(void)
+{
+    uint32_t now_ms;
+    uint32_t wake_ms;
+    uint32_t window_start;
+#if TEST_RATE_ENABLE
+    test_rate_signals_t signals;
+#endif
+
+    if (CY_RSLT_SUCCESS != cyhal_lptimer_init(&low_power.lptimer))
+    {
+        return ERROR_STATUS;
+    }
+    cyhal_lptimer_enable_event(&low_power.lptimer, CYHAL_LPTIMER_COMPARE_MATCH,
+                               LOW_POWER_LPTIMER_PRIORITY, true);
+
+    low_power.ticks = 0u;
+    low_power.last_ticks = cyhal_lptimer_read(&low_power.lptimer);
+    low_power.report_ms = LOW_POWER_REPORT_PERIOD_MS;
+    for (uint32_t job = 0u; job < LOW_POWER_JOB_COUNT; job++)
+    {
+        low_power.first[job] = true;
+        low_power.retried[job] = 0u;
+    }
+    low_power.retries = 0u;
+    Low_Power_Plan_Init(&low_power.plan, &low_power_config, 0u);
+#if TEST_RATE_ENABLE
+    Low_Power_Rate_Signals(&signals);
+    Test_Rate_Init(&low_power.rate, &low_power_rate_config, &signals);
+    low_power.rate_ms = LOW_POWER_RATE_UPDATE_MS;
+#endif
+
+    for (;;)
+    {
+        now_ms = Low_Power_Now_Ms();
+        wake_ms = Low_Power_Plan_Next_Wake(&low_power.plan, now_ms);
+        if ((wake_ms - now_ms) >= LOW_POWER_MIN_SLEEP_MS)
+        {
+            /* The debug UART does not run in Deep Sleep */
+            while (cy_retarget_io_is_tx_active())
+            {
+            }
+            cyhal_lptimer_set_delay(&low_power.lptimer,
+                                    ((wake_ms - now_ms) * LOW_POWER_LPTIMER_HZ) / 1000u);
+            cyhal_syspm_deepsleep();
+        }
+
+        window_start = CYCLE_COUNTER_GET();
+        now_ms = Low_Power_Now_Ms();
+        if (OK_STATUS != Low_Power_Window(now_ms))
+        {
+            return ERROR_STATUS;
+        }
+        Low_Power_Plan_End_Window(&low_power.plan,
+                                  (CYCLE_COUNTER_GET() - window_start) / (SystemCoreClock / 1000000u));
+#if TEST_RATE_ENABLE
+        Low_Power_Rate_Update(now_ms);
+#endif
+
+        if ((int32_t)(now_ms - low_power.report_ms) >= 0)
+        {
+            low_power.report_ms += LOW_POWER_REPORT_PERIOD_MS;
+            printf("Low power: %lu ms active per day, %lu wakes, %lu windows over budget\r\n",
+                   (unsigned long)Low_Power_Plan_Active_Per_Day_Ms(&low_power.plan, now_ms),
+                   (unsigned long)low_power.plan.wakes,
+                   (unsigned long)low_power.plan.overruns);
+#if TEST_RATE_ENABLE
+            for (uint32_t job = 0u; job < LOW_POWER_JOB_COUNT; job++)
+            {
+                printf("Low power: %s every %lu ms\r\n", low_power_tests[job].name,
+                       (unsigned long)Test_Rate_Get_Period(&low_power.rate, job));
+            }
+#endif
+        }
+    }
+}
+#endif /* LOW_POWER_TEST_ENABLE */
+
+
+/* [] END OF FILE */
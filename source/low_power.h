@@ -0,0 +1,144 @@
+/******************************************************************************
+* File Name:   low_power.h
+*
+* Description: Header of the low power mode: the run time tests run in short wake
+*              windows planned by low_power_plan.c, and the device is in Deep Sleep
+*              in between.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef LOW_POWER_H_
+#define LOW_POWER_H_
+
+#include "self_test.h"
+#include "low_power_plan.h"
+#include "test_rate.h"
+#include "clock_monitor.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Period and slack of the jobs: one flash chunk, one SRAM March block (or
+ * ECC scrub block) and one clock measurement. A job runs at most period + slack
+ * after its previous run */
+#define LOW_POWER_FLASH_PERIOD_MS       (1000u)
+#define LOW_POWER_FLASH_SLACK_MS        (500u)
+#define LOW_POWER_SRAM_PERIOD_MS        (1000u)
+#define LOW_POWER_SRAM_SLACK_MS         (500u)
+#define LOW_POWER_CLOCK_PERIOD_MS       (10000u)
+#define LOW_POWER_CLOCK_SLACK_MS        (5000u)
+
+/* Period and slack of the clock tree monitor job (CLOCK_MONITOR_ENABLE):
+ * one reference window per run */
+#define LOW_POWER_CLOCK_TREE_PERIOD_MS  (10000u)
+#define LOW_POWER_CLOCK_TREE_SLACK_MS   (5000u)
+
+/* Initial cost estimates, replaced by the measured active times. The clock
+ * job measures the IMO against the reference of the clock tree monitor for
+ * LOW_POWER_CLOCK_REF_CYCLES, about 3 ms with the ILO; the full clock test
+ * (SelfTest_Clock), one period of the counter of design.modus, runs at boot */
+#define LOW_POWER_FLASH_COST_US         (2000u)
+#define LOW_POWER_SRAM_COST_US          (500u)
+#define LOW_POWER_CLOCK_COST_US         (3200u)
+#define LOW_POWER_CLOCK_TREE_COST_US    (1500u)
+
+/* Reference cycles of the IMO measurement of the clock job */
+#define LOW_POWER_CLOCK_REF_CYCLES      (96u)
+
+/* Active time budget of a wake window, and how early a job can join a
+ * window */
+#define LOW_POWER_WINDOW_US             (5000u)
+#define LOW_POWER_PULL_IN_MS            (500u)
+
+/* Frequency of the low power timer (LFCLK) that wakes the device */
+#define LOW_POWER_LPTIMER_HZ            (32768u)
+
+/* Shorter sleeps are not worth the Deep Sleep transitions */
+#define LOW_POWER_MIN_SLEEP_MS          (2u)
+
+/* Period of the active time report on the debug UART */
+#define LOW_POWER_REPORT_PERIOD_MS      (3600000u)
+
+/* Failed test runs restarted before the error is reported. The test runs
+ * again from its start; a retry is an alarm of the rate controller */
+#define LOW_POWER_RETRIES               (0u)
+
+/* Adaptive test rate (TEST_RATE_ENABLE, see test_rate.h). The periods above
+ * are the shortest periods; while the signals are healthy, the periods grow
+ * up to LOW_POWER_RATE_MAX_FACTOR times longer. The controller is updated
+ * every LOW_POWER_RATE_UPDATE_MS, a period grows by 1/8 after
+ * LOW_POWER_RATE_HOLD_UPDATES healthy updates */
+#define LOW_POWER_RATE_MAX_FACTOR       (8u)
+#define LOW_POWER_RATE_UPDATE_MS        (10000u)
+#define LOW_POWER_RATE_HOLD_UPDATES     (6u)
+
+/* Corrected ECC errors in one update that are an alarm; fewer are suspect */
+#define LOW_POWER_RATE_ECC_ALARM        (4u)
+
+/* Clock thresholds, in ppm: the average deviation is suspect from half of
+ * the tolerance of the clock tree monitor until it is back below 3/8 of
+ * it, or while it rises by 1/8 of it; one measurement past 3/4 of the
+ * tolerance is an alarm */
+#define LOW_POWER_RATE_CLOCK_ENTER_PPM  (CLOCK_MONITOR_TOLERANCE_PERMILLE * 500u)
+#define LOW_POWER_RATE_CLOCK_EXIT_PPM   (CLOCK_MONITOR_TOLERANCE_PERMILLE * 375u)
+#define LOW_POWER_RATE_CLOCK_TREND_PPM  (CLOCK_MONITOR_TOLERANCE_PERMILLE * 125u)
+#define LOW_POWER_RATE_CLOCK_ALARM_PPM  (CLOCK_MONITOR_TOLERANCE_PERMILLE * 750u)
+
+/* Margin of the interrupt count of the application to its bounds, given
+ * with Low_Power_Set_Irq_Margin() */
+#define LOW_POWER_RATE_IRQ_ENTER_PERMILLE   (250u)
+#define LOW_POWER_RATE_IRQ_EXIT_PERMILLE    (500u)
+#define LOW_POWER_RATE_IRQ_ALARM_PERMILLE   (50u)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+#if LOW_POWER_TEST_ENABLE
+uint8_t Low_Power_Run(void);
+#if TEST_RATE_ENABLE
+void Low_Power_Set_Irq_Margin(uint16_t margin_permille);
+#endif
+#endif
+
+#endif /* LOW_POWER_H_ */
+
+
+/* [] END OF FILE */
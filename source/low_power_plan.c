@@ -0,0 +1,309 @@
+/******************************************************************************
+* File Name:   low_power_plan.c
+*
+* Description: Wake window planner of the low power mode. The device wakes as late
+*              as the most urgent test step allows, and every step due by then or
+*              shortly after runs in the same window, within an active time
+*              budget. The steps of a window are grouped by shared setup, so that
+*              the setup runs once per window.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "low_power_plan.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Weight of a new measurement in the averaged cost of a job, 1/2^n */
+#define LOW_POWER_PLAN_COST_SHIFT       (2u)
+
+/* Time comparisons, valid while the times are less than 24 days apart */
+#define LOW_POWER_PLAN_BEFORE(a, b)     ((int32_t)((a) - (b)) < 0)
+
+/*****************************************************************************
+* Function Name: Low_Power_Plan_Latest
+******************************************************************************
+* Summary:
+* Returns the latest start time of the next run of a job.
+*
+* Parameters:
+*  plan: Plan
+*  job:  Job index
+*
+* Return:
+*  uint32_t: Time in ms
+*****************************************************************************/
+static uint32_t Low_Power_Plan_Latest(const low_power_plan_t *plan, uint32_t job)
+{
+    return plan->next_due_ms[job] + plan->config->jobs[job].slack_ms;
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Plan_Init
+******************************************************************************
+* Summary:
+* Starts a plan. The jobs are first due one period after now: the boot
+* tests have just run.
+*
+* Parameters:
+*  plan:   Plan state
+*  config: Jobs and budget, at most LOW_POWER_PLAN_MAX_JOBS jobs
+*  now_ms: Current time
+*
+* Return:
+*  void
+*****************************************************************************/
+void Low_Power_Plan_Init(low_power_plan_t *plan, const low_power_plan_config_t *config,
+                         uint32_t now_ms)
+{
+    plan->config = config;
+    for (uint32_t job = 0u; job < config->job_count; job++)
+    {
+        plan->period_ms[job] = config->jobs[job].period_ms;
+        plan->next_due_ms[job] = now_ms + plan->period_ms[job];
+        plan->cost_us[job] = config->jobs[job].cost_us;
+    }
+    plan->active_us = 0u;
+    plan->wakes = 0u;
+    plan->overruns = 0u;
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Plan_Next_Wake
+******************************************************************************
+* Summary:
+* Returns the time of the next wake: the earliest latest start time of the
+* jobs. Waking as late as possible lets the most jobs become due and run in
+* the same window.
+*
+* Parameters:
+*  plan:   Plan state
+*  now_ms: Current time
+*
+* Return:
+*  uint32_t: Time of the next wake in ms, now_ms if a job is late
+*****************************************************************************/
+uint32_t Low_Power_Plan_Next_Wake(const low_power_plan_t *plan, uint32_t now_ms)
+{
+    uint32_t wake = now_ms + INT32_MAX;
+
+    for (uint32_t job = 0u; job < plan->config->job_count; job++)
+    {
+        if (LOW_POWER_PLAN_BEFORE(Low_Power_Plan_Latest(plan, job), wake))
+        {
+            wake = Low_Power_Plan_Latest(plan, job);
+        }
+    }
+    return LOW_POWER_PLAN_BEFORE(wake, now_ms) ? now_ms : wake;
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Plan_Window
+******************************************************************************
+* Summary:
+* Selects and orders the jobs of the window starting now. The jobs due
+* within pull_in_ms are taken by increasing latest start time while the
+* budget allows; jobs at their latest start time are always taken. The
+* selected jobs are then ordered by group, the groups in the order of their
+* most urgent job. The selected jobs are next due one period after now.
+*
+* Parameters:
+*  plan:   Plan state
+*  now_ms: Start time of the window
+*  order:  Returns the selected job indexes in execution order, room for
+*          LOW_POWER_PLAN_MAX_JOBS
+*
+* Return:
+*  uint32_t: Number of selected jobs
+*****************************************************************************/
+uint32_t Low_Power_Plan_Window(low_power_plan_t *plan, uint32_t now_ms, uint8_t *order)
+{
+    const low_power_plan_config_t *config = plan->config;
+    uint8_t urgent[LOW_POWER_PLAN_MAX_JOBS];
+    bool selected[LOW_POWER_PLAN_MAX_JOBS] = {false};
+    bool group_setup[LOW_POWER_PLAN_MAX_GROUPS] = {false};
+    uint32_t candidates = 0u;
+    uint32_t count = 0u;
+    uint32_t planned_us = 0u;
+
+    /* Candidates by increasing latest start time (insertion sort) */
+    for (uint32_t job = 0u; job < config->job_count; job++)
+    {
+        uint32_t i = candidates;
+
+        if (LOW_POWER_PLAN_BEFORE(now_ms + config->pull_in_ms, plan->next_due_ms[job]))
+        {
+            continue;
+        }
+        while ((i > 0u) && LOW_POWER_PLAN_BEFORE(Low_Power_Plan_Latest(plan, job),
+                                                 Low_Power_Plan_Latest(plan, urgent[i - 1u])))
+        {
+            urgent[i] = urgent[i - 1u];
+            i--;
+        }
+        urgent[i] = (uint8_t)job;
+        candidates++;
+    }
+
+    for (uint32_t i = 0u; i < candidates; i++)
+    {
+        uint32_t job = urgent[i];
+        uint8_t group = config->jobs[job].group;
+        uint32_t cost_us = plan->cost_us[job] + (group_setup[group] ? 0u : config->setup_us[group]);
+        bool late = !LOW_POWER_PLAN_BEFORE(now_ms, Low_Power_Plan_Latest(plan, job));
+
+        if (late || ((planned_us + cost_us) <= config->window_us))
+        {
+            selected[job] = true;
+            group_setup[group] = true;
+            planned_us += cost_us;
+        }
+    }
+
+    /* Selected jobs grouped by setup, each group at its most urgent job */
+    for (uint32_t i = 0u; i < candidates; i++)
+    {
+        uint8_t group = config->jobs[urgent[i]].group;
+
+        if (!selected[urgent[i]])
+        {
+            continue;
+        }
+        for (uint32_t j = i; j < candidates; j++)
+        {
+            if (selected[urgent[j]] && (config->jobs[urgent[j]].group == group))
+            {
+                selected[urgent[j]] = false;
+                order[count++] = urgent[j];
+                plan->next_due_ms[urgent[j]] = now_ms + plan->period_ms[urgent[j]];
+            }
+        }
+    }
+
+    plan->wakes++;
+    if (planned_us > config->window_us)
+    {
+        plan->overruns++;
+    }
+    return count;
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Plan_Record
+******************************************************************************
+* Summary:
+* Updates the averaged cost of a job with the active time of a run.
+*
+* Parameters:
+*  plan:    Plan state
+*  job:     Job index
+*  cost_us: Measured active time of the run, without the group setup
+*
+* Return:
+*  void
+*****************************************************************************/
+void Low_Power_Plan_Record(low_power_plan_t *plan, uint32_t job, uint32_t cost_us)
+{
+    plan->cost_us[job] = plan->cost_us[job] - (plan->cost_us[job] >> LOW_POWER_PLAN_COST_SHIFT) +
+                         (cost_us >> LOW_POWER_PLAN_COST_SHIFT);
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Plan_Set_Period
+******************************************************************************
+* Summary:
+* Changes the period of a job, from its next run on. The next run is moved
+* to one new period after the last run; a job whose new period has already
+* elapsed is due at the next wake.
+*
+* Parameters:
+*  plan:      Plan state
+*  job:       Job index
+*  period_ms: New period
+*
+* Return:
+*  void
+*****************************************************************************/
+void Low_Power_Plan_Set_Period(low_power_plan_t *plan, uint32_t job, uint32_t period_ms)
+{
+    plan->next_due_ms[job] += period_ms - plan->period_ms[job];
+    plan->period_ms[job] = period_ms;
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Plan_End_Window
+******************************************************************************
+* Summary:
+* Adds the active time of a window, from the wake-up to the sleep request.
+*
+* Parameters:
+*  plan:      Plan state
+*  active_us: Measured active time of the window
+*
+* Return:
+*  void
+*****************************************************************************/
+void Low_Power_Plan_End_Window(low_power_plan_t *plan, uint32_t active_us)
+{
+    plan->active_us += active_us;
+}
+
+/*****************************************************************************
+* Function Name: Low_Power_Plan_Active_Per_Day_Ms
+******************************************************************************
+* Summary:
+* Returns the active time spent in the windows, scaled to one day.
+*
+* Parameters:
+*  plan:       Plan state
+*  elapsed_ms: Time since Low_Power_Plan_Init()
+*
+* Return:
+*  uint32_t: Active ms per day, 0 before the first ms
+*****************************************************************************/
+uint32_t Low_Power_Plan_Active_Per_Day_Ms(const low_power_plan_t *plan, uint32_t elapsed_ms)
+{
+    if (0u == elapsed_ms)
+    {
+        return 0u;
+    }
+    return (uint32_t)((plan->active_us * 86400u) / elapsed_ms);
+}
+
+
+/* [] END OF FILE */
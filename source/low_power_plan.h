@@ -0,0 +1,116 @@
+/******************************************************************************
+* File Name:   low_power_plan.h
+*
+* Description: Header of the wake window planner of the low power mode. Decides
+*              when the device wakes and which test steps run in each wake window.
+*              Platform independent: also built by the host model
+*              (host/model/low_power_model.c).
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef LOW_POWER_PLAN_H_
+#define LOW_POWER_PLAN_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Maximum number of jobs and of setup groups of a plan */
+#define LOW_POWER_PLAN_MAX_JOBS         (8u)
+#define LOW_POWER_PLAN_MAX_GROUPS       (4u)
+
+/* Group of the jobs without a shared setup */
+#define LOW_POWER_PLAN_NO_GROUP         (0u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* A job is one test step (a flash chunk, a March block, a clock sample) run
+ * once per period. It may run up to pull-in early and must run at most
+ * slack late: two runs of a job are at most period + slack apart */
+typedef struct
+{
+    uint32_t period_ms;
+    uint32_t slack_ms;
+    uint32_t cost_us;       /* Initial estimate of the active time of one run */
+    uint8_t group;          /* Jobs of a group share one setup per window */
+} low_power_job_t;
+
+/* Plan configuration */
+typedef struct
+{
+    const low_power_job_t *jobs;
+    uint32_t job_count;
+    uint32_t setup_us[LOW_POWER_PLAN_MAX_GROUPS];   /* Setup cost per group, 0 for group 0 */
+    uint32_t window_us;     /* Active time budget of a window, jobs at their deadline excepted */
+    uint32_t pull_in_ms;    /* Jobs due this soon join the window */
+} low_power_plan_config_t;
+
+/* Plan state */
+typedef struct
+{
+    const low_power_plan_config_t *config;
+    uint32_t period_ms[LOW_POWER_PLAN_MAX_JOBS];    /* Initially the period of the job */
+    uint32_t next_due_ms[LOW_POWER_PLAN_MAX_JOBS];
+    uint32_t cost_us[LOW_POWER_PLAN_MAX_JOBS];      /* Measured active time, averaged */
+    uint64_t active_us;     /* Active time of the windows */
+    uint32_t wakes;         /* Number of windows */
+    uint32_t overruns;      /* Windows over budget */
+} low_power_plan_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void Low_Power_Plan_Init(low_power_plan_t *plan, const low_power_plan_config_t *config,
+                         uint32_t now_ms);
+uint32_t Low_Power_Plan_Next_Wake(const low_power_plan_t *plan, uint32_t now_ms);
+uint32_t Low_Power_Plan_Window(low_power_plan_t *plan, uint32_t now_ms, uint8_t *order);
+void Low_Power_Plan_Record(low_power_plan_t *plan, uint32_t job, uint32_t cost_us);
+void Low_Power_Plan_Set_Period(low_power_plan_t *plan, uint32_t job, uint32_t period_ms);
+void Low_Power_Plan_End_Window(low_power_plan_t *plan, uint32_t active_us);
+uint32_t Low_Power_Plan_Active_Per_Day_Ms(const low_power_plan_t *plan, uint32_t elapsed_ms);
+
+#endif /* LOW_POWER_PLAN_H_ */
+
+
+/* [] END OF FILE */
@@ -59,6 +59,120 @@
 #include "cybsp.h"
 #include "cy_retarget_io.h"
 #include "self_test.h"
+#include "dma_benchmark.h"
+#include "stack_profiler.h"
+#include "dual_core.h"
+#include "flow_monitor.h"
+#include "fast_boot.h"
+#include "ecc_test.h"
+#include "low_power.h"
+#include "diag_log.h"
+#if defined(COMPONENT_FREERTOS)
+#include "self_test_rtos.h"
+#endif
+
+#if FAST_BOOT_ENABLE
+/*******************************************************************************
+* Function Name: Fast_Boot_Failure
+********************************************************************************
+* Summary:
+* Failure callback of the fast boot profile, called from the control loop
+* when a background test fails or misses its deadline.
+*
+* Parameters:
+*  test_name - Name of the failed or pending test
+*  failure   - Failure type
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void Fast_Boot_Failure(const char *test_name, fast_boot_failure_t failure)
+{
+    printf("Fast boot: %s %s\r\n", test_name,
+           (FAST_BOOT_DEADLINE_MISSED == failure) ? "DEADLINE MISSED" : "ERROR");
+}
+
+/*******************************************************************************
+* Function Name: Fast_Boot_Reset_Allowed
+********************************************************************************
+* Summary:
+* Asked by the fast boot profile before the watchdog test resets the device.
+* This example has no state to save, the reset is always allowed.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  bool: true when the device can be reset now
+*
+*******************************************************************************/
+static bool Fast_Boot_Reset_Allowed(void)
+{
+    return true;
+}
+#endif
+
+#if defined(COMPONENT_FREERTOS)
+/*******************************************************************************
+* Function Name: Self_Test_Results_Task
+********************************************************************************
+* Summary:
+* Prints the results of the run time tests posted to the result queue: the
+* failures, and the duration of every test in the first round.
+*
+* Parameters:
+*  arg - Result queue
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void Self_Test_Results_Task(void *arg)
+{
+    QueueHandle_t results = (QueueHandle_t)arg;
+    self_test_rtos_result_t result;
+
+    for (;;)
+    {
+        if (pdPASS != xQueueReceive(results, &result, portMAX_DELAY))
+        {
+            continue;
+        }
+        if (ERROR_STATUS == result.status)
+        {
+            printf("Run time test: round %lu %s ERROR\r\n",
+                   (unsigned long)result.round, result.name);
+        }
+        else if (0u == result.round)
+        {
+            printf("Run time test: %s %lu ticks\r\n", result.name,
+                   (unsigned long)result.run_time);
+        }
+    }
+}
+
+#if SELF_TEST_RTOS_USE_IDLE_HOOK
+/*******************************************************************************
+* Function Name: vApplicationIdleHook
+********************************************************************************
+* Summary:
+* FreeRTOS idle hook: runs the run time tests in the CPU time left by the
+* tasks.
+*
+* Parameters:
+*  none
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void vApplicationIdleHook(void)
+{
+    Self_Test_Rtos_Idle_Hook();
+}
+#endif
+#endif /* COMPONENT_FREERTOS */
 
 /*******************************************************************************
 * Function Name: main
@@ -97,6 +211,14 @@ int main(void)
     /* SelfTest API return status */
     uint8_t ret = 0u;
 
+    /* A periodic check of the idle loop has failed and was reported */
+    bool run_time_failed = false;
+
+#if defined(COMPONENT_FREERTOS)
+    /* Results of the run time tests */
+    QueueHandle_t results;
+#endif
+
     /* Initialize the device and board peripherals */
     result = cybsp_init();
 
@@ -119,6 +241,36 @@ int main(void)
         CY_ASSERT(0);
     }
 
+    /* Start the cycle counter used to time the tests */
+    Cycle_Counter_Init();
+
+#if DIAG_LOG_ENABLE
+    /* Keep the records of the previous runs, log this boot */
+    Diag_Log_Init();
+#endif
+
+#if STACK_PROFILER_ENABLE
+    /* Paint the unused stack for the stack usage profiler */
+    Stack_Profiler_Init();
+#endif
+
+#if FAST_BOOT_ENABLE
+    /* Fast boot profile: only the mandatory tests run before the control
+     * loop, the other tests run in slices between its cycles. In an
+     * application the control loop does not end; here it ends when the
+     * background tests are complete, to print the results */
+    ret = Fast_Boot_Start(Fast_Boot_Failure, Fast_Boot_Reset_Allowed);
+    if (OK_STATUS == ret)
+    {
+        do
+        {
+            /* Control cycle of the application */
+
+            ret = Fast_Boot_Poll();
+        } while (PASS_STILL_TESTING_STATUS == ret);
+    }
+#endif
+
     /* \x1b[2J\x1b[;H - ANSI ESC sequence for clear screen */
     printf("\x1b[2J\x1b[;H");
 
@@ -130,10 +282,22 @@ int main(void)
     printf("| #   | IP under test                   | Test Status | \r\n");
     printf("------------------------------------------------------- \r\n");
 
+#if FAST_BOOT_ENABLE
+    /* Results of the mandatory and background tests */
+    Fast_Boot_Print_Report();
+#else
+    /* Program flow monitor: entry of the test sequence */
+    FLOW_MONITOR_INIT(MAIN_START);
+
     /* Start Up Test */
     Start_Up_Test();
 
 
+#if DUAL_CORE_AVAILABLE
+    /* Program counter, CPU registers, Program Flow, FPU and Stack Tests
+     * on both CM7 cores */
+    Dual_Core_Test();
+#else
     /* Program counter Test */
     ret = SelfTest_PC();
     PRINT_TEST_RESULT(ip_index++,"Program Counter Test",ret);
@@ -146,6 +310,7 @@ int main(void)
     /* Program Flow Test*/
     ret = SelfTest_PROGRAM_FLOW();
     PRINT_TEST_RESULT(ip_index++,"Program Flow Test", ret);
+#endif
 
     /* Watch Dog Timer Test */
     Wdt_Test();
@@ -153,8 +318,12 @@ int main(void)
     /* GPIO Test */
     IO_Test();
 
+#if !DUAL_CORE_AVAILABLE
     /* FPU Test */
     FPU_Test();
+#endif
+
+    FLOW_CHECKPOINT(MAIN_CPU_TESTS, MAIN_START);
 
     #if (!defined(CY_DEVICE_PSOC6ABLE2)&& !defined (CY_DEVICE_SECURE))
     /* DMAC Test */
@@ -173,27 +342,117 @@ int main(void)
     /* Clock Test */
     Clock_Test();
 
+    #if CLOCK_MONITOR_ENABLE
+    /* Clock Tree Test */
+    Clock_Monitor_Test();
+    #endif
+
     /* Interrupt Test */
     Interrupt_Test();
 
+    FLOW_CHECKPOINT(MAIN_PERIPHERAL_TESTS, MAIN_CPU_TESTS);
+
+    #if ECC_TEST_AVAILABLE
+    /* SRAM and Flash ECC Test */
+    Ecc_Test();
+    #else
+    #if (SRAM_DMA_TEST_ENABLE && !defined (CY_DEVICE_SECURE))
+    /* SRAM Memory Test with DMA fills */
+    SRAM_Dma_Test();
+    #else
     /* SRAM Memory Test */
     SRAM_March_Test();
+    #endif
 
     /* Stack Memory Test */
     Stack_March_Test();
+    #endif
 
-    /* Stack Overflow and Underflow Test */
+#if (!DUAL_CORE_AVAILABLE || MPU_STACK_GUARD_ENABLE)
+    /* Stack Overflow and Underflow Test. The Dual Core Test has run the
+     * pattern check on both cores, the MPU stack guard is armed here */
     Stack_Memory_Test();
+#endif
 
     /* Flash Test */
     Flash_Test();
 
+#if FLOW_MONITOR_ENABLE
+    /* Program Flow Monitor: all checkpoints of the sequence were passed in order */
+    ret = FLOW_VERIFY(MAIN_END, MAIN_PERIPHERAL_TESTS);
+    PRINT_TEST_RESULT(ip_index++,"Program Flow Monitor", ret);
+    if (ERROR_STATUS == ret)
+    {
+        printf("SIGNATURE 0x%08lX\r\n", (unsigned long)Flow_Monitor_Get_Error_Signature());
+        DIAG_LOG_FAULT(ip_index - 1u, DIAG_LOG_FAULT_SIGNATURE, Flow_Monitor_Get_Error_Signature());
+    }
+#endif
+#endif /* FAST_BOOT_ENABLE */
+
     printf("------------------------------------------------------- \r\n\n");
     printf("END of the Core CPU Test.\r\n\n");
     printf("Total number of IPs covered in the Test      %d\r\n",--ip_index);
+
+#if STACK_PROFILER_ENABLE
+    /* Peak stack usage per test */
+    Stack_Profiler_Report();
+#endif
+
+#if FAST_BOOT_ENABLE
+    /* Boot time and duration of the background tests */
+    Fast_Boot_Print_Timing();
+#endif
+
+#if DUAL_CORE_AVAILABLE
+    /* Duration of the local tests per core */
+    Dual_Core_Print_Timing();
+#endif
+
+#if DIAG_LOG_ENABLE
+    /* Binary image of the diagnostic log for scripts/diag_decode.py */
+    Diag_Log_Dump();
+#endif
+
+#if (DMA_BENCHMARK_ENABLE && DMA_TRANSFER_DW_AVAILABLE)
+    /* DMA throughput benchmark */
+    if (OK_STATUS != Dma_Benchmark_Run())
+    {
+        printf("DMA benchmark: ERROR\r\n");
+    }
+#endif
+
+#if LOW_POWER_TEST_ENABLE
+    /* Run time tests in wake windows, Deep Sleep in between */
+    if (OK_STATUS != Low_Power_Run())
+    {
+        printf("Low power tests: ERROR\r\n");
+    }
+#endif
+
+#if defined(COMPONENT_FREERTOS)
+    /* Run time tests at low priority, the results are printed by a task of
+     * higher priority */
+    results = xQueueCreate(SELF_TEST_RTOS_QUEUE_LENGTH, sizeof(self_test_rtos_result_t));
+    if ((NULL != results) && (OK_STATUS == Self_Test_Rtos_Start(results)) &&
+        (pdPASS == xTaskCreate(Self_Test_Results_Task, "Results",
+                               SELF_TEST_RTOS_TASK_STACK_SIZE, results,
+                               SELF_TEST_RTOS_TASK_PRIORITY + 1u, NULL)))
+    {
+        vTaskStartScheduler();
+    }
+    printf("Run time tests: ERROR\r\n");
+#endif
+
     for (;;)
     {
-   
+        /* Program flow monitor signature, reported at the first failure */
+        if ((ERROR_STATUS == Run_Time_Check()) && !run_time_failed)
+        {
+            run_time_failed = true;
+            printf("Program Flow Monitor: ERROR, SIGNATURE 0x%08lX\r\n",
+                   (unsigned long)Flow_Monitor_Get_Error_Signature());
+        }
+        SELF_TEST_IDLE();
     }
 }
 
@@ -0,0 +1,134 @@
+/******************************************************************************
+* File Name:   mpu_fault_decode.c
+*
+* Description: This file decodes MemManage fault status register values for the
+*              MPU stack guard. It has no device dependencies, so it can be built
+*              and exercised on a host with synthetic register values.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "mpu_fault_decode.h"
+
+
+/*****************************************************************************
+* Function Name: Mpu_Fault_In_Region
+******************************************************************************
+* Summary:
+* Checks whether an address lies inside a guard region.
+*
+* Parameters:
+*  address - Address to check
+*  region  - Guard region
+*
+* Return:
+*  true if the address is inside the region
+*****************************************************************************/
+static bool Mpu_Fault_In_Region(uint32_t address, const mpu_fault_region_t *region)
+{
+    return (address >= region->base) && ((address - region->base) < region->size);
+}
+
+/*****************************************************************************
+* Function Name: Mpu_Fault_Decode
+******************************************************************************
+* Summary:
+* Classifies a MemManage fault from the fault status registers. regions[0] is
+* the stack guard. A data access violation inside it, or a stacking error
+* with the stack pointer at or below its end, is a stack overflow. A data
+* access violation inside any other region is a guard access. The address is
+* MMFAR when it is valid, the stack pointer for a stacking error, else 0.
+*
+* Parameters:
+*  cfsr        - SCB->CFSR value
+*  mmfar       - SCB->MMFAR value
+*  hfsr        - SCB->HFSR value
+*  sp          - Stack pointer at the time of the fault
+*  regions     - Guard regions, stack guard first
+*  num_regions - Number of guard regions
+*  info        - Decoded fault (output)
+*
+* Return:
+*  void
+*****************************************************************************/
+void Mpu_Fault_Decode(uint32_t cfsr, uint32_t mmfar, uint32_t hfsr, uint32_t sp,
+                      const mpu_fault_region_t *regions, uint8_t num_regions,
+                      mpu_fault_info_t *info)
+{
+    uint32_t mmfsr = cfsr & MPU_FAULT_MMFSR_MASK;
+
+    info->type = MPU_FAULT_NONE;
+    info->address_valid = (0u != (mmfsr & MPU_FAULT_MMFSR_MMARVALID));
+    info->on_stacking = (0u != (mmfsr & (MPU_FAULT_MMFSR_MSTKERR | MPU_FAULT_MMFSR_MLSPERR)));
+    /* MMFAR is not valid on a stacking error: report the stack pointer */
+    info->address = info->address_valid ? mmfar : (info->on_stacking ? sp : 0u);
+    info->escalated = (0u != (hfsr & MPU_FAULT_HFSR_FORCED));
+
+    if (0u == (mmfsr & ~MPU_FAULT_MMFSR_MMARVALID))
+    {
+        return;
+    }
+
+    info->type = MPU_FAULT_OTHER;
+
+    if ((NULL == regions) || (0u == num_regions))
+    {
+        return;
+    }
+
+    if (info->on_stacking && (sp < (regions[0].base + regions[0].size)))
+    {
+        info->type = MPU_FAULT_STACK_OVERFLOW;
+    }
+    else if (info->address_valid && (0u != (mmfsr & MPU_FAULT_MMFSR_DACCVIOL)))
+    {
+        for (uint8_t i = 0u; i < num_regions; i++)
+        {
+            if (Mpu_Fault_In_Region(info->address, &regions[i]))
+            {
+                info->type = (0u == i) ? MPU_FAULT_STACK_OVERFLOW : MPU_FAULT_GUARD_ACCESS;
+                break;
+            }
+        }
+    }
+    else
+    {
+        /* Instruction access or unstacking violation */
+    }
+}
+
+/* [] END OF FILE */
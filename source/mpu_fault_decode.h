@@ -0,0 +1,107 @@
+/******************************************************************************
+* File Name:   mpu_fault_decode.h
+*
+* Description: This file is the public interface of mpu_fault_decode.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef MPU_FAULT_DECODE_H_
+#define MPU_FAULT_DECODE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* MemManage fault status bits (CFSR[7:0]) */
+#define MPU_FAULT_MMFSR_IACCVIOL    (1UL << 0u)
+#define MPU_FAULT_MMFSR_DACCVIOL    (1UL << 1u)
+#define MPU_FAULT_MMFSR_MUNSTKERR   (1UL << 3u)
+#define MPU_FAULT_MMFSR_MSTKERR     (1UL << 4u)
+#define MPU_FAULT_MMFSR_MLSPERR     (1UL << 5u)
+#define MPU_FAULT_MMFSR_MMARVALID   (1UL << 7u)
+#define MPU_FAULT_MMFSR_MASK        (0xFFUL)
+
+/* HardFault status: fault escalated to HardFault */
+#define MPU_FAULT_HFSR_FORCED       (1UL << 30u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Fault classification */
+typedef enum
+{
+    MPU_FAULT_NONE           = 0u,  /* No MemManage fault recorded */
+    MPU_FAULT_STACK_OVERFLOW = 1u,  /* Stack grew into the stack guard */
+    MPU_FAULT_GUARD_ACCESS   = 2u,  /* Access to another guard region */
+    MPU_FAULT_OTHER          = 3u,  /* MemManage fault outside the guards */
+} mpu_fault_type_t;
+
+/* Guard region address range */
+typedef struct
+{
+    uint32_t base;
+    uint32_t size;
+} mpu_fault_region_t;
+
+/* Decoded fault */
+typedef struct
+{
+    mpu_fault_type_t type;
+    uint32_t address;       /* Faulting data address if address_valid, else sp on stacking */
+    bool address_valid;
+    bool on_stacking;       /* Fault during exception entry/lazy FP stacking */
+    bool escalated;         /* Fault was escalated to HardFault */
+} mpu_fault_info_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void Mpu_Fault_Decode(uint32_t cfsr, uint32_t mmfar, uint32_t hfsr, uint32_t sp,
+                      const mpu_fault_region_t *regions, uint8_t num_regions,
+                      mpu_fault_info_t *info);
+
+#endif /* MPU_FAULT_DECODE_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,298 @@
+/******************************************************************************
+* File Name:   mpu_guard.c
+*
+* Description: This file provides an MPU based stack guard. A no-access MPU region
+*              at the stack limit makes a stack overflow trap immediately in the
+*              MemManage fault handler, which reports it through the stack test
+*              result path. Additional guard regions can be configured.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+#include "mpu_guard.h"
+
+#if MPU_STACK_GUARD_ENABLE
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Guard regions; entry 0 is the stack guard, set up at run time */
+static mpu_fault_region_t mpu_guard_ranges[MPU_GUARD_MAX_REGIONS];
+static uint8_t mpu_guard_num_ranges = 0u;
+static bool mpu_guard_armed = false;
+
+/* Set while Mpu_Guard_Probe() reads the stack guard on purpose */
+volatile uint32_t mpu_guard_probe_active = 0u;
+static volatile mpu_fault_info_t mpu_guard_probe_info;
+
+static const mpu_guard_region_cfg_t mpu_guard_user_regions[] =
+{
+    MPU_GUARD_USER_REGIONS
+    {0UL, 0UL, 0u, 0u, 0u}
+};
+
+/*****************************************************************************
+* Function Name: Mpu_Guard_Init
+******************************************************************************
+* Summary:
+* Configures the guard regions in the highest MPU region numbers, so they take
+* priority over regions set up by the startup code, enables the MemManage
+* fault and enables the MPU with the default memory map as background.
+* The stack guard is the first MPU_GUARD_STACK_REGION_BYTES aligned block
+* inside the STACK_GUARD_SIZE bytes at the stack limit.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS if the MPU has too few regions
+*****************************************************************************/
+uint8_t Mpu_Guard_Init(void)
+{
+    uint32_t num_mpu_regions = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+    uint32_t region;
+    uint32_t stack_size_field = ARM_MPU_REGION_SIZE_32B;
+    uint8_t i;
+
+    while ((32u << (stack_size_field - ARM_MPU_REGION_SIZE_32B)) < MPU_GUARD_STACK_REGION_BYTES)
+    {
+        stack_size_field++;
+    }
+    mpu_guard_ranges[0].base = ((uint32_t)__StackLimit + MPU_GUARD_STACK_REGION_BYTES - 1u) &
+                               ~(MPU_GUARD_STACK_REGION_BYTES - 1u);
+    mpu_guard_ranges[0].size = MPU_GUARD_STACK_REGION_BYTES;
+    mpu_guard_num_ranges = 1u;
+
+    for (i = 0u; (0u != mpu_guard_user_regions[i].size) && (mpu_guard_num_ranges < MPU_GUARD_MAX_REGIONS); i++)
+    {
+        mpu_guard_ranges[mpu_guard_num_ranges].base = mpu_guard_user_regions[i].base;
+        mpu_guard_ranges[mpu_guard_num_ranges].size = mpu_guard_user_regions[i].size;
+        mpu_guard_num_ranges++;
+    }
+
+    if (num_mpu_regions < mpu_guard_num_ranges)
+    {
+        return ERROR_STATUS;
+    }
+
+    ARM_MPU_Disable();
+
+    region = num_mpu_regions - 1u;
+    ARM_MPU_SetRegion(ARM_MPU_RBAR(region, mpu_guard_ranges[0].base),
+                      ARM_MPU_RASR(1u, ARM_MPU_AP_NONE, 0u, 0u, 0u, 0u, 0u, stack_size_field));
+
+    for (i = 0u; (i + 1u) < mpu_guard_num_ranges; i++)
+    {
+        region--;
+        ARM_MPU_SetRegion(ARM_MPU_RBAR(region, mpu_guard_user_regions[i].base),
+                          ARM_MPU_RASR(mpu_guard_user_regions[i].execute_never,
+                                       mpu_guard_user_regions[i].access, 0u, 0u, 0u, 0u, 0u,
+                                       mpu_guard_user_regions[i].size_field));
+    }
+
+    SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;
+    ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk);
+    mpu_guard_armed = true;
+
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Mpu_Guard_Probe
+******************************************************************************
+* Summary:
+* Proves the detection path: reads the stack guard on purpose and checks that
+* the MemManage handler decoded a stack overflow at the guard address. The
+* probe handler skips the faulting 16-bit load and returns.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t Mpu_Guard_Probe(void)
+{
+    register uint32_t guard __asm("r1") = mpu_guard_ranges[0].base;
+
+    if (!mpu_guard_armed)
+    {
+        return ERROR_STATUS;
+    }
+
+    mpu_guard_probe_info.type = MPU_FAULT_NONE;
+    mpu_guard_probe_active = 1u;
+    __DSB();
+    __asm volatile ("ldr.n r0, [%0]" : : "r" (guard) : "r0", "memory");
+    mpu_guard_probe_active = 0u;
+
+    return ((MPU_FAULT_STACK_OVERFLOW == mpu_guard_probe_info.type) &&
+            (mpu_guard_ranges[0].base == mpu_guard_probe_info.address)) ? OK_STATUS : ERROR_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Mpu_Guard_Suspend
+******************************************************************************
+* Summary:
+* Disables the MPU while a test that writes the whole stack (the Stack March
+* test) runs.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Mpu_Guard_Suspend(void)
+{
+    if (mpu_guard_armed)
+    {
+        ARM_MPU_Disable();
+    }
+}
+
+/*****************************************************************************
+* Function Name: Mpu_Guard_Resume
+******************************************************************************
+* Summary:
+* Re-enables the MPU after Mpu_Guard_Suspend().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Mpu_Guard_Resume(void)
+{
+    if (mpu_guard_armed)
+    {
+        ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk);
+    }
+}
+
+/*****************************************************************************
+* Function Name: Mpu_Guard_Probe_Handler
+******************************************************************************
+* Summary:
+* MemManage handler path for Mpu_Guard_Probe(): records the decoded fault,
+* clears the fault status and returns past the faulting load.
+*
+* Parameters:
+*  frame - Exception stack frame
+*
+* Return:
+*  void
+*****************************************************************************/
+void Mpu_Guard_Probe_Handler(uint32_t *frame)
+{
+    mpu_fault_info_t info;
+
+    Mpu_Fault_Decode(SCB->CFSR, SCB->MMFAR, SCB->HFSR, (uint32_t)frame,
+                     mpu_guard_ranges, mpu_guard_num_ranges, &info);
+    mpu_guard_probe_info = info;
+    mpu_guard_probe_active = 0u;
+
+    /* Clear MMFSR (write one to clear) and skip the 16-bit load */
+    SCB->CFSR = SCB->CFSR & MPU_FAULT_MMFSR_MASK;
+    frame[6] += 2u;
+}
+
+/*****************************************************************************
+* Function Name: Mpu_Guard_Fault_Handler
+******************************************************************************
+* Summary:
+* MemManage handler path for real faults, entered with the stack pointer
+* reset to the stack top. Decodes the fault, disables the MPU and reports it
+* with Stack_Guard_Fault_Report(). Does not return.
+*
+* Parameters:
+*  sp - Stack pointer at the time of the fault
+*
+* Return:
+*  void
+*****************************************************************************/
+void Mpu_Guard_Fault_Handler(uint32_t sp)
+{
+    mpu_fault_info_t info;
+
+    Mpu_Fault_Decode(SCB->CFSR, SCB->MMFAR, SCB->HFSR, sp,
+                     mpu_guard_ranges, mpu_guard_num_ranges, &info);
+    ARM_MPU_Disable();
+
+    Stack_Guard_Fault_Report((MPU_FAULT_STACK_OVERFLOW == info.type) ? ERROR_STACK_OVERFLOW : ERROR_STATUS,
+                             info.address);
+
+    for (;;)
+    {
+    }
+}
+
+/*****************************************************************************
+* Function Name: MemManage_Handler
+******************************************************************************
+* Summary:
+* MemManage fault handler. During Mpu_Guard_Probe() it returns through
+* Mpu_Guard_Probe_Handler(). Otherwise the stack may have overflowed, so the
+* stack pointer is reset to the stack top before any C code runs.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+__attribute__((naked)) void MemManage_Handler(void)
+{
+    __asm volatile (
+        "ldr   r0, =mpu_guard_probe_active  \n"
+        "ldr   r0, [r0]                     \n"
+        "cbz   r0, 1f                       \n"
+        "mrs   r0, msp                      \n"
+        "b     Mpu_Guard_Probe_Handler      \n"
+        "1:                                 \n"
+        "mrs   r0, msp                      \n"
+        "ldr   r1, =__StackTop              \n"
+        "msr   msp, r1                      \n"
+        "b     Mpu_Guard_Fault_Handler      \n"
+    );
+}
+#endif /* MPU_STACK_GUARD_ENABLE */
+
+/* [] END OF FILE */
@@ -0,0 +1,98 @@
+/******************************************************************************
+* File Name:   mpu_guard.h
+*
+* Description: This file is the public interface of mpu_guard.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef MPU_GUARD_H_
+#define MPU_GUARD_H_
+
+#include "self_test.h"
+#include "mpu_fault_decode.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* The size of the no-access region at the stack limit,
+ * MPU_GUARD_STACK_REGION_BYTES, is set in self_test.h with STACK_GUARD_SIZE */
+#if ((MPU_GUARD_STACK_REGION_BYTES < 32u) || \
+     (0u != (MPU_GUARD_STACK_REGION_BYTES & (MPU_GUARD_STACK_REGION_BYTES - 1u))))
+#error "MPU_GUARD_STACK_REGION_BYTES must be a power of two of at least 32"
+#endif
+
+/* Additional guard regions as {base, size in bytes, ARM_MPU_REGION_SIZE_xx,
+ * ARM_MPU_AP_xx, execute-never} entries, each followed by a comma. The base
+ * must be aligned to the size. Set execute-never to 0u for regions that hold
+ * code. Example, a read-only 256-byte data block:
+ * #define MPU_GUARD_USER_REGIONS {0x08002000UL, 256UL, ARM_MPU_REGION_SIZE_256B, ARM_MPU_AP_RO, 1u},
+ */
+#define MPU_GUARD_USER_REGIONS
+
+/* Maximum number of guard regions, the stack guard included */
+#define MPU_GUARD_MAX_REGIONS           (4u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Guard region configuration */
+typedef struct
+{
+    uint32_t base;          /* Base address, aligned to the size */
+    uint32_t size;          /* Size in bytes */
+    uint8_t size_field;     /* ARM_MPU_REGION_SIZE_xx */
+    uint8_t access;         /* ARM_MPU_AP_xx */
+    uint8_t execute_never;  /* 1u: instruction fetches fault */
+} mpu_guard_region_cfg_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t Mpu_Guard_Init(void);
+uint8_t Mpu_Guard_Probe(void);
+void Mpu_Guard_Suspend(void);
+void Mpu_Guard_Resume(void);
+void MemManage_Handler(void);
+
+#endif /* MPU_GUARD_H_ */
+
+
+/* [] END OF FILE */
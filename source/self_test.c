@@ -46,6 +46,16 @@
 #include "cy_retarget_io.h"
 
 #include "self_test.h"
+#include "sram_dma_test.h"
+#include "mpu_guard.h"
+#include "fpu_datapath_test.h"
+#include "dual_core.h"
+#include "ecc_test.h"
+#include "diag_log.h"
+#include "flow_monitor.h"
+#include "stack_profiler.h"
+#include "flash_regions.h"
+#include "clock_monitor.h"
 
 
 /*******************************************************************************
@@ -58,6 +68,11 @@ uint8_t ip_index = 1u;
 
 uint16_t test_counter = 0u;
 
+#if FLOW_MONITOR_ENABLE
+/* The flow monitor failure has been recorded in the diagnostic log */
+static bool flow_monitor_logged = false;
+#endif
+
 
 /* Array to set shifts for March RAM test. */
 uint8_t shiftArrayRam[] = {5u, 0u};
@@ -101,6 +116,8 @@ void IO_Test(void)
     if (OK_STATUS != ret)
     {
         sprintf(uart_debug_string,"PORT %d[%d]",SelfTest_IO_GetPortError(),SelfTest_IO_GetPinError());
+        DIAG_LOG_FAULT(ip_index - 1u, DIAG_LOG_FAULT_IO,
+                       ((uint32_t)SelfTest_IO_GetPortError() << 8u) | SelfTest_IO_GetPinError());
         printf(uart_debug_string);
     }
 
@@ -268,6 +285,52 @@ void Clock_Test_Init(void)
 
 }
 
+#if CLOCK_MONITOR_ENABLE
+/*****************************************************************************
+* Function Name: Clock_Monitor_Test
+******************************************************************************
+* Summary:
+* Clock Tree Test: measuring every enabled clock of the clock tree once
+* against the ILO or the WCO, several clocks per reference window.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Clock_Monitor_Test(void)
+{
+    uint32_t path;
+    int32_t deviation;
+
+    if(ERROR_STATUS == ret)
+    {
+        printf("\r\n");
+    }
+
+    ret = Clock_Monitor_Init();
+    if (OK_STATUS == ret)
+    {
+        do
+        {
+            ret = Clock_Monitor_Step();
+        } while (PASS_STILL_TESTING_STATUS == ret);
+    }
+
+    PRINT_TEST_RESULT(ip_index,"Clock Tree Test", ret);
+    if (ERROR_STATUS == ret)
+    {
+        path = Clock_Monitor_Get_Error_Path();
+        deviation = Clock_Monitor_Get_Deviation(path);
+        printf("\t%s: %ld ppm\r\n", Clock_Monitor_Get_Name(path), (long)deviation);
+        DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_CLOCK,
+                       (path << 24u) | ((uint32_t)deviation & 0x00FFFFFFUL));
+    }
+    ip_index++;
+}
+#endif
+
 /*****************************************************************************
 * Function Name: Interrupt_Test
 ******************************************************************************
@@ -360,6 +423,11 @@ void Stack_March_Test(void)
 {
     uint8_t shiftIndexStack = 0u;
 
+#if MPU_STACK_GUARD_ENABLE
+    /* The March test writes the whole stack, including the guard */
+    Mpu_Guard_Suspend();
+#endif
+
     /* Init March Stack SelfTest */
     SelfTests_Init_March_Stack_Test(0u);
     if(ERROR_STATUS == ret)
@@ -402,6 +470,10 @@ void Stack_March_Test(void)
         }
     }
 
+#if MPU_STACK_GUARD_ENABLE
+    Mpu_Guard_Resume();
+#endif
+
     if (PASS_COMPLETE_STATUS == ret)
     {
         PRINT_TEST_RESULT(ip_index,"Stack March Test", ret);
@@ -409,6 +481,59 @@ void Stack_March_Test(void)
     ip_index++;
 }
 
+/*****************************************************************************
+* Function Name: Stack_March_Step
+******************************************************************************
+* Summary:
+* One block of the stack March test, once for every shift of
+* shiftArrayStack, for the run time tests of the fast boot profile, the low
+* power mode and the FreeRTOS adapter. Restores the stack overflow pattern
+* when complete.
+*
+* Parameters:
+*  first: Initialize the test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+uint8_t Stack_March_Step(bool first)
+{
+    static uint8_t shiftIndexStack;
+    uint8_t status;
+
+    if (first)
+    {
+        shiftIndexStack = 0u;
+        SelfTests_Init_March_Stack_Test(0u);
+    }
+
+#if MPU_STACK_GUARD_ENABLE
+    /* The March test writes the whole stack, including the guard */
+    Mpu_Guard_Suspend();
+#endif
+    status = SelfTests_Stack_March();
+#if MPU_STACK_GUARD_ENABLE
+    Mpu_Guard_Resume();
+#endif
+
+    if (PASS_COMPLETE_STATUS == status)
+    {
+        if (shiftIndexStack < (sizeof(shiftArrayStack) - 1u))
+        {
+            shiftIndexStack++;
+            SelfTests_Init_March_Stack_Test(shiftArrayStack[shiftIndexStack]);
+            status = PASS_STILL_TESTING_STATUS;
+        }
+#if !MPU_STACK_GUARD_ENABLE
+        else
+        {
+            SelfTests_Init_Stack_Test(PATTERN_BLOCK_SIZE);
+        }
+#endif
+    }
+    return status;
+}
+
 /*****************************************************************************
 * Function Name: SRAM_March_Test
 ******************************************************************************
@@ -475,6 +600,127 @@ void SRAM_March_Test(void)
     ip_index++;
 }
 
+/*****************************************************************************
+* Function Name: Sram_March_Step
+******************************************************************************
+* Summary:
+* One block of the SRAM March test, for the run time tests.
+*
+* Parameters:
+*  first: Initialize the test
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+uint8_t Sram_March_Step(bool first)
+{
+    if (first)
+    {
+        SelfTests_Init_March_SRAM_Test(0u);
+    }
+    return SelfTests_SRAM_March();
+}
+
+#if (SRAM_DMA_TEST_ENABLE && !defined (CY_DEVICE_SECURE))
+/*****************************************************************************
+* Function Name: SRAM_Dma_Test
+******************************************************************************
+* Summary:
+* SRAM DMA Test: Testing SRAM with March C-. The DW does the fills and the
+* final read (CRC), the CPU the read and write elements.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void SRAM_Dma_Test(void)
+{
+    if(ERROR_STATUS == ret)
+    {
+        printf("\r\n");
+    }
+
+    ret = Sram_Dma_Test_Init();
+
+    while (OK_STATUS == ret)
+    {
+        ret = Sram_Dma_Test_Step();
+        if (PASS_STILL_TESTING_STATUS == ret)
+        {
+            ret = OK_STATUS;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    PRINT_TEST_RESULT(ip_index,"SRAM DMA Test", ret);
+    if (ERROR_STATUS == ret)
+    {
+        printf("ADDR 0x%08lX", (unsigned long)Sram_Dma_Test_Get_Error_Address());
+        DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_ADDRESS, Sram_Dma_Test_Get_Error_Address());
+    }
+    ip_index++;
+}
+#endif
+
+#if ECC_TEST_AVAILABLE
+/*****************************************************************************
+* Function Name: Ecc_Test
+******************************************************************************
+* Summary:
+* ECC Test: Injecting correctable errors into SRAM and flash, then reading
+* the SRAM once through the ECC logic.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Ecc_Test(void)
+{
+    if(ERROR_STATUS == ret)
+    {
+        printf("\r\n");
+    }
+
+    ret = Ecc_Test_Init();
+    if (OK_STATUS == ret)
+    {
+        ret = Ecc_Test_Inject();
+    }
+
+    PRINT_TEST_RESULT(ip_index,"ECC Injection Test", ret);
+    if (ERROR_STATUS == ret)
+    {
+        printf("ADDR 0x%08lX\r\n", (unsigned long)Ecc_Test_Get_Error_Address());
+        DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_ADDRESS, Ecc_Test_Get_Error_Address());
+    }
+    ip_index++;
+
+    do
+    {
+        ret = Ecc_Test_Scrub_Step();
+    } while (PASS_STILL_TESTING_STATUS == ret);
+
+    PRINT_TEST_RESULT(ip_index,"SRAM ECC Scrub", ret);
+    if (ERROR_STATUS == ret)
+    {
+        printf("ADDR 0x%08lX\r\n", (unsigned long)Ecc_Test_Get_Error_Address());
+        DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_ADDRESS, Ecc_Test_Get_Error_Address());
+    }
+    else if (0u != Ecc_Test_Get_Corrected_Count())
+    {
+        printf("CORRECTED %lu\r\n", (unsigned long)Ecc_Test_Get_Corrected_Count());
+    }
+    ip_index++;
+}
+#endif
+
 /*****************************************************************************
 * Function Name: Memory_Test
 ******************************************************************************
@@ -489,6 +735,19 @@ void SRAM_March_Test(void)
 *****************************************************************************/
 void Stack_Memory_Test(void)
 {
+#if MPU_STACK_GUARD_ENABLE
+    if(ERROR_STATUS == ret)
+    {
+        printf("\r\n");
+    }
+    /* Arm the MPU stack guard and prove that an access to it traps */
+    ret = Mpu_Guard_Init();
+    if (OK_STATUS == ret)
+    {
+        ret = Mpu_Guard_Probe();
+    }
+    PRINT_TEST_RESULT(ip_index,"Stack Guard (MPU) Test", ret);
+#else
     /* Init Stack SelfTest */
     SelfTests_Init_Stack_Test(PATTERN_BLOCK_SIZE);
     if(ERROR_STATUS == ret)
@@ -503,21 +762,82 @@ void Stack_Memory_Test(void)
     {
          /* Process error */
         PRINT_TEST_RESULT(ip_index,"Stack Overflow Test", ret);
+        DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_STACK, ret);
     }
     else if ((ERROR_STACK_UNDERFLOW & ret))
     {
          /* Process error */
         PRINT_TEST_RESULT(ip_index,"Stack Underflow Test", ret);
+        DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_STACK, ret);
     }
 
     else
     {
         PRINT_TEST_RESULT(ip_index,"Stack Memory Test", ret);
     }
+#endif
     Cy_SysLib_Delay(CUSTOM_DELAY_VAL);
     ip_index++;
 }
 
+#if MPU_STACK_GUARD_ENABLE
+/*****************************************************************************
+* Function Name: Stack_Guard_Puts
+******************************************************************************
+* Summary:
+* Sends a string on the debug UART with polled writes. Used by the MemManage
+* handler, where printf and its buffers cannot be used.
+*
+* Parameters:
+*  text - String to send
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Stack_Guard_Puts(const char *text)
+{
+    while ('\0' != *text)
+    {
+        (void)cyhal_uart_putc(&cy_retarget_io_uart_obj, (uint32_t)*text);
+        text++;
+    }
+}
+
+/*****************************************************************************
+* Function Name: Stack_Guard_Fault_Report
+******************************************************************************
+* Summary:
+* Records a fault trapped by the MPU stack guard in the diagnostic log and
+* reports it on the debug UART as the pattern based stack test reports an
+* overflow. Called from the MemManage handler with the stack pointer reset
+* to the stack top, so it only writes the log and sends polled characters.
+*
+* Parameters:
+*  status  - ERROR_STACK_OVERFLOW or ERROR_STATUS for other guard faults
+*  address - Faulting address, or the stack pointer for a stacking error
+*
+* Return:
+*  void
+*****************************************************************************/
+void Stack_Guard_Fault_Report(uint8_t status, uint32_t address)
+{
+    char hex[11] = "0x00000000";
+
+    ret = ERROR_STATUS;
+    DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_STACK, status);
+    DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_ADDRESS, address);
+
+    for (uint32_t i = 0u; i < 8u; i++)
+    {
+        hex[9u - i] = "0123456789ABCDEF"[(address >> (4u * i)) & 0xFu];
+    }
+    Stack_Guard_Puts((ERROR_STACK_OVERFLOW & status) ? "\r\nStack Overflow Test ERROR ADDR " :
+                                                       "\r\nStack Guard (MPU) Test ERROR ADDR ");
+    Stack_Guard_Puts(hex);
+    Stack_Guard_Puts("\r\n");
+}
+#endif
+
 /*****************************************************************************
 * Function Name: Flash_Test
 ******************************************************************************
@@ -533,21 +853,38 @@ void Stack_Memory_Test(void)
 *****************************************************************************/
 void Flash_Test(void)
 {
+#if FLASH_REGIONS_ENABLE
+    uint32_t region;
+    uint64_t region_sum;
+#else
     /* Variable for output calculated Flash Checksum */
     uint8_t flash_CheckSum_temp;
+#endif
     if(ERROR_STATUS == ret)
     {
         printf("\r\n");
     }
-    SelfTest_Flash_init(CY_FLASH_BASE,FLASH_END_ADDR,flash_StoredCheckSum);
+    Flash_Test_Init();
 
     for(;;)
     {
+#if FLASH_REGIONS_ENABLE
+        /* One pass of every region, without deadline at boot */
+        ret = Flash_Regions_Step(0u);
+#else
         ret =  SelfTest_FlashCheckSum(FLASH_DOUBLE_WORDS_TO_TEST);
+#endif
         PRINT_TEST_RESULT(ip_index,"Flash Test", ret);
 
         if (ERROR_STATUS == ret)
         {
+#if FLASH_REGIONS_ENABLE
+            region = Flash_Regions_Get_Error_Region();
+            region_sum = Flash_Regions_Get_Sum(region);
+            printf("\tREGION %s: 0x%08lX%08lX\r\n", Flash_Regions_Get(region)->name,
+                   (unsigned long)(region_sum >> 32u), (unsigned long)region_sum);
+            DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_CHECKSUM, (uint32_t)region_sum);
+#else
 #if(FLASH_TEST_MODE == FLASH_TEST_CRC32)
             printf("\r\nFLASH CRC: 0x");
 #elif (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64)
@@ -561,6 +898,9 @@ void Flash_Test(void)
                 printf("%02X", flash_CheckSum_temp);
             }
             printf("\r\n");
+            /* Low 32 bits of the checksum */
+            DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_CHECKSUM, flash_CheckSum);
+#endif
             break;
         }
         else if (PASS_COMPLETE_STATUS == ret) {
@@ -578,12 +918,70 @@ void Flash_Test(void)
     ip_index++;
 }
 
+/*****************************************************************************
+* Function Name: Flash_Test_Init
+******************************************************************************
+* Summary:
+* This function initializes the flash checksum test with the checksum
+* stored in the .flash_checksum section, or the schedule of the flash
+* regions on its first call.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Flash_Test_Init(void)
+{
+#if FLASH_REGIONS_ENABLE
+    /* The regions keep their schedule over the runs of the background tests */
+    static bool flash_regions_initialized = false;
+
+    if (!flash_regions_initialized)
+    {
+        Flash_Regions_Init();
+        flash_regions_initialized = true;
+    }
+#else
+    SelfTest_Flash_init(CY_FLASH_BASE,FLASH_END_ADDR,flash_StoredCheckSum);
+#endif
+}
+
+/*****************************************************************************
+* Function Name: Flash_Step
+******************************************************************************
+* Summary:
+* FLASH_DOUBLE_WORDS_TO_TEST double words of the flash checksum test, or
+* one slice of the most urgent flash region, for the run time tests.
+*
+* Parameters:
+*  first:  Initialize the test
+*  now_ms: Time of the runner in milliseconds, for the region deadlines
+*
+* Return:
+*  uint8_t: Test status
+*****************************************************************************/
+uint8_t Flash_Step(bool first, uint32_t now_ms)
+{
+    if (first)
+    {
+        Flash_Test_Init();
+    }
+#if FLASH_REGIONS_ENABLE
+    return Flash_Regions_Step(now_ms);
+#else
+    return SelfTest_FlashCheckSum(FLASH_DOUBLE_WORDS_TO_TEST);
+#endif
+}
+
 /*****************************************************************************
 * Function Name: FPU_Test
 ******************************************************************************
 * Summary:
 * FPU Test : The FPU registers test detects stuck-at faults in the FPU by
-* using the checkerboard test.
+* using the checkerboard test. The optional datapath test checks the
+* arithmetic units with known-answer vectors.
 *
 * Parameters:
 *  void
@@ -593,6 +991,8 @@ void Flash_Test(void)
 *****************************************************************************/
 void FPU_Test(void)
 {
+    uint32_t fpu_type;
+
     if(ERROR_STATUS == ret)
     {
         printf("\r\n");
@@ -600,15 +1000,104 @@ void FPU_Test(void)
 #if COMPONENT_CAT1A
     Cy_SystemInitFpuEnable();
 #endif
-    ret = SCB_GetFPUType();
+    fpu_type = SCB_GetFPUType();
 
     /**********************************/
     /* Run FPU Registers Self Test... */
     /**********************************/
-    ret = SelfTest_FPU_Registers();
+    if (0u == fpu_type)
+    {
+        /* No FPU present */
+        ret = ERROR_STATUS;
+    }
+    else
+    {
+        ret = SelfTest_FPU_Registers();
+    }
     PRINT_TEST_RESULT(ip_index++,"FPU Register Test", ret);
 
+#if FPU_DATAPATH_TEST_ENABLE
+    /**********************************/
+    /* Run FPU Datapath Test...       */
+    /**********************************/
+    if(ERROR_STATUS == ret)
+    {
+        printf("\r\n");
+    }
+    if (0u == fpu_type)
+    {
+        ret = ERROR_STATUS;
+    }
+    else
+    {
+        ret = FPU_Datapath_Test(fpu_type);
+    }
+    PRINT_TEST_RESULT(ip_index,"FPU Datapath Test", ret);
+    if (ERROR_STATUS == ret)
+    {
+        printf("VECTOR %lu CYCLES %lu", (unsigned long)FPU_Datapath_Get_Failed_Vector(),
+                (unsigned long)FPU_Datapath_Get_Cycles());
+    }
+    ip_index++;
+#endif
+}
+
+#if (DUAL_CORE_AVAILABLE && !DUAL_CORE_SECONDARY)
+/*****************************************************************************
+* Function Name: Dual_Core_Test
+******************************************************************************
+* Summary:
+* Dual Core Test: Runs the program counter, CPU registers, program flow, FPU
+* registers and stack tests on CM7_0 and CM7_1 concurrently and prints the
+* result of each test per core.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Dual_Core_Test(void)
+{
+    static const char * const test_names[DUAL_CORE_TEST_COUNT][DUAL_CORE_SYNC_CORES] =
+    {
+        {"Program Counter Test CM7_0", "Program Counter Test CM7_1"},
+        {"CPU Register Test CM7_0",    "CPU Register Test CM7_1"},
+        {"Program Flow Test CM7_0",    "Program Flow Test CM7_1"},
+        {"FPU Register Test CM7_0",    "FPU Register Test CM7_1"},
+        {"Stack Memory Test CM7_0",    "Stack Memory Test CM7_1"},
+    };
+    dual_core_report_t report;
+
+    (void)Dual_Core_Run(&report);
+
+    for (uint32_t test = 0u; test < (uint32_t)DUAL_CORE_TEST_COUNT; test++)
+    {
+        for (uint32_t core = 0u; core < DUAL_CORE_SYNC_CORES; core++)
+        {
+            if(ERROR_STATUS == ret)
+            {
+                printf("\r\n");
+            }
+            ret = (0u == (report.failed[core] & (1UL << test))) ? OK_STATUS : ERROR_STATUS;
+            PRINT_TEST_RESULT(ip_index++, test_names[test][core], ret);
+        }
+    }
+
+    if (DUAL_CORE_SYNC_TIMEOUT == report.status)
+    {
+        printf("CM7_1 NOT RESPONDING");
+    }
+    else if (DUAL_CORE_SYNC_CORRUPT == report.status)
+    {
+        printf("CM7_1 RESULT CORRUPT");
+    }
+    else
+    {
+        /* Do Nothing */
+    }
 }
+#endif
 
 #if (!defined(CY_DEVICE_PSOC6ABLE2)&& !defined (CY_DEVICE_SECURE))
 /*****************************************************************************
@@ -663,16 +1152,9 @@ void DMA_DW_Test(void)
     /**********************************/
     /* Run DMA DW Self Test... */
     /**********************************/
-#if defined(CY_DEVICE_PSOC6ABLE2)
     ret = SelfTest_DMA_DW(DMA_DW_HW, DMA_DW_CHANNEL, &DMA_DW_Descriptor_0, &DMA_DW_Descriptor_1,
             &DMA_DW_Descriptor_0_config,  &DMA_DW_Descriptor_1_config,
-            &DMA_DW_channelConfig, (en_trig_input_grp0_t)TRIG0_OUT_CPUSS_DW0_TR_IN0);
-#else
-    ret = SelfTest_DMA_DW(DMA_DW_HW, DMA_DW_CHANNEL, &DMA_DW_Descriptor_0, &DMA_DW_Descriptor_1,
-            &DMA_DW_Descriptor_0_config,  &DMA_DW_Descriptor_1_config,
-            &DMA_DW_channelConfig, TRIG_OUT_MUX_0_PDMA0_TR_IN0);
-#endif
-
+            &DMA_DW_channelConfig, DMA_DW_INPUT_TRIG_MUX);
 
 
     PRINT_TEST_RESULT(ip_index++,"DMA DW Test", ret);
@@ -681,23 +1163,20 @@ void DMA_DW_Test(void)
 #endif
 
 /*****************************************************************************
-* Function Name: Start_Up_Test
+* Function Name: Start_Up_Check
 ******************************************************************************
 * Summary:
-* Start Up Test : This function checks the startup configuration registers.
+* Checks the startup configuration registers, without printing. Used by
+* Start_Up_Test() and by the fast boot profile.
 *
 * Parameters:
 *  void
 *
 * Return:
-*  void
+*  uint8_t: Test status, ERROR_STATUS also when the registers can't be saved
 *****************************************************************************/
-void Start_Up_Test(void)
+uint8_t Start_Up_Check(void)
 {
-    if(ERROR_STATUS == ret)
-    {
-        printf("\r\n");
-    }
 #if COMPONENT_CAT1A
     /* This function initilizes the AREF address depending on the device.*/
     SelfTests_Init_StartUp_ConfigReg();
@@ -710,19 +1189,107 @@ void Start_Up_Test(void)
     /*******************************/
     if (CY_FLASH_DRV_SUCCESS  != SelfTests_Save_StartUp_ConfigReg())
     {
-        /* Process error */
-        printf("Error: Can't save Start-Up Config Registers\r\n");
+        return ERROR_STATUS;
     }
 
 #endif /* End (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE) */
     /**********************************/
     /* Run Start-Up regs Self Test... */
     /**********************************/
-    ret = SelfTests_StartUp_ConfigReg();
+    return SelfTests_StartUp_ConfigReg();
+}
+
+/*****************************************************************************
+* Function Name: Start_Up_Test
+******************************************************************************
+* Summary:
+* Start Up Test : This function checks the startup configuration registers.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Start_Up_Test(void)
+{
+    if(ERROR_STATUS == ret)
+    {
+        printf("\r\n");
+    }
+    ret = Start_Up_Check();
 
     /* Process error */
     PRINT_TEST_RESULT(ip_index++,"Start-Up Register Test",ret);
 
 }
 
+/*****************************************************************************
+* Function Name: Cycle_Counter_Init
+******************************************************************************
+* Summary:
+* Enables the DWT cycle counter used to time the tests. The counter wraps
+* every 2^32 CPU cycles, so only differences of CYCLE_COUNTER_GET() values
+* are meaningful.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Cycle_Counter_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if COMPONENT_CAT1C
+    /* Unlock the DWT registers on the CM7 */
+    DWT->LAR = 0xC5ACCE55UL;
+#endif
+    DWT->CYCCNT = 0UL;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*****************************************************************************
+* Function Name: Run_Time_Check
+******************************************************************************
+* Summary:
+* Periodic checks of the run time runners: the idle loop of main(),
+* Fast_Boot_Poll(), the step of the FreeRTOS adapter and the wake window of
+* the low power mode. Verifies that the running signature of the program
+* flow monitor is the signature of a checkpoint, and records the first
+* failure in the diagnostic log. Scans a slice of the stack for the stack
+* profiler and adds a history sample at the end of each scan pass.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t: OK_STATUS, or ERROR_STATUS once a check has failed
+*****************************************************************************/
+uint8_t Run_Time_Check(void)
+{
+    uint8_t status = OK_STATUS;
+
+#if STACK_PROFILER_ENABLE
+    if (Stack_Profiler_Scan_Slice(STACK_PROFILER_SLICE_WORDS))
+    {
+        Stack_Profiler_Sample();
+    }
+#endif
+
+#if FLOW_MONITOR_ENABLE
+    if (OK_STATUS != Flow_Monitor_Verify())
+    {
+        status = ERROR_STATUS;
+        if (!flow_monitor_logged)
+        {
+            flow_monitor_logged = true;
+            DIAG_LOG_FAULT(ip_index, DIAG_LOG_FAULT_SIGNATURE, Flow_Monitor_Get_Error_Signature());
+        }
+    }
+#endif
+
+    return status;
+}
+
 /* [] END OF FILE */
@@ -55,6 +55,13 @@ extern uint16_t test_counter;
 /*Index for IPs*/
 extern uint8_t ip_index;
 
+/* Shifts of the stack March test, one pass per shift */
+extern uint8_t shiftArrayStack[2];
+
+/* Stack limits from the linker script */
+extern uint32_t __StackLimit[];
+extern uint32_t __StackTop[];
+
 /*******************************************************************************
 * Macros
 *******************************************************************************/
@@ -70,25 +77,54 @@ extern uint8_t ip_index;
 /* Waiting time, in milliseconds, for proper start-up of ILO */
 #define ILO_START_UP_TIME              (2U)
 
+/* Enable the stack high-water-mark profiler. Every final test result print
+ * (not the IN PROGRESS ones) closes a profiling phase named after the test. */
+#define STACK_PROFILER_ENABLE (0u)
+
+#if STACK_PROFILER_ENABLE
+#define STACK_PROFILER_MARK(test_name) Stack_Profiler_Phase_End(test_name)
+#else
+#define STACK_PROFILER_MARK(test_name)
+#endif
+
+/* Record the test results and the fault details in a ring in no-init RAM
+ * that survives resets (see diag_log.h). Can be set from the build */
+#ifndef DIAG_LOG_ENABLE
+#define DIAG_LOG_ENABLE (0u)
+#endif
+
+#if DIAG_LOG_ENABLE
+#define DIAG_LOG_RESULT(index, status) Diag_Log_Result((index), (status))
+#define DIAG_LOG_FAULT(index, kind, detail) Diag_Log_Fault((index), (kind), (uint32_t)(detail))
+#else
+#define DIAG_LOG_RESULT(index, status)
+#define DIAG_LOG_FAULT(index, kind, detail)
+#endif
+
 /* Print Test Result*/
 #define PRINT_TEST_RESULT(index, test_name, status) \
     do { \
+        int print_index = (index); \
+        if (PASS_STILL_TESTING_STATUS != ret) { \
+            STACK_PROFILER_MARK(test_name); \
+        } \
+        DIAG_LOG_RESULT(print_index, ret); \
         if (OK_STATUS == ret) { \
             /* Process success */ \
-            printf("| %-4d| %-32s| %-12s|\r\n",index,test_name,"SUCCESS"); \
+            printf("| %-4d| %-32s| %-12s|\r\n",print_index,test_name,"SUCCESS"); \
         } \
         else if (PASS_COMPLETE_STATUS == ret) { \
             /* Process status */ \
-            printf("| %-4d| %-32s| %-12s|\r\n",index,test_name,"SUCCESS"); \
+            printf("| %-4d| %-32s| %-12s|\r\n",print_index,test_name,"SUCCESS"); \
             break; \
         } \
         else if (PASS_STILL_TESTING_STATUS == ret) { \
             /* Print test counter */ \
-            printf("| %-4d| %-32s| %-12s|count=%d\r",index,test_name,"IN PROGRESS", test_counter); \
+            printf("| %-4d| %-32s| %-12s|count=%d\r",print_index,test_name,"IN PROGRESS", test_counter); \
         } \
         else { \
             /* Process error */ \
-        printf("| %-4d| %-32s| %-12s|\t\t",index,test_name,"ERROR"); \
+        printf("| %-4d| %-32s| %-12s|\t\t",print_index,test_name,"ERROR"); \
         } \
     } while (0)
 
@@ -102,9 +138,102 @@ extern uint8_t ip_index;
     #define DMAC_INPUT_TRIG_MUX TRIG_OUT_MUX_3_MDMA_TR_IN0
 #endif
 
+#if defined(CY_DEVICE_PSOC6ABLE2)
+    #define DMA_DW_INPUT_TRIG_MUX ((en_trig_input_grp0_t)TRIG0_OUT_CPUSS_DW0_TR_IN0)
+#else
+    #define DMA_DW_INPUT_TRIG_MUX TRIG_OUT_MUX_0_PDMA0_TR_IN0
+#endif
+
+/* Enable the DMAC/DW throughput benchmark (CSV output on the debug UART) */
+#define DMA_BENCHMARK_ENABLE (0u)
+
+/* Run the DMA accelerated SRAM test instead of the SRAM March test */
+#ifndef SRAM_DMA_TEST_ENABLE
+#define SRAM_DMA_TEST_ENABLE (0u)
+#endif
+
+/* Run the FPU datapath known-answer test after the FPU register test */
+#define FPU_DATAPATH_TEST_ENABLE (0u)
+
+/* Run the core-local tests on both CM7 cores of XMC7200 concurrently
+ * (see dual_core.h). CM7_1 runs an image that calls
+ * Dual_Core_Secondary_Main() */
+#define DUAL_CORE_TEST_ENABLE (0u)
+
+/* Enable the signature based program flow monitor (see flow_monitor.h) and
+ * its checkpoints in main() */
+#define FLOW_MONITOR_ENABLE (0u)
+
+/* XMC7000: check the SRAM and flash with their ECC instead of the March tests
+ * (see ecc_test.h): error injection, then a read-through scrub of the SRAM */
+#define ECC_TEST_ENABLE (0u)
+
+/* Run the flash, SRAM and clock tests in short wake windows after the boot
+ * tests, with the device in Deep Sleep in between (see low_power.h) */
+#define LOW_POWER_TEST_ENABLE (0u)
+
+/* Adapt the periods of the low power tests between their bounds to the
+ * correctable ECC errors, the clock deviation, the interrupt margin and the
+ * test retries (see test_rate.h). Needs LOW_POWER_TEST_ENABLE */
+#define TEST_RATE_ENABLE (0u)
+
+/* Check the regions of flash_regions.h (application code, CM0+ image,
+ * supervisory flash) each against its own reference checksum and deadline,
+ * instead of the single range of the SelfTest flash test. Can be set from
+ * the build */
+#ifndef FLASH_REGIONS_ENABLE
+#define FLASH_REGIONS_ENABLE (0u)
+#endif
+
+/* Measure the FLL, PLL, CLK_HF and peripheral divider clocks against the ILO
+ * or the WCO after the clock test (see clock_monitor.h) */
+#define CLOCK_MONITOR_ENABLE (0u)
+
+/* Fast boot profile (see fast_boot.h): only the start-up, program counter,
+ * CPU register and stack tests run before the application, the other tests
+ * run in slices between its control cycles. Can be set from the build */
+#ifndef FAST_BOOT_ENABLE
+#define FAST_BOOT_ENABLE (0u)
+#endif
+
+/* Read the free running DWT cycle counter started by Cycle_Counter_Init() */
+#define CYCLE_COUNTER_GET() (DWT->CYCCNT)
+
+/* Called from the idle loop of main(). The host build (host/Makefile) ends
+ * the simulated run here */
+#ifndef SELF_TEST_IDLE
+#define SELF_TEST_IDLE()
+#endif
+
+/* Called at the first control cycle of the application in the fast boot
+ * profile. The host build records the time to the first control cycle */
+#ifndef SELF_TEST_APP_START
+#define SELF_TEST_APP_START()
+#endif
+
 
 #define PATTERN_BLOCK_SIZE (8u)
 
+/* Use an MPU no-access region at the stack limit instead of the pattern
+ * based stack overflow check */
+#define MPU_STACK_GUARD_ENABLE (0u)
+
+/* Size of the no-access MPU region at the stack limit, a power of two of at
+ * least 32 bytes. A function frame or an exception frame larger than the
+ * region can step over it, so it covers the FPU exception frame (104 bytes)
+ * and the local buffers of the self tests */
+#ifndef MPU_GUARD_STACK_REGION_BYTES
+#define MPU_GUARD_STACK_REGION_BYTES (256u)
+#endif
+
+/* Bytes at the stack limit owned by the stack overflow test: the pattern
+ * block, or the MPU region plus its alignment slack */
+#if MPU_STACK_GUARD_ENABLE
+#define STACK_GUARD_SIZE (2u * MPU_GUARD_STACK_REGION_BYTES)
+#else
+#define STACK_GUARD_SIZE (PATTERN_BLOCK_SIZE)
+#endif
+
 /*******************************************************************************
 * Function Prototypes
 *******************************************************************************/
@@ -114,6 +243,8 @@ void Clock_Test_Init(void);
 void Interrupt_Test(void);
 void Interrupt_Test_Init(void);
 void Flash_Test(void);
+void Flash_Test_Init(void);
+uint8_t Flash_Step(bool first, uint32_t now_ms);
 void Wdt_Test(void);
 void FPU_Test(void);
 #if (!defined(CY_DEVICE_PSOC6ABLE2)&& !defined (CY_DEVICE_SECURE))
@@ -122,10 +253,37 @@ void FPU_Test(void);
 #if !defined (CY_DEVICE_SECURE)
     void DMA_DW_Test(void);
 #endif
+uint8_t Start_Up_Check(void);
 void Start_Up_Test(void);
 void Stack_March_Test(void);
+uint8_t Stack_March_Step(bool first);
 void SRAM_March_Test(void);
+uint8_t Sram_March_Step(bool first);
+#if (SRAM_DMA_TEST_ENABLE && !defined (CY_DEVICE_SECURE))
+    void SRAM_Dma_Test(void);
+#endif
 void Stack_Memory_Test(void);
+#if MPU_STACK_GUARD_ENABLE
+    void Stack_Guard_Fault_Report(uint8_t status, uint32_t address);
+#endif
+void Cycle_Counter_Init(void);
+uint8_t Run_Time_Check(void);
+#if (DUAL_CORE_TEST_ENABLE && COMPONENT_CAT1C && !DUAL_CORE_SECONDARY)
+    void Dual_Core_Test(void);
+#endif
+#if (ECC_TEST_ENABLE && COMPONENT_CAT1C)
+    void Ecc_Test(void);
+#endif
+#if CLOCK_MONITOR_ENABLE
+    void Clock_Monitor_Test(void);
+#endif
+#if DIAG_LOG_ENABLE
+    void Diag_Log_Result(uint32_t index, uint8_t status);
+    void Diag_Log_Fault(uint32_t index, uint8_t kind, uint32_t detail);
+#endif
+#if STACK_PROFILER_ENABLE
+    void Stack_Profiler_Phase_End(const char *name);
+#endif
 
 #endif /* SELF_TEST_H_ */
 
@@ -0,0 +1,493 @@
+/******************************************************************************
+* File Name:   sram_dma_test.c
+*
+* Description: This file provides a DMA accelerated SRAM test. Each block runs
+*              March C- on two data backgrounds: the DW channel of the DMA DW
+*              self test does the initial fill, the CPU the read and write
+*              elements, and the final read is a DW CRC transfer where the
+*              hardware supports it, otherwise CPU reads. Block contents are
+*              saved and restored, so the test runs on live data and bss sections.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include <string.h>
+
+#include "sram_dma_test.h"
+
+#if (SRAM_DMA_TEST_ENABLE && DMA_TRANSFER_DW_AVAILABLE)
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SRAM_DMA_TEST_BLOCK_BYTES   (SRAM_DMA_TEST_BLOCK_WORDS * sizeof(uint32_t))
+#define SRAM_DMA_TEST_NUM_BACKGROUNDS (sizeof(sram_dma_backgrounds) / sizeof(sram_dma_backgrounds[0]))
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* March C- data backgrounds, each also runs inverted. The DW reads them from
+ * flash with a fixed source address */
+static const uint32_t sram_dma_backgrounds[] =
+{
+    0x00000000UL, 0x55555555UL
+};
+
+/* All mutable state of the test. Blocks that overlap it are tested by the CPU */
+static struct
+{
+    uint32_t save[SRAM_DMA_TEST_BLOCK_WORDS];          /* Block contents under test */
+    uint32_t addr_pattern[SRAM_DMA_TEST_BLOCK_WORDS];  /* Unique word per block offset */
+#if DMA_TRANSFER_CRC_AVAILABLE
+    uint32_t background_crc[sizeof(sram_dma_backgrounds) / sizeof(sram_dma_backgrounds[0])];
+    uint32_t addr_pattern_crc;
+#endif
+    uintptr_t next;
+    uintptr_t error_address;
+} sram_dma_ctx;
+
+/*****************************************************************************
+* Function Name: Sram_Dma_Check
+******************************************************************************
+* Summary:
+* Verifies a block against a reference. With the DW CRC available, the CRC
+* of the block is compared with the CRC of the reference, both calculated by
+* the DW. Otherwise the CPU compares the words.
+*
+* Parameters:
+*  block      - Block under test
+*  words      - Number of words in the block
+*  ref        - Reference words
+*  ref_fixed  - true: every block word is compared with ref[0]
+*  ref_crc    - Pointer to the precalculated CRC of a full block of the
+*               reference, or NULL to calculate it
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+static uint8_t Sram_Dma_Check(const uint32_t *block, uint32_t words, const uint32_t *ref,
+                              bool ref_fixed, const uint32_t *ref_crc)
+{
+#if DMA_TRANSFER_CRC_AVAILABLE
+    uint32_t block_crc;
+    uint32_t expected_crc;
+
+    if (OK_STATUS != Dma_Transfer_Crc(block, words, false, SRAM_DMA_TEST_TIMEOUT_CYCLES, &block_crc))
+    {
+        return ERROR_STATUS;
+    }
+    if ((NULL != ref_crc) && (SRAM_DMA_TEST_BLOCK_WORDS == words))
+    {
+        expected_crc = *ref_crc;
+    }
+    else if (OK_STATUS != Dma_Transfer_Crc(ref, words, ref_fixed, SRAM_DMA_TEST_TIMEOUT_CYCLES,
+                                           &expected_crc))
+    {
+        return ERROR_STATUS;
+    }
+    if (block_crc != expected_crc)
+    {
+        sram_dma_ctx.error_address = (uintptr_t)block;
+        return ERROR_STATUS;
+    }
+#else
+    (void)ref_crc;
+    for (uint32_t i = 0u; i < words; i++)
+    {
+        if (block[i] != ref[ref_fixed ? 0u : i])
+        {
+            sram_dma_ctx.error_address = (uintptr_t)&block[i];
+            return ERROR_STATUS;
+        }
+    }
+#endif
+
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Sram_Dma_Copy
+******************************************************************************
+* Summary:
+* Copies words with the DW channel.
+*
+* Parameters:
+*  dst       - Destination
+*  src       - Source
+*  words     - Number of words
+*  src_fixed - true: fill dst with src[0]
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+static uint8_t Sram_Dma_Copy(uint32_t *dst, const uint32_t *src, uint32_t words, bool src_fixed)
+{
+    const dma_transfer_segment_t segment =
+    {
+        .src = src,
+        .dst = dst,
+        .count = words,
+        .width = (uint8_t)sizeof(uint32_t),
+        .src_fixed = src_fixed,
+    };
+
+    return Dma_Transfer_Run(DMA_TRANSFER_ENGINE_DW, &segment, 1u, SRAM_DMA_TEST_TIMEOUT_CYCLES);
+}
+
+/*****************************************************************************
+* Function Name: Sram_Dma_March_Elements
+******************************************************************************
+* Summary:
+* Runs the read and write elements of March C- on words holding a
+* background: up: r b, w ~b; up: r ~b, w b; down: r b, w ~b;
+* down: r ~b, w b. The initial write and the final read of the background
+* are done by the caller.
+*
+* Parameters:
+*  cells      - Words under test
+*  count      - Number of words
+*  background - Data background
+*
+* Return:
+*  Address of the first failing word, 0 if no error was detected
+*****************************************************************************/
+static uintptr_t Sram_Dma_March_Elements(volatile uint32_t *cells, uint32_t count, uint32_t background)
+{
+    const uint32_t inverse = ~background;
+    uintptr_t error_address = 0u;
+    uint32_t i;
+
+    for (i = 0u; (i < count) && (0u == error_address); i++)
+    {
+        error_address = (background != cells[i]) ? (uintptr_t)&cells[i] : 0u;
+        cells[i] = inverse;
+    }
+    for (i = 0u; (i < count) && (0u == error_address); i++)
+    {
+        error_address = (inverse != cells[i]) ? (uintptr_t)&cells[i] : 0u;
+        cells[i] = background;
+    }
+    for (i = count; (i > 0u) && (0u == error_address); i--)
+    {
+        error_address = (background != cells[i - 1u]) ? (uintptr_t)&cells[i - 1u] : 0u;
+        cells[i - 1u] = inverse;
+    }
+    for (i = count; (i > 0u) && (0u == error_address); i--)
+    {
+        error_address = (inverse != cells[i - 1u]) ? (uintptr_t)&cells[i - 1u] : 0u;
+        cells[i - 1u] = background;
+    }
+    return error_address;
+}
+
+/*****************************************************************************
+* Function Name: Sram_Dma_Test_Block
+******************************************************************************
+* Summary:
+* Tests one block with interrupts disabled: saves it, runs March C- on
+* every background (DW fill, CPU read and write elements, DW CRC or CPU
+* final read), writes and verifies the address pattern, then restores the
+* saved contents.
+*
+* Parameters:
+*  block - Block under test
+*  words - Number of words in the block
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+static uint8_t Sram_Dma_Test_Block(uint32_t *block, uint32_t words)
+{
+    uint8_t status;
+    uint32_t interrupt_state;
+    const uint32_t *pattern_crc = NULL;
+    uintptr_t error_address;
+
+    interrupt_state = Cy_SysLib_EnterCriticalSection();
+
+    status = Sram_Dma_Copy(sram_dma_ctx.save, block, words, false);
+    if (OK_STATUS == status)
+    {
+        status = Sram_Dma_Check(block, words, sram_dma_ctx.save, false, NULL);
+    }
+    if (OK_STATUS != status)
+    {
+        /* Block is unchanged, nothing to restore */
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+        return status;
+    }
+
+    for (uint32_t b = 0u; (b < SRAM_DMA_TEST_NUM_BACKGROUNDS) && (OK_STATUS == status); b++)
+    {
+#if DMA_TRANSFER_CRC_AVAILABLE
+        pattern_crc = &sram_dma_ctx.background_crc[b];
+#endif
+        status = Sram_Dma_Copy(block, &sram_dma_backgrounds[b], words, true);
+        if (OK_STATUS == status)
+        {
+            error_address = Sram_Dma_March_Elements(block, words, sram_dma_backgrounds[b]);
+            if (0u != error_address)
+            {
+                sram_dma_ctx.error_address = error_address;
+                status = ERROR_STATUS;
+            }
+        }
+        if (OK_STATUS == status)
+        {
+            status = Sram_Dma_Check(block, words, &sram_dma_backgrounds[b], true, pattern_crc);
+        }
+    }
+
+    if (OK_STATUS == status)
+    {
+#if DMA_TRANSFER_CRC_AVAILABLE
+        pattern_crc = &sram_dma_ctx.addr_pattern_crc;
+#endif
+        status = Sram_Dma_Copy(block, sram_dma_ctx.addr_pattern, words, false);
+        if (OK_STATUS == status)
+        {
+            status = Sram_Dma_Check(block, words, sram_dma_ctx.addr_pattern, false, pattern_crc);
+        }
+    }
+
+    /* Always restore the block contents. Dma_Transfer_Wait() has disabled a
+     * channel that timed out; the CPU restores the block if the DW cannot */
+    if (OK_STATUS != Sram_Dma_Copy(block, sram_dma_ctx.save, words, false))
+    {
+        memcpy(block, sram_dma_ctx.save, words * sizeof(uint32_t));
+        status = ERROR_STATUS;
+    }
+    else if (0 != memcmp(block, sram_dma_ctx.save, words * sizeof(uint32_t)))
+    {
+        status = ERROR_STATUS;
+    }
+
+    Cy_SysLib_ExitCriticalSection(interrupt_state);
+
+    return status;
+}
+
+/*****************************************************************************
+* Function Name: Sram_Dma_Cpu_March
+******************************************************************************
+* Summary:
+* Tests a block with March C-, run by the CPU on SRAM_DMA_TEST_CPU_WORDS
+* words at a time with interrupts disabled. Used for the blocks that hold
+* the state of this test or the DMA descriptors: the words under test are
+* saved on the stack, which is outside of the tested region, and nothing
+* else of the block is accessed until they are restored.
+*
+* Parameters:
+*  block - Block under test
+*  words - Number of words in the block
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+static uint8_t Sram_Dma_Cpu_March(uint32_t *block, uint32_t words)
+{
+    uint32_t save[SRAM_DMA_TEST_CPU_WORDS];
+    uintptr_t error_address = 0u;
+    uint32_t interrupt_state;
+
+    for (uint32_t base = 0u; (base < words) && (0u == error_address); base += SRAM_DMA_TEST_CPU_WORDS)
+    {
+        volatile uint32_t *chunk = &block[base];
+        uint32_t count = ((words - base) < SRAM_DMA_TEST_CPU_WORDS) ? (words - base) :
+                         SRAM_DMA_TEST_CPU_WORDS;
+        uint32_t i;
+
+        interrupt_state = Cy_SysLib_EnterCriticalSection();
+        for (i = 0u; i < count; i++)
+        {
+            save[i] = chunk[i];
+        }
+        /* Up: w0; the read and write elements; down: r0 */
+        for (i = 0u; i < count; i++)
+        {
+            chunk[i] = 0u;
+        }
+        error_address = Sram_Dma_March_Elements(chunk, count, 0u);
+        for (i = count; (i > 0u) && (0u == error_address); i--)
+        {
+            error_address = (0u != chunk[i - 1u]) ? (uintptr_t)&chunk[i - 1u] : 0u;
+        }
+        for (i = 0u; i < count; i++)
+        {
+            chunk[i] = save[i];
+        }
+        Cy_SysLib_ExitCriticalSection(interrupt_state);
+    }
+
+    if (0u != error_address)
+    {
+        sram_dma_ctx.error_address = error_address;
+        return ERROR_STATUS;
+    }
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Sram_Dma_Test_Init
+******************************************************************************
+* Summary:
+* Initializes the DMA SRAM test: builds the address pattern and, when the
+* DW CRC is available, precalculates the CRC of a full block of every
+* background. Requires Cycle_Counter_Init() to have been called.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  OK_STATUS or ERROR_STATUS
+*****************************************************************************/
+uint8_t Sram_Dma_Test_Init(void)
+{
+    uint32_t i;
+
+    for (i = 0u; i < SRAM_DMA_TEST_BLOCK_WORDS; i++)
+    {
+        sram_dma_ctx.addr_pattern[i] = (i << 16u) | (~i & 0xFFFFUL);
+    }
+    sram_dma_ctx.next = (SRAM_DMA_TEST_START + 3u) & ~(uintptr_t)3u;
+    sram_dma_ctx.error_address = 0u;
+
+#if DMA_TRANSFER_CRC_AVAILABLE
+    for (i = 0u; i < SRAM_DMA_TEST_NUM_BACKGROUNDS; i++)
+    {
+        if (OK_STATUS != Dma_Transfer_Crc(&sram_dma_backgrounds[i], SRAM_DMA_TEST_BLOCK_WORDS, true,
+                                          SRAM_DMA_TEST_TIMEOUT_CYCLES, &sram_dma_ctx.background_crc[i]))
+        {
+            return ERROR_STATUS;
+        }
+        /* A CRC unit that does not depend on the data would hide every fault */
+        if ((0u != i) && (sram_dma_ctx.background_crc[i] == sram_dma_ctx.background_crc[i - 1u]))
+        {
+            return ERROR_STATUS;
+        }
+    }
+    if (OK_STATUS != Dma_Transfer_Crc(sram_dma_ctx.addr_pattern, SRAM_DMA_TEST_BLOCK_WORDS, false,
+                                      SRAM_DMA_TEST_TIMEOUT_CYCLES, &sram_dma_ctx.addr_pattern_crc))
+    {
+        return ERROR_STATUS;
+    }
+#endif
+
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Sram_Dma_Test_Step
+******************************************************************************
+* Summary:
+* Tests the next SRAM_DMA_TEST_BLOCKS_PER_STEP blocks of the region. Blocks
+* that overlap the state of this test or the DMA descriptors are tested by
+* the CPU, the DW cannot move them while it uses them.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS when the whole region has
+*  been tested (the next call starts over) or ERROR_STATUS
+*****************************************************************************/
+uint8_t Sram_Dma_Test_Step(void)
+{
+    const uintptr_t ctx_start = (uintptr_t)&sram_dma_ctx;
+    const uintptr_t ctx_end = ctx_start + sizeof(sram_dma_ctx);
+    const uintptr_t region_end = SRAM_DMA_TEST_END & ~(uintptr_t)3u;
+    uint8_t status;
+
+    for (uint8_t n = 0u; n < SRAM_DMA_TEST_BLOCKS_PER_STEP; n++)
+    {
+        uintptr_t start = sram_dma_ctx.next;
+        uintptr_t end = start + SRAM_DMA_TEST_BLOCK_BYTES;
+
+        if (start >= region_end)
+        {
+            sram_dma_ctx.next = (SRAM_DMA_TEST_START + 3u) & ~(uintptr_t)3u;
+            return PASS_COMPLETE_STATUS;
+        }
+        if (end > region_end)
+        {
+            end = region_end;
+        }
+
+        if (((start < ctx_end) && (end > ctx_start)) || Dma_Transfer_Overlaps(start, end))
+        {
+            status = Sram_Dma_Cpu_March((uint32_t *)start, (end - start) / sizeof(uint32_t));
+        }
+        else
+        {
+            status = Sram_Dma_Test_Block((uint32_t *)start, (end - start) / sizeof(uint32_t));
+        }
+        if (OK_STATUS != status)
+        {
+            if (0u == sram_dma_ctx.error_address)
+            {
+                sram_dma_ctx.error_address = start;
+            }
+            return ERROR_STATUS;
+        }
+
+        sram_dma_ctx.next = end;
+    }
+
+    return PASS_STILL_TESTING_STATUS;
+}
+
+/*****************************************************************************
+* Function Name: Sram_Dma_Test_Get_Error_Address
+******************************************************************************
+* Summary:
+* Returns the failing address: the word address when the CPU verifies, the
+* block address when the DW CRC verifies.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  Failing address, 0 if no error was detected
+*****************************************************************************/
+uintptr_t Sram_Dma_Test_Get_Error_Address(void)
+{
+    return sram_dma_ctx.error_address;
+}
+#endif /* (SRAM_DMA_TEST_ENABLE && DMA_TRANSFER_DW_AVAILABLE) */
+
+/* [] END OF FILE */
@@ -0,0 +1,88 @@
+/******************************************************************************
+* File Name:   sram_dma_test.h
+*
+* Description: This file is the public interface of sram_dma_test.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef SRAM_DMA_TEST_H_
+#define SRAM_DMA_TEST_H_
+
+#include "dma_transfer.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Tested SRAM region: data, bss and heap sections (the stack is excluded) */
+#define SRAM_DMA_TEST_START             ((uintptr_t)__data_start__)
+#define SRAM_DMA_TEST_END               ((uintptr_t)__HeapLimit)
+
+/* Block size in words. A block is one DW 1D descriptor (max 256 elements) */
+#define SRAM_DMA_TEST_BLOCK_WORDS       (DMA_TRANSFER_DW_X_COUNT_MAX)
+
+/* Number of blocks tested per call of Sram_Dma_Test_Step() */
+#define SRAM_DMA_TEST_BLOCKS_PER_STEP   (4u)
+
+/* Blocks that hold the state of this test or the DMA descriptors are tested
+ * by the CPU with March C-, this many words at a time */
+#define SRAM_DMA_TEST_CPU_WORDS         (16u)
+
+/* Timeout of one DMA transfer, in CPU cycles */
+#define SRAM_DMA_TEST_TIMEOUT_CYCLES    (100000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Linker script symbols */
+extern uint32_t __data_start__[];
+extern uint32_t __HeapLimit[];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t Sram_Dma_Test_Init(void);
+uint8_t Sram_Dma_Test_Step(void);
+uintptr_t Sram_Dma_Test_Get_Error_Address(void);
+
+#endif /* SRAM_DMA_TEST_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,310 @@
+/******************************************************************************
+* File Name:   stack_profiler.c
+*
+* Description: This file provides a stack usage profiler. The unused stack is
+*              painted with a known value, and the lowest overwritten word (the
+*              high-water mark) is found by an incremental scan that can run in
+*              background slices. Peak usage is reported per test phase and as a
+*              history over time.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cyhal.h"
+#include "cybsp.h"
+#include <string.h>
+
+#include "stack_profiler.h"
+
+#if STACK_PROFILER_ENABLE
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static struct
+{
+    uint32_t *base;         /* Lowest painted word, above the overflow guard */
+    uint32_t *top;          /* Stack top */
+    uint32_t *hwm;          /* Lowest word known to be used */
+    uint32_t *scan;         /* Next word checked by the incremental scan */
+    uint32_t peak_bytes;    /* Peak usage since Stack_Profiler_Init() */
+    uint8_t history_next;
+    uint8_t history_count;
+    stack_profiler_phase_t phases[STACK_PROFILER_MAX_PHASES];
+    stack_profiler_sample_t history[STACK_PROFILER_HISTORY_SIZE];
+} stack_prof;
+
+/*****************************************************************************
+* Function Name: Stack_Profiler_Paint
+******************************************************************************
+* Summary:
+* Paints the unused stack from the base up to STACK_PROFILER_SP_MARGIN bytes
+* below the current stack pointer, and restarts the high-water-mark search.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+static void Stack_Profiler_Paint(void)
+{
+    uint32_t *limit = (uint32_t *)((__get_MSP() - STACK_PROFILER_SP_MARGIN) & ~3UL);
+    uint32_t *word;
+
+    for (word = stack_prof.base; word < limit; word++)
+    {
+        *word = STACK_PROFILER_PAINT;
+    }
+    stack_prof.hwm = limit;
+    stack_prof.scan = stack_prof.base;
+}
+
+/*****************************************************************************
+* Function Name: Stack_Profiler_Init
+******************************************************************************
+* Summary:
+* Paints the unused stack and clears the phase table and the history.
+* The guard block of SelfTests_Init_Stack_Test() at the stack limit is not
+* painted, so it can be called before or after the stack test.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Stack_Profiler_Init(void)
+{
+    stack_prof.base = (uint32_t *)(((uintptr_t)__StackLimit + STACK_PROFILER_GUARD_SIZE + 3u) & ~(uintptr_t)3u);
+    stack_prof.top = __StackTop;
+    stack_prof.peak_bytes = 0u;
+    stack_prof.history_next = 0u;
+    stack_prof.history_count = 0u;
+    for (uint8_t i = 0u; i < STACK_PROFILER_MAX_PHASES; i++)
+    {
+        stack_prof.phases[i].name = NULL;
+        stack_prof.phases[i].peak_bytes = 0u;
+    }
+
+    Stack_Profiler_Paint();
+}
+
+/*****************************************************************************
+* Function Name: Stack_Profiler_Scan_Slice
+******************************************************************************
+* Summary:
+* Checks up to the given number of painted words, starting at the stack base.
+* The first overwritten word found is the new high-water mark and the scan
+* restarts from the base. A pass ends when the scan reaches the high-water
+* mark; since the stack only grows into the painted area, no word below the
+* mark has been touched at that point.
+*
+* Parameters:
+*  words - Maximum number of words to check in this call
+*
+* Return:
+*  true when a scan pass has completed
+*****************************************************************************/
+bool Stack_Profiler_Scan_Slice(uint32_t words)
+{
+    while ((words > 0u) && (stack_prof.scan < stack_prof.hwm))
+    {
+        if (STACK_PROFILER_PAINT != *stack_prof.scan)
+        {
+            stack_prof.hwm = stack_prof.scan;
+            stack_prof.scan = stack_prof.base;
+            break;
+        }
+        stack_prof.scan++;
+        words--;
+    }
+
+    if (((uint32_t)((uintptr_t)stack_prof.top - (uintptr_t)stack_prof.hwm)) > stack_prof.peak_bytes)
+    {
+        stack_prof.peak_bytes = (uint32_t)((uintptr_t)stack_prof.top - (uintptr_t)stack_prof.hwm);
+    }
+
+    if (stack_prof.scan >= stack_prof.hwm)
+    {
+        stack_prof.scan = stack_prof.base;
+        return true;
+    }
+
+    return false;
+}
+
+/*****************************************************************************
+* Function Name: Stack_Profiler_Check
+******************************************************************************
+* Summary:
+* Runs scan slices until a pass completes.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  Stack usage in bytes at the current high-water mark
+*****************************************************************************/
+uint32_t Stack_Profiler_Check(void)
+{
+    while (!Stack_Profiler_Scan_Slice(STACK_PROFILER_SLICE_WORDS))
+    {
+        /* Next slice */
+    }
+
+    return (uint32_t)((uintptr_t)stack_prof.top - (uintptr_t)stack_prof.hwm);
+}
+
+/*****************************************************************************
+* Function Name: Stack_Profiler_Sample
+******************************************************************************
+* Summary:
+* Adds the peak usage found so far to the history, the oldest sample is
+* replaced when the history is full.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Stack_Profiler_Sample(void)
+{
+    stack_prof.history[stack_prof.history_next].timestamp = CYCLE_COUNTER_GET();
+    stack_prof.history[stack_prof.history_next].peak_bytes = stack_prof.peak_bytes;
+    stack_prof.history_next = (uint8_t)((stack_prof.history_next + 1u) % STACK_PROFILER_HISTORY_SIZE);
+    if (stack_prof.history_count < STACK_PROFILER_HISTORY_SIZE)
+    {
+        stack_prof.history_count++;
+    }
+}
+
+/*****************************************************************************
+* Function Name: Stack_Profiler_Phase_End
+******************************************************************************
+* Summary:
+* Records the peak usage since the last phase end under the given phase name,
+* adds a sample to the history and repaints the stack for the next phase.
+* Phases with the same name are merged.
+*
+* Parameters:
+*  name - Phase name (the test name); the pointer is stored
+*
+* Return:
+*  void
+*****************************************************************************/
+void Stack_Profiler_Phase_End(const char *name)
+{
+    uint32_t usage = Stack_Profiler_Check();
+    uint8_t i;
+
+    for (i = 0u; i < STACK_PROFILER_MAX_PHASES; i++)
+    {
+        if ((NULL == stack_prof.phases[i].name) || (0 == strcmp(stack_prof.phases[i].name, name)))
+        {
+            stack_prof.phases[i].name = name;
+            if (usage > stack_prof.phases[i].peak_bytes)
+            {
+                stack_prof.phases[i].peak_bytes = usage;
+            }
+            break;
+        }
+    }
+
+    Stack_Profiler_Sample();
+    Stack_Profiler_Paint();
+}
+
+/*****************************************************************************
+* Function Name: Stack_Profiler_Get_Peak
+******************************************************************************
+* Summary:
+* Returns the peak stack usage found so far by the scans.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  Peak stack usage in bytes
+*****************************************************************************/
+uint32_t Stack_Profiler_Get_Peak(void)
+{
+    return stack_prof.peak_bytes;
+}
+
+/*****************************************************************************
+* Function Name: Stack_Profiler_Report
+******************************************************************************
+* Summary:
+* Prints the peak stack usage per phase, the usage history and the overall
+* peak compared with the stack size.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*****************************************************************************/
+void Stack_Profiler_Report(void)
+{
+    uint32_t stack_size = (uint32_t)((uintptr_t)__StackTop - (uintptr_t)__StackLimit);
+    uint8_t i;
+
+    (void)Stack_Profiler_Check();
+
+    printf("\r\nStack usage per test (bytes):\r\n");
+    for (i = 0u; (i < STACK_PROFILER_MAX_PHASES) && (NULL != stack_prof.phases[i].name); i++)
+    {
+        printf("  %-32s %5lu\r\n", stack_prof.phases[i].name,
+               (unsigned long)stack_prof.phases[i].peak_bytes);
+    }
+
+    printf("Stack usage history (cycle counter, peak bytes):\r\n");
+    for (i = 0u; i < stack_prof.history_count; i++)
+    {
+        uint8_t idx = (uint8_t)((stack_prof.history_next + STACK_PROFILER_HISTORY_SIZE -
+                                 stack_prof.history_count + i) % STACK_PROFILER_HISTORY_SIZE);
+        printf("  %10lu %5lu\r\n", (unsigned long)stack_prof.history[idx].timestamp,
+               (unsigned long)stack_prof.history[idx].peak_bytes);
+    }
+
+    printf("Stack peak usage %lu of %lu bytes\r\n", (unsigned long)stack_prof.peak_bytes,
+           (unsigned long)stack_size);
+}
+#endif /* STACK_PROFILER_ENABLE */
+
+/* [] END OF FILE */
@@ -0,0 +1,104 @@
+/******************************************************************************
+* File Name:   stack_profiler.h
+*
+* Description: This file is the public interface of stack_profiler.c source file.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef STACK_PROFILER_H_
+#define STACK_PROFILER_H_
+
+#include "self_test.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Value painted into the unused stack */
+#define STACK_PROFILER_PAINT            (0xA5C3A5C3UL)
+
+/* Bytes at the stack limit reserved for the stack overflow test */
+#define STACK_PROFILER_GUARD_SIZE       (STACK_GUARD_SIZE)
+
+/* Bytes below the current stack pointer left unpainted when repainting */
+#define STACK_PROFILER_SP_MARGIN        (64u)
+
+/* Maximum number of phases (tests) that are reported separately */
+#define STACK_PROFILER_MAX_PHASES       (24u)
+
+/* Number of high-water-mark samples kept in the usage history */
+#define STACK_PROFILER_HISTORY_SIZE     (16u)
+
+/* Number of words checked by one call of Stack_Profiler_Scan_Slice() from
+ * Stack_Profiler_Check() and Run_Time_Check() */
+#define STACK_PROFILER_SLICE_WORDS      (64u)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Peak stack usage of one phase */
+typedef struct
+{
+    const char *name;       /* Phase name, NULL for unused entries */
+    uint32_t peak_bytes;    /* Peak usage seen in the phase */
+} stack_profiler_phase_t;
+
+/* High-water-mark sample */
+typedef struct
+{
+    uint32_t timestamp;     /* CYCLE_COUNTER_GET() when the sample was taken */
+    uint32_t peak_bytes;    /* Peak usage since Stack_Profiler_Init() */
+} stack_profiler_sample_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void Stack_Profiler_Init(void);
+bool Stack_Profiler_Scan_Slice(uint32_t words);
+uint32_t Stack_Profiler_Check(void);
+void Stack_Profiler_Sample(void);
+void Stack_Profiler_Phase_End(const char *name);
+uint32_t Stack_Profiler_Get_Peak(void);
+void Stack_Profiler_Report(void);
+
+#endif /* STACK_PROFILER_H_ */
+
+
+/* [] END OF FILE */
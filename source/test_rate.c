@@ -0,0 +1,317 @@
+/******************************************************************************
+* File Name:   test_rate.c
+*
+* Description: This file contains the adaptive test rate controller. It sets the
+*              period of each test between its bounds from the signals the test follows:
+*              the periods shrink while a signal is suspect and grow back slowly while the
+*              signals are healthy.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "test_rate.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of signals, one bit each in TEST_RATE_SIGNAL_ALL */
+#define TEST_RATE_SIGNALS               (4u)
+
+/*****************************************************************************
+* Function Name: Test_Rate_Level
+******************************************************************************
+* Summary:
+* Returns the level of a signal latched in the suspect state: it becomes
+* suspect when enter is true and healthy again when leave is true, which
+* keeps a signal close to one threshold from toggling the periods.
+*
+* Parameters:
+*  rate:   Controller
+*  signal: TEST_RATE_SIGNAL_xx
+*  enter:  The signal is past its enter threshold
+*  leave:  The signal is back within its exit threshold
+*
+* Return:
+*  uint8_t: TEST_RATE_HEALTHY or TEST_RATE_SUSPECT
+*****************************************************************************/
+static uint8_t Test_Rate_Level(test_rate_t *rate, uint8_t signal, bool enter, bool leave)
+{
+    if (0u != (rate->suspect & signal))
+    {
+        if (leave)
+        {
+            rate->suspect &= (uint8_t)~signal;
+        }
+    }
+    else if (enter)
+    {
+        rate->suspect |= signal;
+    }
+    return (0u != (rate->suspect & signal)) ? TEST_RATE_SUSPECT : TEST_RATE_HEALTHY;
+}
+
+/*****************************************************************************
+* Function Name: Test_Rate_Abs_Ppm
+******************************************************************************
+* Summary:
+* Absolute value of a clock deviation, saturated at INT32_MAX so that
+* INT32_MIN does not overflow.
+*
+* Parameters:
+*  deviation_ppm: Signed deviation of a clock
+*
+* Return:
+*  int32_t: Absolute deviation
+*****************************************************************************/
+static int32_t Test_Rate_Abs_Ppm(int32_t deviation_ppm)
+{
+    return (deviation_ppm < -INT32_MAX) ? INT32_MAX :
+           ((deviation_ppm < 0) ? -deviation_ppm : deviation_ppm);
+}
+
+/*****************************************************************************
+* Function Name: Test_Rate_Clock_Level
+******************************************************************************
+* Summary:
+* Averages the clock deviation with a fast and a slow weight. The clock is
+* suspect while the fast average is high or rises above the slow one, and
+* an alarm when one measurement is past the alarm threshold.
+*
+* Parameters:
+*  rate:          Controller
+*  deviation_ppm: Largest deviation of the clocks
+*
+* Return:
+*  uint8_t: Level of the clock signal
+*****************************************************************************/
+static uint8_t Test_Rate_Clock_Level(test_rate_t *rate, int32_t deviation_ppm)
+{
+    const test_rate_config_t *config = rate->config;
+    int32_t deviation = Test_Rate_Abs_Ppm(deviation_ppm);
+    int32_t trend;
+    uint8_t level;
+
+    rate->clock_fast_ppm += (deviation - rate->clock_fast_ppm) / TEST_RATE_CLOCK_FAST_DIV;
+    rate->clock_slow_ppm += (deviation - rate->clock_slow_ppm) / TEST_RATE_CLOCK_SLOW_DIV;
+    trend = rate->clock_fast_ppm - rate->clock_slow_ppm;
+
+    level = Test_Rate_Level(rate, TEST_RATE_SIGNAL_CLOCK,
+                            (rate->clock_fast_ppm >= (int32_t)config->clock_enter_ppm) ||
+                            (trend >= (int32_t)config->clock_trend_ppm),
+                            (rate->clock_fast_ppm < (int32_t)config->clock_exit_ppm) &&
+                            (trend < (int32_t)(config->clock_trend_ppm / 2u)));
+    return ((uint32_t)deviation >= config->clock_alarm_ppm) ? TEST_RATE_ALARM : level;
+}
+
+/*****************************************************************************
+* Function Name: Test_Rate_Init
+******************************************************************************
+* Summary:
+* Starts every test at its minimum period: the tests run at the full rate
+* until the signals have been healthy for the hold time.
+*
+* Parameters:
+*  rate:    Controller
+*  config:  Configuration, at most TEST_RATE_MAX_TESTS tests
+*  signals: Current signals, the start of the counts and averages
+*
+* Return:
+*  void
+*****************************************************************************/
+void Test_Rate_Init(test_rate_t *rate, const test_rate_config_t *config,
+                    const test_rate_signals_t *signals)
+{
+    int32_t deviation = 0;
+
+    rate->config = config;
+    for (uint32_t test = 0u; test < config->test_count; test++)
+    {
+        rate->period_ms[test] = config->tests[test].min_period_ms;
+        rate->healthy[test] = 0u;
+    }
+    if (0u != (signals->valid & TEST_RATE_SIGNAL_CLOCK))
+    {
+        deviation = Test_Rate_Abs_Ppm(signals->clock_deviation_ppm);
+    }
+    rate->ecc_corrected = signals->ecc_corrected;
+    rate->retries = signals->retries;
+    rate->clock_fast_ppm = deviation;
+    rate->clock_slow_ppm = deviation;
+    rate->suspect = 0u;
+    rate->updates = 0u;
+    rate->decreases = 0u;
+    rate->increases = 0u;
+}
+
+/*****************************************************************************
+* Function Name: Test_Rate_Update
+******************************************************************************
+* Summary:
+* Updates the periods from the signals. Called at a fixed interval. A test
+* follows the highest level of its signals: an alarm sets its period to the
+* minimum, a suspect signal halves it, and after hold_updates healthy
+* updates it grows by 1/TEST_RATE_GROWTH_DIV, up to the maximum. The fast
+* decrease and slow increase keep the periods short while anomalies recur.
+*
+* Parameters:
+*  rate:    Controller
+*  signals: Signals since the last update
+*
+* Return:
+*  uint8_t: Signals that are suspect or an alarm, TEST_RATE_SIGNAL_xx
+*****************************************************************************/
+uint8_t Test_Rate_Update(test_rate_t *rate, const test_rate_signals_t *signals)
+{
+    const test_rate_config_t *config = rate->config;
+    uint8_t level[TEST_RATE_SIGNALS] = {TEST_RATE_HEALTHY};
+    uint8_t anomalies = 0u;
+
+    if (0u != (signals->valid & TEST_RATE_SIGNAL_ECC))
+    {
+        uint32_t corrected = signals->ecc_corrected - rate->ecc_corrected;
+
+        rate->ecc_corrected = signals->ecc_corrected;
+        level[0] = (corrected >= config->ecc_alarm) ? TEST_RATE_ALARM :
+                   ((0u != corrected) ? TEST_RATE_SUSPECT : TEST_RATE_HEALTHY);
+    }
+    if (0u != (signals->valid & TEST_RATE_SIGNAL_CLOCK))
+    {
+        level[1] = Test_Rate_Clock_Level(rate, signals->clock_deviation_ppm);
+    }
+    if (0u != (signals->valid & TEST_RATE_SIGNAL_IRQ))
+    {
+        level[2] = Test_Rate_Level(rate, TEST_RATE_SIGNAL_IRQ,
+                                   signals->irq_margin_permille < config->irq_enter_permille,
+                                   signals->irq_margin_permille >= config->irq_exit_permille);
+        level[2] = (signals->irq_margin_permille <= config->irq_alarm_permille) ? TEST_RATE_ALARM :
+                   level[2];
+    }
+    if (0u != (signals->valid & TEST_RATE_SIGNAL_RETRY))
+    {
+        level[3] = (signals->retries != rate->retries) ? TEST_RATE_ALARM : TEST_RATE_HEALTHY;
+        rate->retries = signals->retries;
+    }
+
+    for (uint32_t s = 0u; s < TEST_RATE_SIGNALS; s++)
+    {
+        anomalies |= (TEST_RATE_HEALTHY != level[s]) ? (uint8_t)(1u << s) : 0u;
+    }
+
+    for (uint32_t test = 0u; test < config->test_count; test++)
+    {
+        const test_rate_test_t *bounds = &config->tests[test];
+        uint32_t period = rate->period_ms[test];
+        uint8_t test_level = TEST_RATE_HEALTHY;
+
+        for (uint32_t s = 0u; s < TEST_RATE_SIGNALS; s++)
+        {
+            if ((0u != (bounds->signals & (1u << s))) && (level[s] > test_level))
+            {
+                test_level = level[s];
+            }
+        }
+
+        if (TEST_RATE_HEALTHY == test_level)
+        {
+            rate->healthy[test]++;
+            if ((rate->healthy[test] >= config->hold_updates) && (period < bounds->max_period_ms))
+            {
+                period += (period >= TEST_RATE_GROWTH_DIV) ? (period / TEST_RATE_GROWTH_DIV) : 1u;
+                period = (period > bounds->max_period_ms) ? bounds->max_period_ms : period;
+                rate->healthy[test] = 0u;
+                rate->increases++;
+            }
+        }
+        else
+        {
+            rate->healthy[test] = 0u;
+            period = (TEST_RATE_ALARM == test_level) ? bounds->min_period_ms : (period / 2u);
+            period = (period < bounds->min_period_ms) ? bounds->min_period_ms : period;
+            rate->decreases += (period != rate->period_ms[test]) ? 1u : 0u;
+        }
+        rate->period_ms[test] = period;
+    }
+
+    rate->updates++;
+    return anomalies;
+}
+
+/*****************************************************************************
+* Function Name: Test_Rate_Get_Period
+******************************************************************************
+* Summary:
+* Returns the current period of a test.
+*
+* Parameters:
+*  rate: Controller
+*  test: Test index
+*
+* Return:
+*  uint32_t: Period in ms
+*****************************************************************************/
+uint32_t Test_Rate_Get_Period(const test_rate_t *rate, uint32_t test)
+{
+    return rate->period_ms[test];
+}
+
+/*****************************************************************************
+* Function Name: Test_Rate_Load_Ppm
+******************************************************************************
+* Summary:
+* Returns the share of the CPU time the tests take at their current
+* periods.
+*
+* Parameters:
+*  rate:    Controller
+*  cost_us: Active time of one run of each test
+*
+* Return:
+*  uint32_t: Load in ppm
+*****************************************************************************/
+uint32_t Test_Rate_Load_Ppm(const test_rate_t *rate, const uint32_t *cost_us)
+{
+    uint64_t load = 0u;
+
+    for (uint32_t test = 0u; test < rate->config->test_count; test++)
+    {
+        load += ((uint64_t)cost_us[test] * 1000u) / rate->period_ms[test];
+    }
+    return (load > UINT32_MAX) ? UINT32_MAX : (uint32_t)load;
+}
+
+
+/* [] END OF FILE */
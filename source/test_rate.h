@@ -0,0 +1,148 @@
+/******************************************************************************
+* File Name:   test_rate.h
+*
+* Description: This file contains the declarations of the adaptive test rate
+*              controller. It does not depend on the PDL and is also built by the host
+*              model.
+*
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2024, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef TEST_RATE_H_
+#define TEST_RATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Maximum number of tests of a controller */
+#define TEST_RATE_MAX_TESTS             (8u)
+
+/* Signals, and the mask of the signals a test follows */
+#define TEST_RATE_SIGNAL_ECC            (1u << 0)   /* Correctable ECC errors */
+#define TEST_RATE_SIGNAL_CLOCK          (1u << 1)   /* Clock deviation and its trend */
+#define TEST_RATE_SIGNAL_IRQ            (1u << 2)   /* Margin of an interrupt count to its bounds */
+#define TEST_RATE_SIGNAL_RETRY          (1u << 3)   /* Test failed, then passed on a retry */
+#define TEST_RATE_SIGNAL_ALL            (0x0Fu)
+
+/* Levels of a signal: a suspect signal halves the periods of its tests at
+ * every update, an alarm sets them to their minimum */
+#define TEST_RATE_HEALTHY               (0u)
+#define TEST_RATE_SUSPECT               (1u)
+#define TEST_RATE_ALARM                 (2u)
+
+/* A period grows by 1/n after the hold time */
+#define TEST_RATE_GROWTH_DIV            (8u)
+
+/* Weights of the fast and slow averages of the clock deviation; their
+ * difference is the trend */
+#define TEST_RATE_CLOCK_FAST_DIV        (4)
+#define TEST_RATE_CLOCK_SLOW_DIV        (32)
+
+/*******************************************************************************
+* Data Types
+*******************************************************************************/
+/* Bounds of the period of a test, and the signals it follows */
+typedef struct
+{
+    uint32_t min_period_ms;
+    uint32_t max_period_ms;
+    uint8_t signals;                /* TEST_RATE_SIGNAL_xx */
+} test_rate_test_t;
+
+/* Controller configuration. A signal becomes suspect at its enter threshold
+ * and healthy again at its exit threshold */
+typedef struct
+{
+    const test_rate_test_t *tests;
+    uint32_t test_count;
+    uint32_t hold_updates;          /* Healthy updates before a period grows */
+    uint32_t ecc_alarm;             /* Corrected errors in one update that are an alarm */
+    uint32_t clock_enter_ppm;       /* Average deviation */
+    uint32_t clock_exit_ppm;
+    uint32_t clock_trend_ppm;       /* Rise of the fast average over the slow one */
+    uint32_t clock_alarm_ppm;       /* Deviation of one measurement */
+    uint16_t irq_enter_permille;    /* Remaining margin */
+    uint16_t irq_exit_permille;
+    uint16_t irq_alarm_permille;
+} test_rate_config_t;
+
+/* Signals of one update. The ECC and retry counts are totals since the
+ * start; the signals not set in valid are ignored */
+typedef struct
+{
+    uint8_t valid;                  /* TEST_RATE_SIGNAL_xx */
+    uint32_t ecc_corrected;
+    int32_t clock_deviation_ppm;    /* Largest deviation of the clocks */
+    uint16_t irq_margin_permille;
+    uint32_t retries;
+} test_rate_signals_t;
+
+/* Controller state */
+typedef struct
+{
+    const test_rate_config_t *config;
+    uint32_t period_ms[TEST_RATE_MAX_TESTS];
+    uint32_t healthy[TEST_RATE_MAX_TESTS];          /* Healthy updates since the last change */
+    uint32_t ecc_corrected;
+    uint32_t retries;
+    int32_t clock_fast_ppm;
+    int32_t clock_slow_ppm;
+    uint8_t suspect;                /* Signals in the suspect state */
+    uint32_t updates;
+    uint32_t decreases;             /* Period changes, for the report */
+    uint32_t increases;
+} test_rate_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void Test_Rate_Init(test_rate_t *rate, const test_rate_config_t *config,
+                    const test_rate_signals_t *signals);
+uint8_t Test_Rate_Update(test_rate_t *rate, const test_rate_signals_t *signals);
+uint32_t Test_Rate_Get_Period(const test_rate_t *rate, uint32_t test);
+uint32_t Test_Rate_Load_Ppm(const test_rate_t *rate, const uint32_t *cost_us);
+
+#endif /* TEST_RATE_H_ */
+
+
+/* [] END OF FILE */